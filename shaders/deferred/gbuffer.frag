@@ -1,5 +1,5 @@
 #version 460 core
-layout (location = 0) out vec4 gPosition;  // xyz = world pos, w = AO
+layout (location = 0) out vec4 gPosition;  // xyz = world pos, w = AO x sky light
 layout (location = 1) out vec4 gNormal;    // xyz = normal, w = light level
 layout (location = 2) out vec4 gAlbedo;    // rgb = albedo, a = emission
 
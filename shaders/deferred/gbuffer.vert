@@ -34,8 +34,11 @@ void main() {
     uint texSlot = aPackedData.w;
 
     fragNormal = NORMALS[normalIndex];
-    aoFactor = float(aoValue) / 255.0;
-    lightLevel = float(lightValue) / 255.0;
+    // Light byte: low nibble = block light, high nibble = sky light (0-15 each)
+    // Sky light darkens ambient + sun where the sky can't reach (caves, overhangs)
+    float skyLight = float(lightValue >> 4u) / 15.0;
+    aoFactor = float(aoValue) / 255.0 * mix(0.05, 1.0, skyLight);
+    lightLevel = float(lightValue & 15u) / 15.0;
 
     float slotX = float(texSlot % 16u);
     float slotY = float(texSlot / 16u);
@@ -1,12 +1,12 @@
 #version 460 core
 // Deferred Water Vertex Shader
 // Handles vertex displacement for wave animation
+// Packed water vertex format (16 bytes, see PackedWaterVertex)
 
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec2 aTexCoord;
-layout (location = 2) in vec3 aNormal;
-layout (location = 3) in float aAO;
-layout (location = 4) in float aLightLevel;
+layout (location = 0) in vec3 aPackedPos;      // uint16 * 3, scaled by 256
+layout (location = 1) in vec2 aPackedTexCoord; // uint16 * 2, 8.8 fixed point
+layout (location = 2) in uvec4 aPackedData;    // normalIndex, level, texSlot, flags
+layout (location = 3) in vec2 aFlow;           // Normalized flow direction (XZ)
 
 layout(location = 0) out vec3 fragPos;
 layout(location = 1) out vec3 fragNormal;
@@ -22,6 +22,19 @@ uniform float time;
 uniform vec3 chunkOffset;
 uniform vec3 cameraPos;
 
+// Normal lookup table (matches CPU-side NORMAL_LOOKUP)
+const vec3 NORMALS[6] = vec3[6](
+    vec3(1, 0, 0),   // 0: +X
+    vec3(-1, 0, 0),  // 1: -X
+    vec3(0, 1, 0),   // 2: +Y
+    vec3(0, -1, 0),  // 3: -Y
+    vec3(0, 0, 1),   // 4: +Z
+    vec3(0, 0, -1)   // 5: -Z
+);
+
+const uint WATER_VERTEX_LAVA = 1u;
+const float WATER_SOURCE = 8.0;
+
 // Simplex noise for wave displacement
 vec3 permute(vec3 x) { return mod(((x*34.0)+1.0)*x, 289.0); }
 
@@ -65,11 +78,16 @@ vec3 gerstnerWave(vec2 pos, vec2 dir, float steepness, float wavelength, float t
 }
 
 void main() {
-    vec3 pos = aPos + chunkOffset;
+    vec3 pos = aPackedPos / 256.0 + chunkOffset;
     vec3 originalPos = pos;
 
+    uint normalIndex = aPackedData.x;
+    float levelScale = float(aPackedData.y) / WATER_SOURCE;
+    bool isLava = (aPackedData.w & WATER_VERTEX_LAVA) != 0u;
+    vec3 normal = NORMALS[normalIndex];
+
     // Only animate top surface of water
-    if (aNormal.y > 0.5) {
+    if (normalIndex == 2u && !isLava) {
         vec2 samplePos = pos.xz;
 
         // Gerstner waves for realistic ocean motion
@@ -77,15 +95,18 @@ void main() {
         vec3 wave2 = gerstnerWave(samplePos, vec2(-0.7, 0.5), 0.12, 8.0, time * 0.6);
         vec3 wave3 = gerstnerWave(samplePos, vec2(0.2, -0.8), 0.08, 5.0, time * 1.0);
 
-        // Combine waves
-        vec3 waveOffset = wave1 + wave2 + wave3;
+        // Combine waves (shallow flowing water gets smaller waves)
+        vec3 waveOffset = (wave1 + wave2 + wave3) * levelScale;
 
         // Add small noise ripples
         float ripple = snoise(samplePos * 0.5 + time * 0.3) * 0.05;
         ripple += snoise(samplePos * 1.0 + time * 0.5) * 0.03;
 
         pos += waveOffset;
-        pos.y += ripple;
+        pos.y += ripple * levelScale;
+
+        // Flowing surfaces lean downstream
+        normal = normalize(vec3(aFlow.x * 0.25, 1.0, aFlow.y * 0.25));
     }
 
     // Calculate water depth from camera
@@ -98,6 +119,6 @@ void main() {
     gl_Position = clipSpacePos;
 
     fragPos = pos;
-    fragNormal = aNormal;
-    texCoord = aTexCoord;
+    fragNormal = normal;
+    texCoord = aPackedTexCoord / 256.0;
 }
@@ -15,7 +15,6 @@ layout(location = 0) out vec4 FragColor;
 
 layout(binding = 0) uniform sampler2D texAtlas;
 layout(binding = 1) uniform sampler2D shadowMap;
-layout(binding = 2) uniform sampler3D lightmapTexture;  // 3D lightmap for smooth lighting
 layout(binding = 3) uniform sampler2D normalMap;  // Normal map atlas
 layout(binding = 4) uniform sampler2D grassColormap;  // Biome colormap for grass/foliage tinting
 
@@ -31,7 +30,6 @@ const uint TINT_WATER = 11u;      // water_still
 const float ATLAS_SIZE = 16.0;
 const float SLOT_SIZE = 1.0 / ATLAS_SIZE;  // 0.0625
 
-uniform vec3 chunkOffset;  // World position of chunk origin (for lightmap sampling)
 uniform vec3 lightDir;
 uniform vec3 lightColor;
 uniform vec3 ambientColor;
@@ -218,24 +216,10 @@ void main() {
     // Check for emissive blocks (use tiledUV to identify block type)
     float emission = getEmission(tiledUV);
 
-    // Sample 3D lightmap for smooth block lighting (from emissive blocks like torches/glowstone)
+    // Smooth block light (from emissive blocks like torches/glowstone)
     // Note: This is BLOCK LIGHT only, not skylight. Skylight comes from sun/ambient calculations.
-    // Calculate local position within chunk (0-16 for X/Z, 0-256 for Y)
-    vec3 localPos = fragPos - chunkOffset;
-    // Convert to normalized texture coordinates (0-1 range)
-    // Add 0.5 to sample at block center, divide by chunk dimensions
-    vec3 lightmapCoord = vec3(
-        (localPos.x + 0.5) / 16.0,   // X: 0-16 -> 0-1
-        (localPos.z + 0.5) / 16.0,   // Z maps to texture Y (height in 3D tex)
-        (localPos.y + 0.5) / 256.0   // Y maps to texture Z (depth in 3D tex)
-    );
-    // Clamp to valid range to avoid edge artifacts
-    lightmapCoord = clamp(lightmapCoord, 0.001, 0.999);
-    // Sample lightmap (GL_LINEAR filtering provides smooth interpolation)
-    float sampledLight = texture(lightmapTexture, lightmapCoord).r;
-    // Use the higher of sampled lightmap or vertex light to ensure we don't darken areas
-    // that should be lit (vertex light is passed through as fallback)
-    float finalBlockLight = max(sampledLight, lightLevel);
+    // The mesher averages light per quad corner, so interpolated vertex light is already smooth.
+    float finalBlockLight = lightLevel;
 
     // Normal mapping with TBN matrix for voxel faces
     vec3 norm = normalize(fragNormal);
@@ -281,7 +265,7 @@ void main() {
     vec3 diffuse = diff * lightColor * 0.6 * (1.0 - shadow);
 
     // Point light contribution from emissive blocks (glowstone, lava)
-    // Use combined lightmap + vertex light for smooth lighting across greedy-meshed quads
+    // Per-corner vertex light gives smooth lighting across greedy-meshed quads
     vec3 pointLight = finalBlockLight * vec3(1.0, 0.85, 0.6) * 1.2;
 
     // Combine lighting with smooth AO
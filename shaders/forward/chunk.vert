@@ -52,9 +52,12 @@ void main() {
     // Look up normal from table
     fragNormal = NORMALS[normalIndex];
 
-    // Decode AO and light (0-255 to 0.0-1.0)
-    aoFactor = float(aoValue) / 255.0;
-    lightLevel = float(lightValue) / 255.0;
+    // Decode AO (0-255 to 0.0-1.0)
+    // Light byte: low nibble = block light, high nibble = sky light (0-15 each)
+    // Sky light darkens ambient + sun where the sky can't reach (caves, overhangs)
+    float skyLight = float(lightValue >> 4u) / 15.0;
+    aoFactor = float(aoValue) / 255.0 * mix(0.05, 1.0, skyLight);
+    lightLevel = float(lightValue & 15u) / 15.0;
 
     // Calculate texture slot base UV from slot index
     float slotX = float(texSlot % 16u);
@@ -8,6 +8,7 @@ layout(location = 2) in vec3 fragNormal;
 layout(location = 3) in vec3 fragPos;
 layout(location = 4) in float aoFactor;
 layout(location = 5) in float fogDepth;
+layout(location = 6) in vec2 flowDir;
 
 layout(location = 0) out vec4 FragColor;
 
@@ -53,7 +54,8 @@ float snoise(vec2 v) {
 }
 
 void main() {
-    vec2 pos = fragPos.xz;
+    // Advect the surface pattern along the flow direction (still water has zero flow)
+    vec2 pos = fragPos.xz - flowDir * time * 1.5;
 
     // Distance-based LOD
     float distToCamera = length(fragPos - cameraPos);
@@ -1,12 +1,11 @@
 #version 460 core
 // Optimized water vertex shader - simplified animation
+// Packed water vertex format (16 bytes, see PackedWaterVertex)
 
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec2 aTexCoord;
-layout (location = 2) in vec3 aNormal;
-layout (location = 3) in float aAO;
-layout (location = 4) in float aLightLevel;
-layout (location = 5) in vec2 aTexSlotBase;
+layout (location = 0) in vec3 aPackedPos;      // uint16 * 3, scaled by 256
+layout (location = 1) in vec2 aPackedTexCoord; // uint16 * 2, 8.8 fixed point
+layout (location = 2) in uvec4 aPackedData;    // normalIndex, level, texSlot, flags
+layout (location = 3) in vec2 aFlow;           // Normalized flow direction (XZ)
 
 layout(location = 0) out vec2 texCoord;
 layout(location = 1) out vec2 texSlotBase;
@@ -14,6 +13,7 @@ layout(location = 2) out vec3 fragNormal;
 layout(location = 3) out vec3 fragPos;
 layout(location = 4) out float aoFactor;
 layout(location = 5) out float fogDepth;
+layout(location = 6) out vec2 flowDir;
 
 uniform mat4 view;
 uniform mat4 projection;
@@ -21,6 +21,19 @@ uniform float time;
 uniform vec3 chunkOffset;
 uniform float waterAnimationEnabled;
 
+// Normal lookup table (matches CPU-side NORMAL_LOOKUP)
+const vec3 NORMALS[6] = vec3[6](
+    vec3(1, 0, 0),   // 0: +X
+    vec3(-1, 0, 0),  // 1: -X
+    vec3(0, 1, 0),   // 2: +Y
+    vec3(0, -1, 0),  // 3: -Y
+    vec3(0, 0, 1),   // 4: +Z
+    vec3(0, 0, -1)   // 5: -Z
+);
+
+const uint WATER_VERTEX_LAVA = 1u;
+const float WATER_SOURCE = 8.0;
+
 // Simple sine-based wave animation (much faster than noise)
 float waveHeight(vec2 pos, float t) {
     // Two overlapping sine waves for organic motion
@@ -31,19 +44,31 @@ float waveHeight(vec2 pos, float t) {
 }
 
 void main() {
-    vec3 pos = aPos + chunkOffset;
+    vec3 pos = aPackedPos / 256.0 + chunkOffset;
+
+    uint normalIndex = aPackedData.x;
+    float level = float(aPackedData.y);
+    uint texSlot = aPackedData.z;
+    bool isLava = (aPackedData.w & WATER_VERTEX_LAVA) != 0u;
+    vec3 normal = NORMALS[normalIndex];
+
+    // Only animate the top surface of water; shallow flowing water gets smaller waves
+    if (normalIndex == 2u && !isLava && waterAnimationEnabled > 0.5) {
+        pos.y += waveHeight(pos.xz, time) * (level / WATER_SOURCE);
+    }
 
-    // Only animate the top surface of water (normal pointing up)
-    if (aNormal.y > 0.5 && waterAnimationEnabled > 0.5) {
-        pos.y += waveHeight(pos.xz, time);
+    // Flowing surfaces lean downstream
+    if (normalIndex == 2u) {
+        normal = normalize(vec3(aFlow.x * 0.25, 1.0, aFlow.y * 0.25));
     }
 
     vec4 viewPos = view * vec4(pos, 1.0);
     gl_Position = projection * viewPos;
-    texCoord = aTexCoord;
-    texSlotBase = aTexSlotBase;
-    fragNormal = aNormal;
+    texCoord = aPackedTexCoord / 256.0;
+    texSlotBase = vec2(float(texSlot % 16u), float(texSlot / 16u)) / 16.0;
+    fragNormal = normal;
     fragPos = pos;
-    aoFactor = aAO;
+    aoFactor = 1.0;
     fogDepth = length(viewPos.xyz);
+    flowDir = aFlow;
 }
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+// ============================================
+// MAIN-THREAD FRAME BUDGET
+// ============================================
+// One time budget for all incremental main-thread work (chunk integration,
+// mesh uploads, unloads, GPU cleanup...). Replaces per-task "N per frame"
+// caps, which had to be retuned per machine and could each stay inside
+// their own limit while together blowing the frame.
+//
+// Work is registered as tasks that do one unit per call. Each frame the
+// tasks run in priority order (lowest first), unit by unit, while the
+// learned cost of the next unit (moving average of measured units) still
+// fits in what is left of the budget. Every task gets at least
+// minUnitsPerFrame units so nothing starves on a slow machine.
+//
+// The budget itself follows the frame time: it grows slowly while frames
+// hit the target and halves when one misses (additive increase,
+// multiplicative decrease), clamped to a fraction of the target frame.
+// While loading, the budget is fixed near the whole frame.
+// ============================================
+
+class FrameBudgetScheduler {
+public:
+    // Do one unit of work; return false when there was nothing to do
+    using WorkUnit = std::function<bool()>;
+
+    struct TaskStats {
+        std::string name;
+        int priority = 0;
+        int minUnitsPerFrame = 0;
+        double unitCostMs = 0.0;     // Learned cost of one unit
+        int lastUnits = 0;           // Units run in the last frame
+        double lastMs = 0.0;         // Time spent in the last frame
+        uint64_t totalUnits = 0;
+        bool hasBacklog = false;     // Stopped last frame on budget, not on empty
+    };
+
+    explicit FrameBudgetScheduler(double targetFrameMs = 1000.0 / 60.0) {
+        setTargetFrameMs(targetFrameMs);
+        budgetMs = targetMs * INITIAL_FRACTION;
+    }
+
+    // Register a task; equal priorities run in registration order
+    void addTask(const std::string& name, int priority, WorkUnit unit,
+                 double initialUnitCostMs, int minUnitsPerFrame = 1) {
+        Task task;
+        task.stats.name = name;
+        task.stats.priority = priority;
+        task.stats.minUnitsPerFrame = std::max(minUnitsPerFrame, 0);
+        task.stats.unitCostMs = initialUnitCostMs;
+        task.unit = std::move(unit);
+
+        auto it = std::upper_bound(tasks.begin(), tasks.end(), priority,
+            [](int p, const Task& t) { return p < t.stats.priority; });
+        tasks.insert(it, std::move(task));
+    }
+
+    // Frame time to protect, usually the display refresh interval
+    void setTargetFrameMs(double ms) {
+        targetMs = std::max(ms, 1.0);
+        budgetMs = std::clamp(budgetMs, MIN_BUDGET_MS, maxBudgetMs());
+    }
+
+    // Loading screens trade frame rate for throughput
+    void setLoading(bool isLoading) {
+        if (loading == isLoading) return;
+        loading = isLoading;
+        budgetMs = loading ? maxBudgetMs() : targetMs * INITIAL_FRACTION;
+    }
+
+    // Adapt the budget to the previous frame's duration (<= 0 = unknown, keep it)
+    void beginFrame(double lastFrameMs) {
+        if (loading) {
+            budgetMs = maxBudgetMs();
+            return;
+        }
+        if (lastFrameMs <= 0.0) return;
+
+        if (lastFrameMs > targetMs * MISS_TOLERANCE) {
+            budgetMs *= MISS_FACTOR;
+            missedFrames++;
+        } else if (lastFrameMs <= targetMs * HIT_TOLERANCE) {
+            budgetMs += GROWTH_MS;
+        }
+        budgetMs = std::clamp(budgetMs, MIN_BUDGET_MS, maxBudgetMs());
+    }
+
+    // Run tasks until the budget is spent; returns the time used in ms
+    double run() {
+        auto frameStart = std::chrono::high_resolution_clock::now();
+        auto elapsedMs = [&frameStart]() {
+            return std::chrono::duration<double, std::milli>(
+                std::chrono::high_resolution_clock::now() - frameStart).count();
+        };
+
+        for (Task& task : tasks) {
+            TaskStats& stats = task.stats;
+            stats.lastUnits = 0;
+            stats.lastMs = 0.0;
+            stats.hasBacklog = false;
+
+            while (true) {
+                double startMs = elapsedMs();
+                if (stats.lastUnits >= stats.minUnitsPerFrame &&
+                    startMs + stats.unitCostMs > budgetMs) {
+                    stats.hasBacklog = true;
+                    break;
+                }
+
+                if (!task.unit()) break;  // Nothing left to do
+
+                double unitMs = elapsedMs() - startMs;
+                stats.unitCostMs += (unitMs - stats.unitCostMs) * COST_WEIGHT;
+                stats.lastMs += unitMs;
+                stats.lastUnits++;
+                stats.totalUnits++;
+            }
+        }
+
+        lastUsedMs = elapsedMs();
+        return lastUsedMs;
+    }
+
+    double getBudgetMs() const { return budgetMs; }
+    double getTargetFrameMs() const { return targetMs; }
+    double getLastUsedMs() const { return lastUsedMs; }
+    uint64_t getMissedFrames() const { return missedFrames; }
+    bool isLoading() const { return loading; }
+
+    // Per-task cost, in priority order
+    std::vector<TaskStats> getStats() const {
+        std::vector<TaskStats> stats;
+        stats.reserve(tasks.size());
+        for (const Task& task : tasks) stats.push_back(task.stats);
+        return stats;
+    }
+
+    const TaskStats* findStats(const std::string& name) const {
+        for (const Task& task : tasks) {
+            if (task.stats.name == name) return &task.stats;
+        }
+        return nullptr;
+    }
+
+private:
+    struct Task {
+        TaskStats stats;
+        WorkUnit unit;
+    };
+
+    static constexpr double COST_WEIGHT = 0.2;        // EMA weight of the newest unit
+    static constexpr double INITIAL_FRACTION = 0.2;   // Starting budget, of the target frame
+    static constexpr double MAX_FRACTION = 0.4;       // Budget ceiling while playing
+    static constexpr double LOADING_FRACTION = 0.9;   // Fixed budget while loading
+    static constexpr double MIN_BUDGET_MS = 0.5;
+    static constexpr double GROWTH_MS = 0.05;         // Added per frame that hit the target
+    static constexpr double MISS_FACTOR = 0.5;        // Applied per frame that missed it
+    static constexpr double HIT_TOLERANCE = 1.05;     // Vsync jitter still counts as a hit
+    static constexpr double MISS_TOLERANCE = 1.25;
+
+    double maxBudgetMs() const {
+        return std::max(targetMs * (loading ? LOADING_FRACTION : MAX_FRACTION), MIN_BUDGET_MS);
+    }
+
+    std::vector<Task> tasks;  // Sorted by priority
+    double targetMs = 1000.0 / 60.0;
+    double budgetMs = 0.0;
+    double lastUsedMs = 0.0;
+    uint64_t missedFrames = 0;
+    bool loading = false;
+};
@@ -2,6 +2,7 @@
 
 #include "Camera.h"
 #include "../world/World.h"
+#include "../world/VoxelCollision.h"
 #include <glm/glm.hpp>
 #include <algorithm>
 
@@ -9,6 +10,7 @@ class Player {
 public:
     // Position and movement
     glm::vec3 position;
+    glm::vec3 previousPosition;  // Position before the last physics tick (render interpolation)
     glm::vec3 velocity{0.0f};
 
     // Player dimensions (hitbox)
@@ -92,16 +94,18 @@ public:
     // Reference to camera for view direction
     Camera* camera = nullptr;
 
-    Player(const glm::vec3& startPos) : position(startPos) {}
+    Player(const glm::vec3& startPos) : position(startPos), previousPosition(startPos) {}
 
     void attachCamera(Camera* cam) {
         camera = cam;
         updateCameraPosition();
     }
 
-    void updateCameraPosition() {
+    // alpha blends from the previous physics tick (0) to the current one (1)
+    void updateCameraPosition(float alpha = 1.0f) {
         if (camera) {
-            camera->position = position + glm::vec3(0.0f, EYE_HEIGHT, 0.0f);
+            glm::vec3 eyeBase = glm::mix(previousPosition, position, alpha);
+            camera->position = eyeBase + glm::vec3(0.0f, EYE_HEIGHT, 0.0f);
         }
     }
 
@@ -131,6 +135,7 @@ public:
                 bool forward, bool backward, bool left, bool right,
                 bool jump, bool descend, bool sprint) {
 
+        previousPosition = position;
         isSprinting = sprint && forward && !backward;
 
         // Check water status
@@ -277,6 +282,7 @@ public:
         eatingTimer = 0.0f;
         velocity = glm::vec3(0.0f);
         position = spawnPoint;
+        previousPosition = spawnPoint;  // Don't interpolate across the teleport
         updateCameraPosition();
     }
 
@@ -530,97 +536,32 @@ private:
         moveWithCollision(deltaTime, world);
     }
 
-    void moveWithCollision(float deltaTime, World& world) {
-        // Split movement into smaller steps for better collision
-        float remainingTime = deltaTime;
-        int maxSteps = 4;
-
-        while (remainingTime > 0.0001f && maxSteps > 0) {
-            float stepTime = std::min(remainingTime, 0.02f);
-            glm::vec3 displacement = velocity * stepTime;
-
-            // Move on each axis separately for sliding collision
-            // Y axis first (gravity)
-            if (std::abs(displacement.y) > 0.0001f) {
-                float newY = position.y + displacement.y;
-                if (!checkCollision(world, position.x, newY, position.z)) {
-                    position.y = newY;
-                } else {
-                    // Hit floor or ceiling
-                    if (velocity.y < 0) {
-                        // Hit floor - find exact ground position
-                        position.y = std::floor(position.y) + 0.001f;
-                        onGround = true;
-                    }
-                    velocity.y = 0;
-                }
-            }
-
-            // X axis
-            if (std::abs(displacement.x) > 0.0001f) {
-                float newX = position.x + displacement.x;
-                if (!checkCollision(world, newX, position.y, position.z)) {
-                    position.x = newX;
-                } else {
-                    velocity.x = 0;
-                }
-            }
-
-            // Z axis
-            if (std::abs(displacement.z) > 0.0001f) {
-                float newZ = position.z + displacement.z;
-                if (!checkCollision(world, position.x, position.y, newZ)) {
-                    position.z = newZ;
-                } else {
-                    velocity.z = 0;
-                }
-            }
+    // Player AABB with feet at the given position
+    VoxelAABB getBoundingBox(const glm::vec3& feet) const {
+        float halfWidth = WIDTH / 2.0f;
+        return {feet - glm::vec3(halfWidth, 0.0f, halfWidth),
+                feet + glm::vec3(halfWidth, HEIGHT, halfWidth)};
+    }
 
-            remainingTime -= stepTime;
-            maxSteps--;
+    // OPTIMIZATION: One swept move per update instead of up to four sub-steps of
+    // per-axis overlap tests; the sweep can't tunnel, and reads blocks through
+    // a pinned WorldView instead of World::getBlock per voxel.
+    void moveWithCollision(float deltaTime, World& world) {
+        VoxelCollider collider(world, position);
+        VoxelCollider::SweepResult result = collider.sweep(getBoundingBox(position), velocity * deltaTime);
+        position += result.moved;
+
+        if (result.hitY) {
+            // Hit floor or ceiling
+            if (velocity.y < 0) onGround = true;
+            velocity.y = 0;
         }
+        if (result.hitX) velocity.x = 0;
+        if (result.hitZ) velocity.z = 0;
 
         // Check if still on ground (for next frame)
         if (!isFlying && velocity.y <= 0) {
-            onGround = checkCollision(world, position.x, position.y - 0.05f, position.z);
-        }
-    }
-
-    // Check if player AABB collides with any solid blocks
-    bool checkCollision(World& world, float x, float y, float z) {
-        // Player AABB bounds
-        float halfWidth = WIDTH / 2.0f;
-        float minX = x - halfWidth;
-        float maxX = x + halfWidth;
-        float minY = y;
-        float maxY = y + HEIGHT;
-        float minZ = z - halfWidth;
-        float maxZ = z + halfWidth;
-
-        // Check all blocks the player could intersect
-        int blockMinX = static_cast<int>(std::floor(minX));
-        int blockMaxX = static_cast<int>(std::floor(maxX));
-        int blockMinY = static_cast<int>(std::floor(minY));
-        int blockMaxY = static_cast<int>(std::floor(maxY));
-        int blockMinZ = static_cast<int>(std::floor(minZ));
-        int blockMaxZ = static_cast<int>(std::floor(maxZ));
-
-        for (int by = blockMinY; by <= blockMaxY; by++) {
-            for (int bz = blockMinZ; bz <= blockMaxZ; bz++) {
-                for (int bx = blockMinX; bx <= blockMaxX; bx++) {
-                    BlockType block = world.getBlock(bx, by, bz);
-                    if (isBlockSolid(block)) {
-                        // AABB vs AABB intersection
-                        if (minX < bx + 1 && maxX > bx &&
-                            minY < by + 1 && maxY > by &&
-                            minZ < bz + 1 && maxZ > bz) {
-                            return true;
-                        }
-                    }
-                }
-            }
+            onGround = collider.overlapsSolid(getBoundingBox(position - glm::vec3(0.0f, 0.05f, 0.0f)));
         }
-
-        return false;
     }
 };
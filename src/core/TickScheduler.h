@@ -0,0 +1,183 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// ============================================
+// FIXED-RATE SIMULATION TICKS
+// ============================================
+// Simulation advances in fixed steps instead of by frame deltaTime, so a
+// run gives the same results at any frame rate (benchmarks, replays) and the
+// whole tick can later move to its own thread.
+//
+// Each frame adds its real time to an accumulator and runs one tick per
+// whole step it holds. Systems run in priority order (lowest first), each on
+// every Nth tick. Catch-up is capped at maxTicksPerFrame ticks per frame;
+// backlog past the cap is dropped - the simulation slows down for that
+// frame instead of spiralling - and each system counts the runs it lost. System time budgets only feed the stats, so
+// the number of ticks run never depends on how long a system took (two runs
+// of the same input stay in step). setBudgetThrottling(true) opts into also
+// stopping catch-up once a system goes over budget - not for benchmarks or
+// replays.
+//
+// Rendering interpolates between the last two ticks with getAlpha().
+// ============================================
+
+class TickScheduler {
+public:
+    // Receives the fixed step in seconds (times the system's tick interval)
+    using TickHandler = std::function<void(float tickSeconds)>;
+
+    struct SystemStats {
+        std::string name;
+        int priority = 0;
+        int interval = 1;            // Runs every N ticks
+        double budgetMs = 0.0;       // Per run; 0 = unbudgeted
+        double lastMs = 0.0;         // Cost of the most recent run
+        double averageMs = 0.0;      // Moving average over recent runs
+        double peakMs = 0.0;         // Worst run since the last resetPeaks()
+        uint64_t runs = 0;
+        uint64_t overBudgetRuns = 0;
+        uint64_t skippedRuns = 0;    // Runs that fell in dropped backlog ticks
+    };
+
+    explicit TickScheduler(double ticksPerSecond = 60.0, int maxTicksPerFrame = 5)
+        : tickSeconds(1.0 / ticksPerSecond), maxTicksPerFrame(maxTicksPerFrame) {}
+
+    // Register a system; equal priorities run in registration order
+    void addSystem(const std::string& name, int priority, TickHandler handler,
+                   int interval = 1, double budgetMs = 0.0) {
+        System system;
+        system.stats.name = name;
+        system.stats.priority = priority;
+        system.stats.interval = std::max(interval, 1);
+        system.stats.budgetMs = budgetMs;
+        system.handler = std::move(handler);
+
+        auto it = std::upper_bound(systems.begin(), systems.end(), priority,
+            [](int p, const System& s) { return p < s.stats.priority; });
+        systems.insert(it, std::move(system));
+    }
+
+    // Add a frame's real time and run the ticks it covers
+    // Returns the number of ticks run
+    int advance(double frameSeconds) {
+        accumulator += std::max(frameSeconds, 0.0);
+
+        int ticksRun = 0;
+        while (accumulator >= tickSeconds && ticksRun < maxTicksPerFrame) {
+            bool withinBudget = runTick();
+            accumulator -= tickSeconds;
+            ticksRun++;
+            if (!withinBudget) {
+                overBudgetTicks++;
+                if (budgetThrottling) break;  // Don't pile catch-up onto an overloaded system
+            }
+        }
+
+        // Drop whatever backlog is left (keeps the fractional part for interpolation)
+        if (accumulator >= tickSeconds) {
+            uint64_t backlog = static_cast<uint64_t>(accumulator / tickSeconds);
+            droppedTicks += backlog;
+            accumulator -= static_cast<double>(backlog) * tickSeconds;
+            countSkippedRuns(backlog);
+        }
+        return ticksRun;
+    }
+
+    // Fraction of a tick since the last one ran, for render interpolation [0, 1)
+    float getAlpha() const { return static_cast<float>(accumulator / tickSeconds); }
+
+    // Whole ticks (at least 1) covering a duration in seconds
+    int ticksFor(double seconds) const {
+        return std::max(1, static_cast<int>(std::lround(seconds / tickSeconds)));
+    }
+
+    double getTickSeconds() const { return tickSeconds; }
+    uint64_t getTickCount() const { return tickCount; }
+    uint64_t getDroppedTicks() const { return droppedTicks; }
+    // Ticks where some system went over its budget
+    uint64_t getOverBudgetTicks() const { return overBudgetTicks; }
+
+    // Stop catch-up after an over-budget tick (off: tick count is wall-clock independent)
+    void setBudgetThrottling(bool enabled) { budgetThrottling = enabled; }
+    bool isBudgetThrottling() const { return budgetThrottling; }
+
+    // Per-system tick cost, in priority order
+    std::vector<SystemStats> getStats() const {
+        std::vector<SystemStats> stats;
+        stats.reserve(systems.size());
+        for (const System& system : systems) stats.push_back(system.stats);
+        return stats;
+    }
+
+    const SystemStats* findStats(const std::string& name) const {
+        for (const System& system : systems) {
+            if (system.stats.name == name) return &system.stats;
+        }
+        return nullptr;
+    }
+
+    void resetPeaks() {
+        for (System& system : systems) system.stats.peakMs = 0.0;
+    }
+
+    // Forget accumulated time (after loading screens, pauses, world switches)
+    void resetClock() { accumulator = 0.0; }
+
+private:
+    struct System {
+        SystemStats stats;
+        TickHandler handler;
+        uint64_t droppedTicks = 0;  // Backlog dropped while this system was registered
+    };
+
+    static constexpr double AVERAGE_WEIGHT = 0.05;  // EMA weight of the newest run
+
+    // Charge each system the runs it would have had in the dropped ticks
+    void countSkippedRuns(uint64_t backlog) {
+        for (System& system : systems) {
+            system.droppedTicks += backlog;
+            system.stats.skippedRuns = system.droppedTicks / static_cast<uint64_t>(system.stats.interval);
+        }
+    }
+
+    // Run every system due this tick; false if any went over its budget
+    bool runTick() {
+        bool withinBudget = true;
+        for (System& system : systems) {
+            SystemStats& stats = system.stats;
+            if (tickCount % static_cast<uint64_t>(stats.interval) != 0) continue;
+
+            auto start = std::chrono::high_resolution_clock::now();
+            system.handler(static_cast<float>(tickSeconds * stats.interval));
+            auto end = std::chrono::high_resolution_clock::now();
+
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            stats.lastMs = ms;
+            stats.averageMs = stats.runs == 0 ? ms : stats.averageMs + (ms - stats.averageMs) * AVERAGE_WEIGHT;
+            stats.peakMs = std::max(stats.peakMs, ms);
+            stats.runs++;
+            if (stats.budgetMs > 0.0 && ms > stats.budgetMs) {
+                stats.overBudgetRuns++;
+                withinBudget = false;
+            }
+        }
+        tickCount++;
+        return withinBudget;
+    }
+
+    std::vector<System> systems;  // Sorted by priority
+    double tickSeconds;
+    int maxTicksPerFrame;
+    double accumulator = 0.0;
+    uint64_t tickCount = 0;
+    uint64_t droppedTicks = 0;
+    uint64_t overBudgetTicks = 0;
+    bool budgetThrottling = false;
+};
@@ -8,7 +8,10 @@
 #include "core/Player.h"
 #include "core/Raycast.h"
 #include "core/Config.h"
+#include "core/TickScheduler.h"
 #include "world/World.h"
+#include "world/WorldView.h"
+#include "world/RaycastBatch.h"
 #include "world/DroppedItem.h"
 #include "world/WorldPresets.h"
 #include "render/Crosshair.h"
@@ -95,6 +98,7 @@ float lastY = WINDOW_HEIGHT / 2.0f;
 bool firstMouse = true;
 float deltaTime = 0.0f;
 float lastFrame = 0.0f;
+constexpr double SIMULATION_TICK_RATE = 60.0;  // Fixed simulation ticks per second
 
 // World
 World world;
@@ -104,6 +108,7 @@ bool flyTogglePressed = false;
 
 // Block interaction
 std::optional<RaycastHit> currentTarget;
+RaycastBatch targetRays;  // Reused each frame for the block-targeting cast
 constexpr float REACH_DISTANCE = 5.0f;
 
 // Mining state (survival mode)
@@ -144,7 +149,8 @@ JEIPanel jeiPanel;
 ItemAtlas itemAtlas;
 
 // Dropped item system
-DroppedItemManager droppedItems;
+ECS::Registry entityRegistry;  // Dynamic objects (dropped items for now)
+DroppedItemManager droppedItems{entityRegistry};
 DroppedItemRenderer droppedItemRenderer;
 
 // Wireframe toggle
@@ -222,7 +228,7 @@ bool loadingExistingWorld = false;  // True if loading existing world, false if
 
 // G-Buffer textures and FBO
 GLuint gBufferFBO = 0;
-GLuint gPosition = 0;    // RGB16F: world position, A: vertex AO
+GLuint gPosition = 0;    // RGB16F: world position, A: vertex AO x sky light
 GLuint gNormal = 0;      // RGB16F: world normal, A: light level
 GLuint gAlbedo = 0;      // RGBA8: albedo RGB, emission flag A
 GLuint gDepth = 0;       // DEPTH32F: linear depth
@@ -1175,9 +1181,12 @@ void main() {
     // Look up normal from table
     fragNormal = NORMALS[normalIndex];
 
-    // Decode AO and light (0-255 to 0.0-1.0)
-    aoFactor = float(aoValue) / 255.0;
-    lightLevel = float(lightValue) / 255.0;
+    // Decode AO (0-255 to 0.0-1.0)
+    // Light byte: low nibble = block light, high nibble = sky light (0-15 each)
+    // Sky light darkens ambient + sun where the sky can't reach (caves, overhangs)
+    float skyLight = float(lightValue >> 4u) / 15.0;
+    aoFactor = float(aoValue) / 255.0 * mix(0.05, 1.0, skyLight);
+    lightLevel = float(lightValue & 15u) / 15.0;
 
     // Calculate texture slot base UV from slot index
     float slotX = float(texSlot % 16u);
@@ -2652,8 +2661,11 @@ void main() {
     uint texSlot = aPackedData.w;
 
     fragNormal = NORMALS[normalIndex];
-    aoFactor = float(aoValue) / 255.0;
-    lightLevel = float(lightValue) / 255.0;
+    // Light byte: low nibble = block light, high nibble = sky light (0-15 each)
+    // Sky light darkens ambient + sun where the sky can't reach (caves, overhangs)
+    float skyLight = float(lightValue >> 4u) / 15.0;
+    aoFactor = float(aoValue) / 255.0 * mix(0.05, 1.0, skyLight);
+    lightLevel = float(lightValue & 15u) / 15.0;
 
     float slotX = float(texSlot % 16u);
     float slotY = float(texSlot / 16u);
@@ -2673,7 +2685,7 @@ void main() {
 // G-Buffer geometry pass fragment shader
 const char* gBufferFragmentSource = R"(
 #version 460 core
-layout (location = 0) out vec4 gPosition;  // xyz = world pos, w = AO
+layout (location = 0) out vec4 gPosition;  // xyz = world pos, w = AO x sky light
 layout (location = 1) out vec4 gNormal;    // xyz = normal, w = light level
 layout (location = 2) out vec4 gAlbedo;    // rgb = albedo, a = emission
 
@@ -3210,7 +3222,7 @@ const char* meshTaskShaderSource = R"(
 
 layout(local_size_x = 32) in;
 
-// Meshlet descriptor (32 bytes) - matches MeshletDescriptor in ChunkMesh.h
+// Meshlet descriptor (48 bytes) - matches MeshletDescriptor in ChunkMesh.h
 struct Meshlet {
     uint vertexOffset;      // Offset into vertex SSBO
     uint vertexCount;       // Number of vertices
@@ -3218,6 +3230,8 @@ struct Meshlet {
     uint triangleCount;     // Number of triangles
     float centerX, centerY, centerZ;  // Bounding sphere center
     float radius;           // Bounding sphere radius
+    float coneAxisX, coneAxisY, coneAxisZ;  // Normal cone axis
+    float coneCutoff;       // sin(cone half-angle), 1 = never cull
 };
 
 layout(std430, binding = 2) readonly buffer MeshletBuffer {
@@ -3229,6 +3243,7 @@ layout(std140, binding = 3) uniform MeshShaderData {
     mat4 viewProj;
     vec3 chunkOffset;
     uint meshletCount;      // Total meshlets for this draw
+    vec3 cameraPos;         // For normal cone culling
 };
 
 // Additional frustum data for culling
@@ -3251,6 +3266,12 @@ bool isVisible(vec3 center, float radius) {
     return true;
 }
 
+// Normal cone culling - every triangle in the meshlet faces away from the camera
+bool isBackfacing(vec3 center, float radius, vec3 axis, float cutoff) {
+    vec3 toCenter = center - cameraPos;
+    return dot(toCenter, axis) >= cutoff * length(toCenter) + radius;
+}
+
 void main() {
     uint meshletIndex = gl_GlobalInvocationID.x;
 
@@ -3259,7 +3280,8 @@ void main() {
         Meshlet m = meshlets[meshletIndex];
         vec3 localCenter = vec3(m.centerX, m.centerY, m.centerZ);
         vec3 worldCenter = localCenter + chunkOffset;
-        visible = isVisible(worldCenter, m.radius);
+        visible = isVisible(worldCenter, m.radius) &&
+                  !isBackfacing(worldCenter, m.radius, vec3(m.coneAxisX, m.coneAxisY, m.coneAxisZ), m.coneCutoff);
     }
 
     // Count visible meshlets using subgroup operations
@@ -3289,10 +3311,10 @@ const char* meshShaderSource = R"(
 // Workgroup size: 32 threads (optimal for Turing/Ampere)
 layout(local_size_x = 32) in;
 
-// Output: triangles, max 64 vertices, max 21 primitives (64 vertices / 3 = 21 triangles)
-layout(triangles, max_vertices = 64, max_primitives = 21) out;
+// Output: triangles, max 128 vertices, max 42 primitives (matches MESHLET_MAX_VERTICES in ChunkMesh.h)
+layout(triangles, max_vertices = 128, max_primitives = 42) out;
 
-// Meshlet descriptor (32 bytes) - matches MeshletDescriptor in ChunkMesh.h
+// Meshlet descriptor (48 bytes) - matches MeshletDescriptor in ChunkMesh.h
 struct Meshlet {
     uint vertexOffset;      // Offset into vertex SSBO
     uint vertexCount;       // Number of vertices
@@ -3300,6 +3322,8 @@ struct Meshlet {
     uint triangleCount;     // Number of triangles
     float centerX, centerY, centerZ;  // Bounding sphere center
     float radius;           // Bounding sphere radius
+    float coneAxisX, coneAxisY, coneAxisZ;  // Normal cone axis
+    float coneCutoff;       // sin(cone half-angle), 1 = never cull
 };
 
 // Vertex data SSBO - packed as uvec4 (16 bytes each = 4 uints)
@@ -3318,6 +3342,7 @@ layout(std140, binding = 3) uniform MeshShaderData {
     mat4 viewProj;
     vec3 chunkOffset;
     uint meshletCount;
+    vec3 cameraPos;
 };
 
 // Task input
@@ -3423,8 +3448,10 @@ void main() {
         v_out[i].normal = normal;
         v_out[i].texCoord = texCoord;
         v_out[i].texSlotBase = texSlotBase;
-        v_out[i].aoFactor = float(ao) / 255.0;
-        v_out[i].lightLevel = float(light) / 255.0;
+        // Light byte: low nibble = block light, high nibble = sky light (0-15 each)
+        float skyLight = float(light >> 4u) / 15.0;
+        v_out[i].aoFactor = float(ao) / 255.0 * mix(0.05, 1.0, skyLight);
+        v_out[i].lightLevel = float(light & 15u) / 15.0;
     }
 
     // For non-indexed triangles, set sequential indices (0,1,2, 3,4,5, ...)
@@ -4150,6 +4177,9 @@ int main() {
     g_config.load("settings.cfg");
     LOG_INFO("Config", "Configuration loaded from settings.cfg");
 
+    // Block definitions (before any world thread reads the block tables)
+    g_blockRegistry.loadFromFile("assets/blocks.cfg");
+
     // Apply config to globals
     WINDOW_WIDTH = g_config.windowWidth;
     WINDOW_HEIGHT = g_config.windowHeight;
@@ -4740,10 +4770,10 @@ int main() {
 
         // Create UBOs for mesh shader
         if (g_meshShadersAvailable && meshShaderProgram != 0) {
-            // Mesh shader data UBO (binding = 3): mat4 viewProj, vec3 chunkOffset, uint meshletCount
+            // Mesh shader data UBO (binding = 3): mat4 viewProj, vec3 chunkOffset, uint meshletCount, vec3 cameraPos
             glGenBuffers(1, &meshShaderDataUBO);
             glBindBuffer(GL_UNIFORM_BUFFER, meshShaderDataUBO);
-            glBufferData(GL_UNIFORM_BUFFER, sizeof(glm::mat4) + 4 * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
+            glBufferData(GL_UNIFORM_BUFFER, sizeof(glm::mat4) + 8 * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
             glBindBufferBase(GL_UNIFORM_BUFFER, 3, meshShaderDataUBO);
             glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
@@ -5541,6 +5571,11 @@ int main() {
     world.maxChunksPerFrame = g_config.maxChunksPerFrame;
     world.maxMeshesPerFrame = g_config.maxMeshesPerFrame;
 
+    // Main-thread world work is budgeted against the display's refresh interval
+    const GLFWvidmode* budgetVideoMode = glfwGetVideoMode(glfwGetPrimaryMonitor());
+    int budgetRefreshRate = (budgetVideoMode && budgetVideoMode->refreshRate > 0) ? budgetVideoMode->refreshRate : 60;
+    world.frameBudget.setTargetFrameMs(1000.0 / budgetRefreshRate);
+
     // Create player placeholder (will set proper spawn after chunks load)
     glm::vec3 spawnPos(8.0f, 100.0f, 8.0f);
     Player localPlayer(spawnPos);
@@ -5564,6 +5599,7 @@ int main() {
         std::cout << "\nResetting world for new generation..." << std::endl;
         LOG_INFO("World", "Resetting world state");
         world.reset();
+        droppedItems.clear();  // Items belong to the previous world
 
         // Apply world settings from menu
         int newSeed = static_cast<int>(worldSettings.seedValue & 0x7FFFFFFF);
@@ -5571,6 +5607,7 @@ int main() {
         world.chunkThreadPool->setSeed(newSeed);  // Update thread pool generators too
         world.terrainGenerator.maxHeight = worldSettings.maxYHeight;
         world.chunkThreadPool->setMaxHeight(worldSettings.maxYHeight);  // Update thread pool too
+        world.setCaveSampling(worldSettings.caveSampling);  // Main + thread pool generators
         // TODO: Add continentScale, mountainScale, detailScale to TerrainGenerator
         // world.terrainGenerator.continentScale = worldSettings.continentScale;
         // world.terrainGenerator.mountainScale = worldSettings.mountainScale;
@@ -5683,6 +5720,71 @@ int main() {
     float fogDensity = g_config.fogDensity;
     std::cout << "Day length: " << dayLength << " seconds (24 min = full day/night cycle)" << std::endl;
 
+    // ============================================================
+    // Fixed-rate simulation ticks
+    // ============================================================
+    // Player physics, dropped items, precipitation and water advance in fixed
+    // steps of 1/SIMULATION_TICK_RATE; the frame loop feeds real time in and
+    // interpolates the camera between the last two player ticks.
+    TickScheduler tickScheduler(SIMULATION_TICK_RATE);
+    InputState tickInput;          // Latched every frame, read by the player tick
+    bool simulatePlayer = false;   // Off while the benchmark drives the camera
+
+    tickScheduler.addSystem("player", 0, [&](float dt) {
+        if (!simulatePlayer || !player) return;
+        player->update(dt, world,
+                       tickInput.forward, tickInput.backward, tickInput.left, tickInput.right,
+                       tickInput.jump, tickInput.descend, tickInput.sprint);
+    }, 1, 2.0);
+
+    tickScheduler.addSystem("droppedItems", 10, [&](float dt) {
+        if (!simulatePlayer || !player) return;
+        droppedItems.update(dt, world, player->position, playerInventory);
+    }, 1, 1.0);
+
+    // Precipitation particles (world space)
+    tickScheduler.addSystem("precipitation", 20, [&](float dt) {
+        if (currentWeather != WeatherType::CLEAR && weatherIntensity > 0.01f) {
+            // Initialize particles around camera on first use
+            if (!particlesInitialized) {
+                for (int i = 0; i < MAX_PARTICLES; i++) {
+                    particles[i].x = camera.position.x + posDist(rng);
+                    particles[i].y = camera.position.y + heightDist(rng);
+                    particles[i].z = camera.position.z + posDist(rng);
+                }
+                particlesInitialized = true;
+            }
+
+            float fallSpeed = (currentWeather == WeatherType::SNOW) ? 3.0f : 20.0f;
+            float spawnRadius = 80.0f;
+
+            for (int i = 0; i < MAX_PARTICLES; i++) {
+                // Fall down in world space
+                particles[i].y -= particles[i].speed * fallSpeed * dt / 20.0f;
+
+                // Check if particle is too far from camera or below ground
+                float dx = particles[i].x - camera.position.x;
+                float dz = particles[i].z - camera.position.z;
+                float distSq = dx * dx + dz * dz;
+
+                // Respawn if too far horizontally, too low, or fell below camera view
+                if (distSq > spawnRadius * spawnRadius ||
+                    particles[i].y < camera.position.y - 30.0f ||
+                    particles[i].y < 0.0f) {
+                    // Respawn at top within range of camera
+                    particles[i].x = camera.position.x + posDist(rng);
+                    particles[i].y = camera.position.y + 30.0f + heightDist(rng) * 0.5f;
+                    particles[i].z = camera.position.z + posDist(rng);
+                }
+            }
+        }
+    }, 1, 1.0);
+
+    // Water runs its tick on the chunk threads and publishes it before returning
+    tickScheduler.addSystem("water", 30, [&](float) {
+        world.tickWater();
+    }, tickScheduler.ticksFor(World::WATER_TICK_INTERVAL), 2.0);
+
     // Main loop
     while (!glfwWindowShouldClose(window)) {
         // Calculate delta time
@@ -5844,6 +5946,7 @@ int main() {
                     worldSettings.seedValue = static_cast<uint64_t>(selectedWorld->seed);
                     worldSettings.generationType = static_cast<GenerationType>(selectedWorld->generationType);
                     worldSettings.maxYHeight = selectedWorld->maxHeight;
+                    worldSettings.caveSampling = static_cast<CaveSampling>(selectedWorld->caveSampling);
 
                     // Update last played time
                     WorldSaveLoad::updateLastPlayed(selectedWorld->folderPath);
@@ -5917,7 +6020,8 @@ int main() {
                 int newSeed = static_cast<int>(worldSettings.seedValue & 0x7FFFFFFF);
                 WorldSaveLoad::saveWorldMeta(worldSaveLoad.currentWorldPath, worldSettings.worldName,
                                             newSeed, static_cast<int>(worldSettings.generationType),
-                                            worldSettings.maxYHeight);
+                                            worldSettings.maxYHeight,
+                                            static_cast<int>(worldSettings.caveSampling));
 
                 startWorldGeneration();
             }
@@ -6064,6 +6168,7 @@ int main() {
                 // for mesh generation AND uploads to GPU incrementally (bounded RAM usage)
                 world.burstMode = true;
                 glm::ivec2 centerChunk = Chunk::worldToChunkPos(spawnPos);
+                world.runFrameBudget(deltaTime);
                 world.updateMeshes(centerChunk);
 
                 // Count how many meshes are done
@@ -6133,7 +6238,9 @@ int main() {
                         player->position = spawnPos;
                         player->spawnPoint = spawnPos;  // Set initial spawn point
                     }
+                    player->previousPosition = player->position;
                     camera.position = player->position + glm::vec3(0, Player::EYE_HEIGHT, 0);
+                    tickScheduler.resetClock();  // Loading time isn't simulation backlog
 
                     std::cout << "Loading complete! " << chunksLoaded << " chunks, " << meshesBuilt << " meshes" << std::endl;
                     std::cout << "Player at: " << player->position.x << ", " << player->position.y << ", " << player->position.z << std::endl;
@@ -6575,42 +6682,6 @@ int main() {
             }
         }
 
-        // Update precipitation particles (world space)
-        if (currentWeather != WeatherType::CLEAR && weatherIntensity > 0.01f) {
-            // Initialize particles around camera on first use
-            if (!particlesInitialized) {
-                for (int i = 0; i < MAX_PARTICLES; i++) {
-                    particles[i].x = camera.position.x + posDist(rng);
-                    particles[i].y = camera.position.y + heightDist(rng);
-                    particles[i].z = camera.position.z + posDist(rng);
-                }
-                particlesInitialized = true;
-            }
-
-            float fallSpeed = (currentWeather == WeatherType::SNOW) ? 3.0f : 20.0f;
-            float spawnRadius = 80.0f;
-
-            for (int i = 0; i < MAX_PARTICLES; i++) {
-                // Fall down in world space
-                particles[i].y -= particles[i].speed * fallSpeed * deltaTime / 20.0f;
-
-                // Check if particle is too far from camera or below ground
-                float dx = particles[i].x - camera.position.x;
-                float dz = particles[i].z - camera.position.z;
-                float distSq = dx * dx + dz * dz;
-
-                // Respawn if too far horizontally, too low, or fell below camera view
-                if (distSq > spawnRadius * spawnRadius ||
-                    particles[i].y < camera.position.y - 30.0f ||
-                    particles[i].y < 0.0f) {
-                    // Respawn at top within range of camera
-                    particles[i].x = camera.position.x + posDist(rng);
-                    particles[i].y = camera.position.y + 30.0f + heightDist(rng) * 0.5f;
-                    particles[i].z = camera.position.z + posDist(rng);
-                }
-            }
-        }
-
         // FPS counter with chunk stats and time
         frameCount++;
         if (currentFrame - lastFPSTime >= 1.0) {
@@ -6635,6 +6706,14 @@ int main() {
         auto inputStart = std::chrono::high_resolution_clock::now();
         InputState input = processInput(window);
 
+        // Run the simulation ticks this frame's time covers
+        tickInput = input;
+        simulatePlayer = !(g_benchmarkMode && g_benchmark.isRunning);
+        tickScheduler.advance(deltaTime);
+        if (const TickScheduler::SystemStats* precip = tickScheduler.findStats("precipitation")) {
+            g_perfStats.particleUpdateMs = precip->lastMs;
+        }
+
         // Benchmark mode - override camera control
         if (g_benchmarkMode && g_benchmark.isRunning) {
             glm::vec3 benchPos, benchLookAt;
@@ -6651,6 +6730,7 @@ int main() {
                 camera.setOrientation(yaw, pitch);
 
                 player->position = benchPos;
+                player->previousPosition = benchPos;
 
                 // Apply scenario settings
                 auto* scenario = g_benchmark.getCurrentScenario();
@@ -6692,9 +6772,8 @@ int main() {
             if (!loggedFirstFrame) {
                 LOG_DEBUG("Game", "First frame player update starting");
             }
-            player->update(deltaTime, world,
-                           input.forward, input.backward, input.left, input.right,
-                           input.jump, input.descend, input.sprint);
+            // Physics ran in the fixed ticks above; place the camera between the last two
+            player->updateCameraPosition(tickScheduler.getAlpha());
 
             // Update survival mechanics (fall damage, drowning, hunger, etc.)
             float armorReduction = playerInventory.getDamageReduction();
@@ -6708,9 +6787,6 @@ int main() {
             survivalHUD.update(deltaTime);
             inventoryUI.update(deltaTime);
 
-            // Update dropped items (physics, pickup)
-            droppedItems.update(deltaTime, world, player->position, playerInventory);
-
             // Update eating if right-click is held
             if (player->isEating && rightMousePressed) {
                 // Check if still holding food
@@ -6744,16 +6820,14 @@ int main() {
             }
         }
 
-        // Raycast to find target block
-        currentTarget = Raycast::cast(
-            camera.position,
-            camera.front,
-            REACH_DISTANCE,
-            [](int x, int y, int z) {
-                BlockType block = world.getBlock(x, y, z);
-                return isBlockSolid(block);
-            }
-        );
+        // Raycast to find target block. The reach fits inside the 3x3 chunks
+        // pinned around the camera, so the DDA never touches the chunk map
+        // and skips the empty sections it passes through.
+        WorldView targetView = WorldView::around(world, camera.position);
+        targetRays.clear();
+        targetRays.add(camera.position, camera.front, REACH_DISTANCE);
+        targetRays.cast(targetView, [](BlockType type) { return isBlockSolid(type); });
+        currentTarget = targetRays.getHit(0);
 
         // Update mining progress (survival mode block breaking)
         if (miningState.isMining && leftMousePressed && !inventoryUI.isOpen) {
@@ -6762,9 +6836,9 @@ int main() {
                              currentTarget->blockPos == miningState.targetBlock;
 
             // Check if block still exists and is the same type
-            BlockType currentBlock = world.getBlock(miningState.targetBlock.x,
-                                                     miningState.targetBlock.y,
-                                                     miningState.targetBlock.z);
+            BlockType currentBlock = targetView.getBlock(miningState.targetBlock.x,
+                                                         miningState.targetBlock.y,
+                                                         miningState.targetBlock.z);
 
             if (sameBlock && currentBlock == miningState.targetBlockType) {
                 // Continue mining
@@ -6792,11 +6866,26 @@ int main() {
                                                       static_cast<int>(heldToolCat),
                                                       static_cast<int>(heldToolTier));
 
-                    // Remove the block
-                    world.setBlock(miningState.targetBlock.x,
-                                  miningState.targetBlock.y,
-                                  miningState.targetBlock.z,
-                                  BlockType::AIR);
+                    // Remove the block, together with any cactus it was holding up.
+                    // The whole column goes in one batch: one relight and remesh.
+                    const glm::ivec3& minedPos = miningState.targetBlock;
+                    WorldEditBatch breakBatch;
+                    breakBatch.setBlock(minedPos.x, minedPos.y, minedPos.z, BlockType::AIR);
+                    int unsupportedTop = minedPos.y;
+                    while (unsupportedTop + 1 < CHUNK_SIZE_Y &&
+                           world.getBlock(minedPos.x, unsupportedTop + 1, minedPos.z) == BlockType::CACTUS) {
+                        ++unsupportedTop;
+                        breakBatch.setBlock(minedPos.x, unsupportedTop, minedPos.z, BlockType::AIR);
+                    }
+                    world.applyEdits(breakBatch);
+
+                    // Unsupported cactus drops regardless of the tool
+                    for (int y = minedPos.y + 1; y <= unsupportedTop; y++) {
+                        BlockDrop drop = getBlockDropNew(BlockType::CACTUS);
+                        if (drop.count > 0) {
+                            droppedItems.spawnBlockDrop(glm::vec3(minedPos.x, y, minedPos.z), drop);
+                        }
+                    }
 
                     // Only give drops if we can harvest (correct tool tier)
                     if (canHarvest) {
@@ -6842,9 +6931,9 @@ int main() {
 
                 // If looking at a new breakable block, start mining it
                 if (currentTarget.has_value()) {
-                    BlockType newBlock = world.getBlock(currentTarget->blockPos.x,
-                                                        currentTarget->blockPos.y,
-                                                        currentTarget->blockPos.z);
+                    BlockType newBlock = targetView.getBlock(currentTarget->blockPos.x,
+                                                             currentTarget->blockPos.y,
+                                                             currentTarget->blockPos.z);
                     if (isBlockBreakable(newBlock)) {
                         miningState.isMining = true;
                         miningState.targetBlock = currentTarget->blockPos;
@@ -8094,6 +8183,19 @@ int main() {
                 std::cout << "  Input:     " << std::setw(6) << g_perfStats.inputProcessMs << "ms" << std::endl;
                 std::cout << "  World:     " << std::setw(6) << g_perfStats.worldUpdateMs << "ms" << std::endl;
 
+                std::cout << "Simulation ticks: " << tickScheduler.getTickCount() << " run, "
+                          << tickScheduler.getDroppedTicks() << " dropped, "
+                          << tickScheduler.getOverBudgetTicks() << " over budget" << std::endl;
+                for (const auto& system : tickScheduler.getStats()) {
+                    std::cout << "  " << std::left << std::setw(14) << system.name << std::right
+                              << std::setw(6) << system.averageMs << "ms avg, "
+                              << std::setw(6) << system.peakMs << "ms peak";
+                    if (system.overBudgetRuns > 0) std::cout << " (" << system.overBudgetRuns << " over budget)";
+                    if (system.skippedRuns > 0) std::cout << " (" << system.skippedRuns << " skipped)";
+                    std::cout << std::endl;
+                }
+                tickScheduler.resetPeaks();
+
                 std::cout << "Chunks:" << std::endl;
                 if (g_enableSubChunkCulling) {
                     std::cout << "  Solid sub-chunks rendered: " << g_perfStats.subChunksRendered << std::endl;
@@ -272,6 +272,7 @@ int main() {
     // Load config
     g_config.load();
     g_config.renderer = RendererType::VULKAN;  // Force Vulkan backend
+    g_blockRegistry.loadFromFile("assets/blocks.cfg");
 
     // Disable OpenGL mesh operations for Vulkan backend
     world.useOpenGLMeshes = false;
@@ -421,6 +422,7 @@ int main() {
         worldSettings.seed = seed.empty() ? std::to_string(std::random_device{}()) : seed;
         worldSettings.computeSeed();
         world.setSeed(worldSettings.seedValue);
+        world.setCaveSampling(worldSettings.caveSampling);
 
         // Reset world state
         world.reset();
@@ -454,6 +456,12 @@ int main() {
                 world.setSeed(worldSettings.seedValue);
             }
 
+            // Worlds saved before the lattice mode have no key and keep per-voxel caves
+            worldSettings.caveSampling = meta.count("caveSampling")
+                ? static_cast<CaveSampling>(std::stoi(meta["caveSampling"]))
+                : CaveSampling::PER_VOXEL;
+            world.setCaveSampling(worldSettings.caveSampling);
+
             // Load player position if available
             glm::vec3 playerPos;
             float yaw = 0, pitch = 0;
@@ -684,7 +692,8 @@ int main() {
                         WorldSaveLoad::saveWorldMeta(worldPath, worldSettings.worldName,
                             static_cast<int>(worldSettings.seedValue),
                             static_cast<int>(worldSettings.generationType),
-                            worldSettings.maxYHeight);
+                            worldSettings.maxYHeight,
+                            static_cast<int>(worldSettings.caveSampling));
                         WorldSaveLoad::savePlayer(worldPath, camera.position, camera.yaw, camera.pitch, false);
 
                         // Return to main menu
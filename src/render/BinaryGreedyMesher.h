@@ -2,11 +2,13 @@
 
 #include "../world/Chunk.h"
 #include "../world/Block.h"
+#include "../world/VoxelPyramid.h"
 #include <cstdint>
 #include <vector>
 #include <array>
 #include <algorithm>
 #include <bit>
+#include <functional>
 
 // ============================================================================
 // BINARY GREEDY MESHING
@@ -22,22 +24,28 @@
 constexpr int BGM_CHUNK_SIZE = 32;  // We'll pad our 16x16 chunks to work with this
 constexpr int BGM_CHUNK_SIZE_PADDED = BGM_CHUNK_SIZE + 2;  // Include neighbor data
 
-// Compact quad vertex - 8 bytes per quad (not per vertex!)
+// Compact quad vertex - 12 bytes per quad (not per vertex!)
 // Position: x=5 bits (0-31), y=9 bits (0-511), z=5 bits (0-31)
 // Size: 6 bits each for width, height (1-64 range, stored as 0-63)
 // Normal: 3 bits (0-5 for ±X, ±Y, ±Z)
-// Texture: 12 bits for texture slot (0-4095)
+// Texture: 8 bits for texture slot (0-255, same range as PackedChunkVertex::texSlot)
 // AO: 8 bits packed (2 bits per corner)
+// Light: 24 bits packed (3 bits of smoothed block light + 3 bits of sky light per corner)
 struct BinaryQuad {
     // First 32 bits: position and size
     // [4:0] = x (5 bits), [13:5] = y (9 bits), [18:14] = z (5 bits),
     // [24:19] = width-1 (6 bits), [30:25] = height-1 (6 bits), [31] = unused
     uint32_t positionSize;
 
-    // Second 32 bits: normal, texture, AO, light
-    // [2:0] = normal index, [14:3] = texture slot, [22:15] = AO (2 bits × 4 corners), [30:23] = light
+    // Second 32 bits: normal, texture, AO
+    // [2:0] = normal index, [10:3] = texture slot, [18:11] = AO (2 bits × 4 corners),
+    // [31:19] = unused
     uint32_t attributes;
 
+    // Third 32 bits: smoothed light per corner
+    // [11:0] = block light (3 bits × 4 corners), [23:12] = sky light (3 bits × 4 corners)
+    uint32_t light;
+
     // Encode position and size - Y now supports 0-511 (enough for 256-tall chunks)
     static uint32_t encodePositionSize(int x, int y, int z, int w, int h) {
         return (x & 0x1F) |                    // 5 bits for x (0-31)
@@ -48,11 +56,10 @@ struct BinaryQuad {
     }
 
     // Encode attributes
-    static uint32_t encodeAttributes(int normalIdx, int texSlot, uint8_t ao, uint8_t light) {
+    static uint32_t encodeAttributes(int normalIdx, int texSlot, uint8_t ao) {
         return (normalIdx & 0x7) |
-               ((texSlot & 0xFFF) << 3) |
-               ((ao & 0xFF) << 15) |
-               ((light & 0xFF) << 23);
+               ((texSlot & 0xFF) << 3) |
+               ((ao & 0xFF) << 11);
     }
 
     // Decode helpers (for debugging or CPU-side operations)
@@ -62,9 +69,10 @@ struct BinaryQuad {
     int getWidth() const { return ((positionSize >> 19) & 0x3F) + 1; }
     int getHeight() const { return ((positionSize >> 25) & 0x3F) + 1; }
     int getNormal() const { return attributes & 0x7; }
-    int getTexSlot() const { return (attributes >> 3) & 0xFFF; }
-    uint8_t getAO() const { return (attributes >> 15) & 0xFF; }
-    uint8_t getLight() const { return (attributes >> 23) & 0xFF; }
+    int getTexSlot() const { return (attributes >> 3) & 0xFF; }
+    uint8_t getAO() const { return (attributes >> 11) & 0xFF; }
+    uint16_t getBlockLight() const { return light & 0xFFF; }
+    uint16_t getSkyLight() const { return (light >> 12) & 0xFFF; }
 };
 
 // Number of face orientation buckets (one per cardinal direction)
@@ -127,14 +135,20 @@ public:
     // Block data callback - returns block type at world position
     using BlockGetter = std::function<BlockType(int, int, int)>;
     using TextureGetter = std::function<int(BlockType, BGMFace)>;
+    // Light callback - returns packed block + sky light (see packLight) at world position
+    // Only queried for the one-block halo owned by neighbor chunks
+    using LightGetter = std::function<uint8_t(int, int, int)>;
 
     BinaryGreedyMesher() {
-        // Pre-allocate work buffers
-        m_solidMask.resize(CHUNK_SIZE_Y);
-        m_faceMask.resize(CHUNK_SIZE_Y);
-        for (auto& row : m_solidMask) {
-            row.fill(0);
-        }
+        // Pre-allocate work buffers for a full-height column so meshing never reallocates
+        m_opaque.resize(PAD_XZ * (CHUNK_SIZE_Y + 2), 0);
+        m_light.resize(PAD_XZ * PAD_XZ * (CHUNK_SIZE_Y + 2), 0);
+        m_filled.resize(CHUNK_SIZE_Z * CHUNK_SIZE_Y, 0);
+        m_blocks.resize(CHUNK_SIZE_X * CHUNK_SIZE_Z * CHUNK_SIZE_Y, BlockType::AIR);
+        m_visible.resize(CHUNK_SIZE_Z * CHUNK_SIZE_Y, 0);
+        m_rowMask.resize(CHUNK_SIZE_Y, 0);
+        m_texMask.resize(PLANE_WIDTH * CHUNK_SIZE_Y, 0);
+        m_shadeMask.resize(PLANE_WIDTH * CHUNK_SIZE_Y, 0);
     }
 
     // Generate mesh for a chunk using binary greedy meshing
@@ -144,16 +158,14 @@ public:
         const BlockGetter& getBlock,
         const TextureGetter& getTexture,
         BinaryMeshResult& result,
-        int baseX, int baseZ
+        int baseX, int baseZ,
+        const LightGetter& getLight = LightGetter()
     ) {
         result.clear();
         result.reserve(4096);  // Typical chunk has 1000-4000 quads
 
-        // Process each face direction
-        for (int face = 0; face < 6; face++) {
-            generateFace(chunk, getBlock, getTexture, result,
-                        static_cast<BGMFace>(face), baseX, baseZ);
-        }
+        meshRange(chunk, getBlock, getTexture, getLight, result, baseX, baseZ,
+                  chunk.chunkMinY, chunk.chunkMaxY);
     }
 
     // Generate mesh for a Y range (sub-chunk)
@@ -163,22 +175,74 @@ public:
         const TextureGetter& getTexture,
         BinaryMeshResult& result,
         int baseX, int baseZ,
-        int yStart, int yEnd
+        int yStart, int yEnd,
+        const LightGetter& getLight = LightGetter()
     ) {
         result.clear();
         result.reserve(1024);
 
-        for (int face = 0; face < 6; face++) {
-            generateFaceForYRange(chunk, getBlock, getTexture, result,
-                                 static_cast<BGMFace>(face), baseX, baseZ, yStart, yEnd);
-        }
+        meshRange(chunk, getBlock, getTexture, getLight, result, baseX, baseZ, yStart, yEnd);
+    }
+
+    // Generate mesh for one level of a chunk's voxel mip pyramid (LOD 1-3).
+    // yStart/yEnd are full-resolution block Y; quads come out in cell units, so expand
+    // them with the level's scale. Cells outside the column count as empty, which keeps
+    // border faces - they act as skirts against neighbors meshed at a different LOD.
+    void generateLODMeshForYRange(
+        const VoxelPyramid& pyramid,
+        int level,
+        const TextureGetter& getTexture,
+        BinaryMeshResult& result,
+        int yStart, int yEnd
+    ) {
+        result.clear();
+        result.reserve(256);
+
+        const VoxelPyramid::Level& lod = pyramid.getLevel(level);
+        int cellStart = std::max(yStart / lod.scale, lod.minY);
+        int cellEnd = std::min(yEnd / lod.scale, lod.maxY);
+        if (cellStart > cellEnd) return;
+
+        // LOD geometry carries AO but no block light; distant terrain is treated as sky-lit
+        buildVolume(lod.sizeXZ, lod.sizeY, cellStart, cellEnd,
+            [&lod](int x, int y, int z, BlockType& block, uint8_t& light) {
+                block = lod.get(x, y, z);
+                light = FULL_SKY_LIGHT;
+            });
+        meshAllFaces(getTexture, result);
     }
 
 private:
-    // Work buffers - reused across calls to avoid allocation
-    // Each row is CHUNK_SIZE_X bits (fits in uint32_t for 16-wide, uint64_t for 32-wide)
-    std::vector<std::array<uint64_t, CHUNK_SIZE_Z>> m_solidMask;
-    std::vector<std::array<uint64_t, CHUNK_SIZE_Z>> m_faceMask;
+    // Padded XZ extent: chunk columns plus a one-block halo on each side
+    static constexpr int PAD_XZ = CHUNK_SIZE_X + 2;
+    // Merge planes are always 16 bits wide (X for Y/Z faces, Z for X faces)
+    static constexpr int PLANE_WIDTH = CHUNK_SIZE_X;
+    static_assert(CHUNK_SIZE_X == CHUNK_SIZE_Z, "merge planes assume square chunk columns");
+    static_assert(PAD_XZ <= 32, "padded rows must fit in uint32_t");
+    // Width/height are stored as 6-bit (size-1) in BinaryQuad::positionSize
+    static constexpr int MAX_QUAD_EXTENT = 64;
+
+    // Padded occupancy volume - built once per call, shared by all six face directions.
+    // m_opaque[layer * PAD_XZ + pz] has bit px set when that cell occludes (AO + face culling).
+    // Layer l holds y = m_yStart - 1 + l, so the neighbor layers above/below are included.
+    std::vector<uint32_t> m_opaque;
+    // Packed block + sky light for every padded cell, indexed (layer * PAD_XZ + pz) * PAD_XZ + px
+    std::vector<uint8_t> m_light;
+    // Interior cells that emit faces (not air/water), m_filled[yRel * CHUNK_SIZE_Z + z] bit x
+    std::vector<uint32_t> m_filled;
+    // Per-face scratch: visible faces per (yRel, z) row, bit x
+    std::vector<uint32_t> m_visible;
+    // Interior block types, indexed (yRel * CHUNK_SIZE_Z + z) * CHUNK_SIZE_X + x
+    std::vector<BlockType> m_blocks;
+
+    // Merge plane scratch: one bit row per slice row, plus texture and corner shading per cell
+    std::vector<uint32_t> m_rowMask;
+    std::vector<int> m_texMask;
+    std::vector<uint32_t> m_shadeMask;  // [7:0] = AO (2 bits x 4), [19:8] = block light, [31:20] = sky light (3 bits x 4)
+
+    int m_size = CHUNK_SIZE_X;  // Interior cells per side (16 for chunks, less for LOD levels)
+    int m_yStart = 0;
+    int m_yRange = 0;
 
     // Helper: count trailing zeros (position of lowest set bit)
     static inline int ctz64(uint64_t x) {
@@ -235,424 +299,329 @@ private:
         #endif
     }
 
-    // Generate faces for one direction
-    void generateFace(
-        const Chunk& chunk,
-        const BlockGetter& getBlock,
-        const TextureGetter& getTexture,
-        BinaryMeshResult& result,
-        BGMFace face,
-        int baseX, int baseZ
-    ) {
-        generateFaceForYRange(chunk, getBlock, getTexture, result, face,
-                             baseX, baseZ, chunk.chunkMinY, chunk.chunkMaxY);
-    }
-
-    // Generate faces for one direction within a Y range
-    void generateFaceForYRange(
+    // Mesh all six face directions for a Y range
+    void meshRange(
         const Chunk& chunk,
         const BlockGetter& getBlock,
         const TextureGetter& getTexture,
+        const LightGetter& getLight,
         BinaryMeshResult& result,
-        BGMFace face,
         int baseX, int baseZ,
         int yStart, int yEnd
     ) {
-        if (yStart > yEnd) return;
-
         // Clamp to chunk bounds
         yStart = std::max(yStart, static_cast<int>(chunk.chunkMinY));
         yEnd = std::min(yEnd, static_cast<int>(chunk.chunkMaxY));
         if (yStart > yEnd) return;
 
-        // Get axis info based on face direction
-        int primaryAxis, secondaryAxis, tertiaryAxis;
-        int primaryDir;
-        getAxisInfo(face, primaryAxis, secondaryAxis, tertiaryAxis, primaryDir);
-
-        // Process slices perpendicular to the face normal
-        if (face == BGMFace::POS_Y || face == BGMFace::NEG_Y) {
-            // Y-facing: iterate Y, mask is XZ
-            processYFaces(chunk, getBlock, getTexture, result, face, baseX, baseZ, yStart, yEnd);
-        } else if (face == BGMFace::POS_Z || face == BGMFace::NEG_Z) {
-            // Z-facing: iterate Z, mask is XY
-            processZFaces(chunk, getBlock, getTexture, result, face, baseX, baseZ, yStart, yEnd);
-        } else {
-            // X-facing: iterate X, mask is YZ
-            processXFaces(chunk, getBlock, getTexture, result, face, baseX, baseZ, yStart, yEnd);
-        }
+        // OPTIMIZATION: Gather occupancy + light once. Face culling, AO and smooth light
+        // below are all bit tests against this volume instead of per-corner getBlock calls.
+        // Interior cells read the chunk directly; only the halo goes through the callbacks.
+        buildVolume(CHUNK_SIZE_X, CHUNK_SIZE_Y, yStart, yEnd,
+            [&](int x, int y, int z, BlockType& block, uint8_t& light) {
+                if (x >= 0 && x < CHUNK_SIZE_X && z >= 0 && z < CHUNK_SIZE_Z) {
+                    block = chunk.getBlock(x, y, z);
+                    light = chunk.getPackedLight(x, y, z);
+                } else {
+                    // Halo cell owned by a neighbor chunk
+                    block = getBlock(baseX + x, y, baseZ + z);
+                    light = getLight ? getLight(baseX + x, y, baseZ + z) : FULL_SKY_LIGHT;
+                }
+            });
+        meshAllFaces(getTexture, result);
     }
 
-    void getAxisInfo(BGMFace face, int& primary, int& secondary, int& tertiary, int& dir) {
-        switch (face) {
-            case BGMFace::POS_X: primary = 0; secondary = 1; tertiary = 2; dir = 1; break;
-            case BGMFace::NEG_X: primary = 0; secondary = 1; tertiary = 2; dir = -1; break;
-            case BGMFace::POS_Y: primary = 1; secondary = 0; tertiary = 2; dir = 1; break;
-            case BGMFace::NEG_Y: primary = 1; secondary = 0; tertiary = 2; dir = -1; break;
-            case BGMFace::POS_Z: primary = 2; secondary = 0; tertiary = 1; dir = 1; break;
-            case BGMFace::NEG_Z: primary = 2; secondary = 0; tertiary = 1; dir = -1; break;
+    void meshAllFaces(const TextureGetter& getTexture, BinaryMeshResult& result) {
+        for (int face = 0; face < 6; face++) {
+            BGMFace f = static_cast<BGMFace>(face);
+            if (f == BGMFace::POS_Y || f == BGMFace::NEG_Y) {
+                // Y-facing: iterate Y, mask is XZ
+                processYFaces(getTexture, result, f);
+            } else if (f == BGMFace::POS_Z || f == BGMFace::NEG_Z) {
+                // Z-facing: iterate Z, mask is XY
+                processZFaces(getTexture, result, f);
+            } else {
+                // X-facing: iterate X, mask is YZ
+                processXFaces(getTexture, result, f);
+            }
         }
     }
 
-    // Process Y-facing faces (TOP and BOTTOM)
-    void processYFaces(
-        const Chunk& chunk,
-        const BlockGetter& getBlock,
-        const TextureGetter& getTexture,
-        BinaryMeshResult& result,
-        BGMFace face,
-        int baseX, int baseZ,
-        int yStart, int yEnd
-    ) {
-        int yOffset = (face == BGMFace::POS_Y) ? 1 : -1;
-
-        for (int y = yStart; y <= yEnd; y++) {
-            // Build binary mask for this Y slice
-            // Each bit represents whether a face should be rendered at (x, z)
-            std::array<uint32_t, CHUNK_SIZE_Z> faceMask;
-            std::array<int, CHUNK_SIZE_X * CHUNK_SIZE_Z> textureMask;
-            std::array<uint8_t, CHUNK_SIZE_X * CHUNK_SIZE_Z> aoMask;  // Pre-computed AO for each face
-            faceMask.fill(0);
-            std::fill(textureMask.begin(), textureMask.end(), -1);
-            aoMask.fill(0);
-
-            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                uint32_t rowMask = 0;
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    BlockType block = chunk.getBlock(x, y, z);
-                    if (block == BlockType::AIR || block == BlockType::WATER) continue;
-
-                    // Check if neighbor is transparent
-                    int ny = y + yOffset;
-                    BlockType neighbor = getBlock(baseX + x, ny, baseZ + z);
-                    if (!isBlockOpaque(neighbor)) {
-                        rowMask |= (1u << x);
-                        textureMask[z * CHUNK_SIZE_X + x] = getTexture(block, face);
-                        // Pre-compute AO for this 1x1 face (used for merge constraint)
-                        aoMask[z * CHUNK_SIZE_X + x] = calculateAOSingle(getBlock, baseX + x, y, baseZ + z, face);
-                    }
-                }
-                faceMask[z] = rowMask;
+    // Build the padded opaque bitmask + light volume for [yStart-1, yEnd+1].
+    // sample(x, y, z, block, light) is called for every cell with x/z in [-1, sizeXZ],
+    // so the caller decides where interior and halo data come from.
+    template <typename Sampler>
+    void buildVolume(int sizeXZ, int sizeY, int yStart, int yEnd, Sampler sample) {
+        m_size = sizeXZ;
+        m_yStart = yStart;
+        m_yRange = yEnd - yStart + 1;
+        int layers = m_yRange + 2;
+        int padded = sizeXZ + 2;
+
+        for (int l = 0; l < layers; l++) {
+            int y = yStart - 1 + l;
+            uint32_t* opaqueRows = &m_opaque[l * PAD_XZ];
+            uint8_t* lightLayer = &m_light[l * PAD_XZ * PAD_XZ];
+
+            if (y < 0 || y >= sizeY) {
+                // Outside the world: nothing occludes, no block light, open sky above
+                std::fill(opaqueRows, opaqueRows + PAD_XZ, 0u);
+                std::fill(lightLayer, lightLayer + PAD_XZ * PAD_XZ, y < 0 ? static_cast<uint8_t>(0) : FULL_SKY_LIGHT);
+                continue;
             }
 
-            // Greedy merge the mask (with AO constraint)
-            greedyMergeXZ(result, faceMask, textureMask, aoMask, face, y, chunk, baseX, baseZ, getBlock);
-        }
-    }
-
-    // Process Z-facing faces (FRONT and BACK)
-    void processZFaces(
-        const Chunk& chunk,
-        const BlockGetter& getBlock,
-        const TextureGetter& getTexture,
-        BinaryMeshResult& result,
-        BGMFace face,
-        int baseX, int baseZ,
-        int yStart, int yEnd
-    ) {
-        int zOffset = (face == BGMFace::POS_Z) ? 1 : -1;
-
-        for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-            // Build binary mask for this Z slice
-            int yRange = yEnd - yStart + 1;
-            std::vector<uint32_t> faceMask(yRange, 0);
-            std::vector<int> textureMask(CHUNK_SIZE_X * yRange, -1);
-            std::vector<uint8_t> aoMask(CHUNK_SIZE_X * yRange, 0);  // Pre-computed AO
-
-            for (int yRel = 0; yRel < yRange; yRel++) {
-                int y = yStart + yRel;
-                uint32_t rowMask = 0;
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    BlockType block = chunk.getBlock(x, y, z);
-                    if (block == BlockType::AIR || block == BlockType::WATER) continue;
-
-                    int nz = baseZ + z + zOffset;
-                    BlockType neighbor = getBlock(baseX + x, y, nz);
-                    if (!isBlockOpaque(neighbor)) {
-                        rowMask |= (1u << x);
-                        textureMask[yRel * CHUNK_SIZE_X + x] = getTexture(block, face);
-                        aoMask[yRel * CHUNK_SIZE_X + x] = calculateAOSingle(getBlock, baseX + x, y, baseZ + z, face);
+            bool interiorLayer = (y >= yStart && y <= yEnd);
+            for (int pz = 0; pz < padded; pz++) {
+                int z = pz - 1;
+                bool zInside = (z >= 0 && z < sizeXZ);
+                uint32_t opaqueRow = 0;
+                uint32_t filledRow = 0;
+
+                for (int px = 0; px < padded; px++) {
+                    int x = px - 1;
+                    BlockType block;
+                    uint8_t light;
+                    sample(x, y, z, block, light);
+
+                    if (isBlockOpaque(block)) opaqueRow |= (1u << px);
+                    lightLayer[pz * PAD_XZ + px] = light;
+
+                    if (interiorLayer && zInside && x >= 0 && x < sizeXZ) {
+                        m_blocks[((y - yStart) * CHUNK_SIZE_Z + z) * CHUNK_SIZE_X + x] = block;
+                        if (block != BlockType::AIR && block != BlockType::WATER) {
+                            filledRow |= (1u << x);
+                        }
                     }
                 }
-                faceMask[yRel] = rowMask;
-            }
-
-            // Greedy merge the mask (with AO constraint)
-            greedyMergeXY(result, faceMask, textureMask, aoMask, face, z, yStart, chunk, baseX, baseZ, getBlock);
-        }
-    }
 
-    // Process X-facing faces (LEFT and RIGHT)
-    void processXFaces(
-        const Chunk& chunk,
-        const BlockGetter& getBlock,
-        const TextureGetter& getTexture,
-        BinaryMeshResult& result,
-        BGMFace face,
-        int baseX, int baseZ,
-        int yStart, int yEnd
-    ) {
-        int xOffset = (face == BGMFace::POS_X) ? 1 : -1;
-
-        for (int x = 0; x < CHUNK_SIZE_X; x++) {
-            // Build binary mask for this X slice
-            int yRange = yEnd - yStart + 1;
-            std::vector<uint32_t> faceMask(yRange, 0);
-            std::vector<int> textureMask(CHUNK_SIZE_Z * yRange, -1);
-            std::vector<uint8_t> aoMask(CHUNK_SIZE_Z * yRange, 0);  // Pre-computed AO
-
-            for (int yRel = 0; yRel < yRange; yRel++) {
-                int y = yStart + yRel;
-                uint32_t rowMask = 0;
-                for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                    BlockType block = chunk.getBlock(x, y, z);
-                    if (block == BlockType::AIR || block == BlockType::WATER) continue;
-
-                    int nx = baseX + x + xOffset;
-                    BlockType neighbor = getBlock(nx, y, baseZ + z);
-                    if (!isBlockOpaque(neighbor)) {
-                        rowMask |= (1u << z);
-                        textureMask[yRel * CHUNK_SIZE_Z + z] = getTexture(block, face);
-                        aoMask[yRel * CHUNK_SIZE_Z + z] = calculateAOSingle(getBlock, baseX + x, y, baseZ + z, face);
-                    }
+                opaqueRows[pz] = opaqueRow;
+                if (interiorLayer && zInside) {
+                    m_filled[(y - yStart) * CHUNK_SIZE_Z + z] = filledRow;
                 }
-                faceMask[yRel] = rowMask;
             }
-
-            // Greedy merge the mask (with AO constraint)
-            greedyMergeZY(result, faceMask, textureMask, aoMask, face, x, yStart, chunk, baseX, baseZ, getBlock);
         }
     }
 
-    // Binary greedy merge for XZ plane (Y-facing faces)
-    // With AO constraint: only merge faces with identical AO values
-    void greedyMergeXZ(
-        BinaryMeshResult& result,
-        std::array<uint32_t, CHUNK_SIZE_Z>& faceMask,
-        std::array<int, CHUNK_SIZE_X * CHUNK_SIZE_Z>& textureMask,
-        std::array<uint8_t, CHUNK_SIZE_X * CHUNK_SIZE_Z>& aoMask,  // Pre-computed AO per face
-        BGMFace face,
-        int y,
-        const Chunk& chunk,
-        int baseX, int baseZ,
-        const BlockGetter& getBlock
-    ) {
-        // chunk, baseX, baseZ, getBlock needed for calculateAO on merged quads
-
-        for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-            uint32_t row = faceMask[z];
-            while (row != 0) {
-                // Find first set bit (start of run)
-                int x = ctz64(row);
-                if (x >= CHUNK_SIZE_X) break;
+    BlockType blockAt(int x, int yRel, int z) const {
+        return m_blocks[(yRel * CHUNK_SIZE_Z + z) * CHUNK_SIZE_X + x];
+    }
 
-                int texSlot = textureMask[z * CHUNK_SIZE_X + x];
-                if (texSlot < 0) {
-                    row &= ~(1u << x);
-                    continue;
-                }
+    // Padded-volume accessors (px/pz in 0..m_size+1, l = y - m_yStart + 1)
+    bool opaqueAt(int px, int l, int pz) const {
+        return (m_opaque[l * PAD_XZ + pz] >> px) & 1u;
+    }
 
-                uint8_t baseAO = aoMask[z * CHUNK_SIZE_X + x];
+    // Packed block + sky light
+    int lightAt(int px, int l, int pz) const {
+        return m_light[(l * PAD_XZ + pz) * PAD_XZ + px];
+    }
 
-                // Find width: count consecutive bits with same texture AND same AO
-                int width = 1;
-                uint32_t runMask = 1u << x;
-                while (x + width < CHUNK_SIZE_X) {
-                    if (!(row & (1u << (x + width)))) break;
-                    if (textureMask[z * CHUNK_SIZE_X + x + width] != texSlot) break;
-                    if (aoMask[z * CHUNK_SIZE_X + x + width] != baseAO) break;  // AO constraint
-                    runMask |= (1u << (x + width));
-                    width++;
-                }
+    // Opaque bits of the interior columns of a padded row, offset by dx (-1, 0, +1) in X
+    uint32_t opaqueInterior(int l, int pz, int dx) const {
+        return (m_opaque[l * PAD_XZ + pz] >> (1 + dx)) & ((1u << m_size) - 1u);
+    }
 
-                // Find height: check subsequent rows with same texture AND same AO
-                int height = 1;
-                while (z + height < CHUNK_SIZE_Z) {
-                    uint32_t nextRow = faceMask[z + height];
-                    // Check if all bits in our run are set in next row
-                    if ((nextRow & runMask) != runMask) break;
-                    bool canMerge = true;
-                    for (int dx = 0; dx < width; dx++) {
-                        int idx = (z + height) * CHUNK_SIZE_X + x + dx;
-                        if (textureMask[idx] != texSlot) {
-                            canMerge = false;
-                            break;
-                        }
-                        if (aoMask[idx] != baseAO) {  // AO constraint
-                            canMerge = false;
-                            break;
-                        }
-                    }
-                    if (!canMerge) break;
-                    height++;
-                }
+    // Calculate AO value for a single corner (0-3, where 3 = fully lit)
+    int cornerAO(bool side1, bool side2, bool corner) const {
+        if (side1 && side2) return 0;  // Fully occluded by two adjacent blocks
+        return 3 - (side1 ? 1 : 0) - (side2 ? 1 : 0) - (corner ? 1 : 0);
+    }
 
-                // Clear the merged region from all masks
-                for (int dz = 0; dz < height; dz++) {
-                    faceMask[z + dz] &= ~runMask;
-                    for (int dx = 0; dx < width; dx++) {
-                        textureMask[(z + dz) * CHUNK_SIZE_X + x + dx] = -1;
-                    }
-                }
+    // Per-corner AO and smooth light for a 1x1 face.
+    // (px, l, pz) is the padded cell in front of the face (the air the face looks into).
+    // Corner order matches the vertex order in expandSingleBucketToVertices, so a merged
+    // quad whose cells all share one shade value can reuse it for its own four corners.
+    // Returns [7:0] = AO (2 bits per corner), [19:8] = block light, [31:20] = sky light
+    // (3 bits per corner each)
+    uint32_t faceShade(BGMFace face, int px, int l, int pz) const {
+        // Corner positions along the face tangents (u, v): 0 = low edge, 1 = high edge
+        static constexpr int8_t CORNER_UV[6][4][2] = {
+            {{1, 0}, {0, 0}, {0, 1}, {1, 1}},  // +X (u = Z, v = Y)
+            {{0, 0}, {1, 0}, {1, 1}, {0, 1}},  // -X (u = Z, v = Y)
+            {{0, 1}, {1, 1}, {1, 0}, {0, 0}},  // +Y (u = X, v = Z)
+            {{0, 0}, {1, 0}, {1, 1}, {0, 1}},  // -Y (u = X, v = Z)
+            {{0, 0}, {1, 0}, {1, 1}, {0, 1}},  // +Z (u = X, v = Y)
+            {{1, 0}, {0, 0}, {0, 1}, {1, 1}}   // -Z (u = X, v = Y)
+        };
+        // Tangent axes as (dx, dy, dz) steps in the padded volume
+        static constexpr int8_t AXIS_U[6][3] = {
+            {0, 0, 1}, {0, 0, 1}, {1, 0, 0}, {1, 0, 0}, {1, 0, 0}, {1, 0, 0}
+        };
+        static constexpr int8_t AXIS_V[6][3] = {
+            {0, 1, 0}, {0, 1, 0}, {0, 0, 1}, {0, 0, 1}, {0, 1, 0}, {0, 1, 0}
+        };
 
-                // Calculate AO at the merged quad's actual corner positions
-                // baseAO constraint ensures interior uniformity, but corners need edge checks
-                uint8_t ao = calculateAO(chunk, getBlock, baseX, baseZ, x, y, z, width, height, face);
-                uint8_t light = 255;  // Full brightness (lighting handled by sun/ambient)
+        int f = static_cast<int>(face);
+        int baseLight = lightAt(px, l, pz);
+        uint32_t ao = 0;
+        uint32_t light = 0;
+        uint32_t sky = 0;
+
+        for (int c = 0; c < 4; c++) {
+            int su = CORNER_UV[f][c][0] ? 1 : -1;
+            int sv = CORNER_UV[f][c][1] ? 1 : -1;
+            int ux = px + AXIS_U[f][0] * su, uy = l + AXIS_U[f][1] * su, uz = pz + AXIS_U[f][2] * su;
+            int vx = px + AXIS_V[f][0] * sv, vy = l + AXIS_V[f][1] * sv, vz = pz + AXIS_V[f][2] * sv;
+            int cx = ux + vx - px, cy = uy + vy - l, cz = uz + vz - pz;
+
+            // 0fps AO: two sides and the diagonal sharing this vertex
+            bool side1 = opaqueAt(ux, uy, uz);
+            bool side2 = opaqueAt(vx, vy, vz);
+            bool corner = opaqueAt(cx, cy, cz);
+            ao |= static_cast<uint32_t>(cornerAO(side1, side2, corner)) << (c * 2);
+
+            // Smooth light: average the non-opaque cells touching this vertex
+            // (the diagonal only counts when light can actually reach it)
+            // Both nibbles are summed at once: 4 samples of 15 stay below the 8-bit lane
+            int sum = (baseLight & BLOCK_LIGHT_MASK) | ((baseLight >> SKY_LIGHT_SHIFT) << 8);
+            int count = 1;
+            auto addSample = [&sum](int packed) {
+                sum += (packed & BLOCK_LIGHT_MASK) | ((packed >> SKY_LIGHT_SHIFT) << 8);
+            };
+            if (!side1) { addSample(lightAt(ux, uy, uz)); count++; }
+            if (!side2) { addSample(lightAt(vx, vy, vz)); count++; }
+            if (!corner && !(side1 && side2)) { addSample(lightAt(cx, cy, cz)); count++; }
+
+            // Quantize the 0-15 averages to 0-7 with rounding
+            int blockSum = sum & 0xFF;
+            int skySum = sum >> 8;
+            uint32_t qBlock = static_cast<uint32_t>((blockSum * 14 + count * 15) / (count * 30));
+            uint32_t qSky = static_cast<uint32_t>((skySum * 14 + count * 15) / (count * 30));
+            light |= qBlock << (c * 3);
+            sky |= qSky << (c * 3);
+        }
 
-                // Emit quad
-                BinaryQuad quad;
-                quad.positionSize = BinaryQuad::encodePositionSize(x, y, z, width, height);
-                quad.attributes = BinaryQuad::encodeAttributes(static_cast<int>(face), texSlot, ao, light);
-                result.addQuad(quad);
+        return ao | (light << 8) | (sky << 20);
+    }
 
-                // Update row for next iteration
-                row = faceMask[z];
+    // Process Y-facing faces (TOP and BOTTOM)
+    void processYFaces(const TextureGetter& getTexture, BinaryMeshResult& result, BGMFace face) {
+        int dy = (face == BGMFace::POS_Y) ? 1 : -1;
+
+        for (int yRel = 0; yRel < m_yRange; yRel++) {
+            int y = m_yStart + yRel;
+            int nl = yRel + 1 + dy;  // Padded layer the faces look into
+
+            // Visible faces: filled cells whose neighbor above/below is not opaque
+            for (int z = 0; z < m_size; z++) {
+                uint32_t row = m_filled[yRel * CHUNK_SIZE_Z + z] & ~opaqueInterior(nl, z + 1, 0);
+                m_rowMask[z] = row;
+                while (row != 0) {
+                    int x = ctz64(row);
+                    row &= row - 1;
+                    int idx = z * PLANE_WIDTH + x;
+                    m_texMask[idx] = getTexture(blockAt(x, yRel, z), face);
+                    m_shadeMask[idx] = faceShade(face, x + 1, nl, z + 1);
+                }
             }
+
+            // Rows are Z, bits are X
+            greedyMergePlane(result, face, m_size, [y](int col, int row, int w, int h) {
+                return BinaryQuad::encodePositionSize(col, y, row, w, h);
+            });
         }
     }
 
-    // Binary greedy merge for XY plane (Z-facing faces)
-    // With AO constraint: only merge faces with identical AO values
-    void greedyMergeXY(
-        BinaryMeshResult& result,
-        std::vector<uint32_t>& faceMask,
-        std::vector<int>& textureMask,
-        std::vector<uint8_t>& aoMask,  // Pre-computed AO per face
-        BGMFace face,
-        int z,
-        int yStart,
-        const Chunk& chunk,
-        int baseX, int baseZ,
-        const BlockGetter& getBlock
-    ) {
-        // chunk, baseX, baseZ, getBlock needed for calculateAO on merged quads
-        int yRange = static_cast<int>(faceMask.size());
-
-        for (int yRel = 0; yRel < yRange; yRel++) {
-            uint32_t row = faceMask[yRel];
-            while (row != 0) {
-                int x = ctz64(row);
-                if (x >= CHUNK_SIZE_X) break;
-
-                int texSlot = textureMask[yRel * CHUNK_SIZE_X + x];
-                if (texSlot < 0) {
-                    row &= ~(1u << x);
-                    continue;
+    // Process Z-facing faces (FRONT and BACK)
+    void processZFaces(const TextureGetter& getTexture, BinaryMeshResult& result, BGMFace face) {
+        int dz = (face == BGMFace::POS_Z) ? 1 : -1;
+        int yStart = m_yStart;
+
+        for (int z = 0; z < m_size; z++) {
+            int npz = z + 1 + dz;  // Padded Z the faces look into
+
+            for (int yRel = 0; yRel < m_yRange; yRel++) {
+                int l = yRel + 1;
+                uint32_t row = m_filled[yRel * CHUNK_SIZE_Z + z] & ~opaqueInterior(l, npz, 0);
+                m_rowMask[yRel] = row;
+                while (row != 0) {
+                    int x = ctz64(row);
+                    row &= row - 1;
+                    int idx = yRel * PLANE_WIDTH + x;
+                    m_texMask[idx] = getTexture(blockAt(x, yRel, z), face);
+                    m_shadeMask[idx] = faceShade(face, x + 1, l, npz);
                 }
+            }
 
-                uint8_t baseAO = aoMask[yRel * CHUNK_SIZE_X + x];
+            // Rows are Y, bits are X
+            greedyMergePlane(result, face, m_yRange, [z, yStart](int col, int row, int w, int h) {
+                return BinaryQuad::encodePositionSize(col, yStart + row, z, w, h);
+            });
+        }
+    }
 
-                // Find width with AO constraint
-                int width = 1;
-                uint32_t runMask = 1u << x;
-                while (x + width < CHUNK_SIZE_X) {
-                    if (!(row & (1u << (x + width)))) break;
-                    if (textureMask[yRel * CHUNK_SIZE_X + x + width] != texSlot) break;
-                    if (aoMask[yRel * CHUNK_SIZE_X + x + width] != baseAO) break;  // AO constraint
-                    runMask |= (1u << (x + width));
-                    width++;
-                }
+    // Process X-facing faces (LEFT and RIGHT)
+    void processXFaces(const TextureGetter& getTexture, BinaryMeshResult& result, BGMFace face) {
+        int dx = (face == BGMFace::POS_X) ? 1 : -1;
+        int yStart = m_yStart;
+
+        // Visibility for every (y, z) row at once: shift the opaque row by one in X
+        for (int yRel = 0; yRel < m_yRange; yRel++) {
+            for (int z = 0; z < m_size; z++) {
+                int i = yRel * CHUNK_SIZE_Z + z;
+                m_visible[i] = m_filled[i] & ~opaqueInterior(yRel + 1, z + 1, dx);
+            }
+        }
 
-                // Find height (in Y direction) with AO constraint
-                int height = 1;
-                while (yRel + height < yRange) {
-                    uint32_t nextRow = faceMask[yRel + height];
-                    if ((nextRow & runMask) != runMask) break;
-                    bool canMerge = true;
-                    for (int dx = 0; dx < width; dx++) {
-                        int idx = (yRel + height) * CHUNK_SIZE_X + x + dx;
-                        if (textureMask[idx] != texSlot) {
-                            canMerge = false;
-                            break;
-                        }
-                        if (aoMask[idx] != baseAO) {  // AO constraint
-                            canMerge = false;
-                            break;
-                        }
-                    }
-                    if (!canMerge) break;
-                    height++;
+        for (int x = 0; x < m_size; x++) {
+            // Transpose this X slice into rows of Z bits
+            for (int yRel = 0; yRel < m_yRange; yRel++) {
+                uint32_t row = 0;
+                for (int z = 0; z < m_size; z++) {
+                    row |= ((m_visible[yRel * CHUNK_SIZE_Z + z] >> x) & 1u) << z;
                 }
-
-                // Clear merged region
-                for (int dy = 0; dy < height; dy++) {
-                    faceMask[yRel + dy] &= ~runMask;
-                    for (int dx = 0; dx < width; dx++) {
-                        textureMask[(yRel + dy) * CHUNK_SIZE_X + x + dx] = -1;
-                    }
+                m_rowMask[yRel] = row;
+                while (row != 0) {
+                    int z = ctz64(row);
+                    row &= row - 1;
+                    int idx = yRel * PLANE_WIDTH + z;
+                    m_texMask[idx] = getTexture(blockAt(x, yRel, z), face);
+                    m_shadeMask[idx] = faceShade(face, x + 1 + dx, yRel + 1, z + 1);
                 }
-
-                int y = yStart + yRel;
-                // Calculate AO at the merged quad's actual corner positions
-                uint8_t ao = calculateAO(chunk, getBlock, baseX, baseZ, x, y, z, width, height, face);
-                uint8_t light = 255;  // Full brightness
-
-                BinaryQuad quad;
-                quad.positionSize = BinaryQuad::encodePositionSize(x, y, z, width, height);
-                quad.attributes = BinaryQuad::encodeAttributes(static_cast<int>(face), texSlot, ao, light);
-                result.addQuad(quad);
-
-                row = faceMask[yRel];
             }
+
+            // Rows are Y, bits are Z - size is (width in Z, height in Y)
+            greedyMergePlane(result, face, m_yRange, [x, yStart](int col, int row, int w, int h) {
+                return BinaryQuad::encodePositionSize(x, yStart + row, col, w, h);
+            });
         }
     }
 
-    // Binary greedy merge for ZY plane (X-facing faces)
-    // With AO constraint: only merge faces with identical AO values
-    void greedyMergeZY(
-        BinaryMeshResult& result,
-        std::vector<uint32_t>& faceMask,
-        std::vector<int>& textureMask,
-        std::vector<uint8_t>& aoMask,  // Pre-computed AO per face
-        BGMFace face,
-        int x,
-        int yStart,
-        const Chunk& chunk,
-        int baseX, int baseZ,
-        const BlockGetter& getBlock
-    ) {
-        // chunk, baseX, baseZ, getBlock needed for calculateAO on merged quads
-        int yRange = static_cast<int>(faceMask.size());
-
-        for (int yRel = 0; yRel < yRange; yRel++) {
-            uint32_t row = faceMask[yRel];
-            while (row != 0) {
-                int z = ctz64(row);
-                if (z >= CHUNK_SIZE_Z) break;
-
-                int texSlot = textureMask[yRel * CHUNK_SIZE_Z + z];
-                if (texSlot < 0) {
-                    row &= ~(1u << z);
-                    continue;
-                }
-
-                uint8_t baseAO = aoMask[yRel * CHUNK_SIZE_Z + z];
+    // Binary greedy merge over m_rowMask/m_texMask/m_shadeMask.
+    // Only joins faces with the same texture AND identical corner AO + light, so the
+    // merged quad's four corners carry exactly the shade of its constituent faces.
+    template <typename EncodePosition>
+    void greedyMergePlane(BinaryMeshResult& result, BGMFace face, int rowCount,
+                          EncodePosition encodePosition) {
+        for (int row = 0; row < rowCount; row++) {
+            uint32_t bits = m_rowMask[row];
+            while (bits != 0) {
+                // Find first set bit (start of run)
+                int col = ctz64(bits);
+                int idx = row * PLANE_WIDTH + col;
+                int texSlot = m_texMask[idx];
+                uint32_t shade = m_shadeMask[idx];
 
-                // Find width (in Z direction) with AO constraint
+                // Find width: consecutive bits with same texture AND same shade
                 int width = 1;
-                uint32_t runMask = 1u << z;
-                while (z + width < CHUNK_SIZE_Z) {
-                    if (!(row & (1u << (z + width)))) break;
-                    if (textureMask[yRel * CHUNK_SIZE_Z + z + width] != texSlot) break;
-                    if (aoMask[yRel * CHUNK_SIZE_Z + z + width] != baseAO) break;  // AO constraint
-                    runMask |= (1u << (z + width));
+                uint32_t runMask = 1u << col;
+                while (col + width < m_size) {
+                    uint32_t bit = 1u << (col + width);
+                    if (!(bits & bit)) break;
+                    if (m_texMask[idx + width] != texSlot) break;
+                    if (m_shadeMask[idx + width] != shade) break;
+                    runMask |= bit;
                     width++;
                 }
 
-                // Find height (in Y direction) with AO constraint
+                // Find height: subsequent rows covering the run with same texture AND shade
                 int height = 1;
-                while (yRel + height < yRange) {
-                    uint32_t nextRow = faceMask[yRel + height];
-                    if ((nextRow & runMask) != runMask) break;
+                while (row + height < rowCount && height < MAX_QUAD_EXTENT) {
+                    if ((m_rowMask[row + height] & runMask) != runMask) break;
+                    int rowIdx = (row + height) * PLANE_WIDTH + col;
                     bool canMerge = true;
-                    for (int dz = 0; dz < width; dz++) {
-                        int idx = (yRel + height) * CHUNK_SIZE_Z + z + dz;
-                        if (textureMask[idx] != texSlot) {
-                            canMerge = false;
-                            break;
-                        }
-                        if (aoMask[idx] != baseAO) {  // AO constraint
+                    for (int d = 0; d < width; d++) {
+                        if (m_texMask[rowIdx + d] != texSlot || m_shadeMask[rowIdx + d] != shade) {
                             canMerge = false;
                             break;
                         }
@@ -661,561 +630,52 @@ private:
                     height++;
                 }
 
-                // Clear merged region
-                for (int dy = 0; dy < height; dy++) {
-                    faceMask[yRel + dy] &= ~runMask;
-                    for (int dz = 0; dz < width; dz++) {
-                        textureMask[(yRel + dy) * CHUNK_SIZE_Z + z + dz] = -1;
-                    }
+                // Clear the merged region
+                for (int d = 0; d < height; d++) {
+                    m_rowMask[row + d] &= ~runMask;
                 }
-
-                int y = yStart + yRel;
-                // Calculate AO at the merged quad's actual corner positions
-                uint8_t ao = calculateAO(chunk, getBlock, baseX, baseZ, x, y, z, width, height, face);
-                uint8_t light = 255;  // Full brightness
+                bits = m_rowMask[row];
 
                 BinaryQuad quad;
-                // For X-facing, position is (x, y, z), size is (width in Z, height in Y)
-                quad.positionSize = BinaryQuad::encodePositionSize(x, y, z, width, height);
-                quad.attributes = BinaryQuad::encodeAttributes(static_cast<int>(face), texSlot, ao, light);
+                quad.positionSize = encodePosition(col, row, width, height);
+                quad.attributes = BinaryQuad::encodeAttributes(static_cast<int>(face), texSlot,
+                                                               static_cast<uint8_t>(shade & 0xFF));
+                quad.light = shade >> 8;
                 result.addQuad(quad);
-
-                row = faceMask[yRel];
             }
         }
     }
 
-    // Check if position has solid block for AO calculation
-    bool isSolidForAO(const BlockGetter& getBlock, int x, int y, int z) const {
-        if (y < 0 || y >= CHUNK_SIZE_Y) return false;
-        BlockType block = getBlock(x, y, z);
-        return isBlockOpaque(block);
-    }
-
-    // Calculate AO value for a single corner (0-3, where 3 = fully lit)
-    int cornerAO(bool side1, bool side2, bool corner) const {
-        if (side1 && side2) return 0;  // Fully occluded by two adjacent blocks
-        return 3 - (side1 ? 1 : 0) - (side2 ? 1 : 0) - (corner ? 1 : 0);
-    }
-
-    // Calculate AO for a single 1x1 block face (used for greedy merge constraints)
-    // Returns packed AO: 2 bits per corner (corners 0,1,2,3 in bits 0-1, 2-3, 4-5, 6-7)
-    // For each corner, we check the 3 blocks that share the corner vertex and are outside the face
-    uint8_t calculateAOSingle(
-        const BlockGetter& getBlock,
-        int wx, int y, int wz,  // World coordinates of the block
-        BGMFace face
-    ) {
-        int ao0 = 3, ao1 = 3, ao2 = 3, ao3 = 3;
-
-        switch (face) {
-            case BGMFace::POS_Y: {
-                // Top face at y+1 - check blocks at level y+1 around each corner vertex
-                int fy = y + 1;
-                // Corner 0 at vertex (wx, fy, wz): check blocks at (-1,0), (0,-1), (-1,-1)
-                ao0 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz-1),
-                              isSolidForAO(getBlock, wx-1, fy, wz-1));
-                // Corner 1 at vertex (wx+1, fy, wz): check blocks at (+1,0), (0,-1), (+1,-1)
-                ao1 = cornerAO(isSolidForAO(getBlock, wx+1, fy, wz),
-                              isSolidForAO(getBlock, wx+1, fy, wz-1),
-                              isSolidForAO(getBlock, wx, fy, wz-1));
-                // Corner 2 at vertex (wx+1, fy, wz+1): check blocks at (+1,0), (0,+1), (+1,+1)
-                ao2 = cornerAO(isSolidForAO(getBlock, wx+1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz+1),
-                              isSolidForAO(getBlock, wx+1, fy, wz+1));
-                // Corner 3 at vertex (wx, fy, wz+1): check blocks at (-1,0), (0,+1), (-1,+1)
-                ao3 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz+1),
-                              isSolidForAO(getBlock, wx-1, fy, wz+1));
-                break;
-            }
-            case BGMFace::NEG_Y: {
-                // Bottom face at y-1
-                int fy = y - 1;
-                ao0 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz-1),
-                              isSolidForAO(getBlock, wx-1, fy, wz-1));
-                ao1 = cornerAO(isSolidForAO(getBlock, wx+1, fy, wz),
-                              isSolidForAO(getBlock, wx+1, fy, wz-1),
-                              isSolidForAO(getBlock, wx, fy, wz-1));
-                ao2 = cornerAO(isSolidForAO(getBlock, wx+1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz+1),
-                              isSolidForAO(getBlock, wx+1, fy, wz+1));
-                ao3 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz+1),
-                              isSolidForAO(getBlock, wx-1, fy, wz+1));
-                break;
-            }
-            case BGMFace::POS_Z: {
-                // Front face at z+1 - check blocks at level z+1
-                int fz = wz + 1;
-                // Corner 0 at (wx, y, fz): check (-1,0), (0,-1), (-1,-1) in XY
-                ao0 = cornerAO(isSolidForAO(getBlock, wx-1, y, fz),
-                              isSolidForAO(getBlock, wx, y-1, fz),
-                              isSolidForAO(getBlock, wx-1, y-1, fz));
-                // Corner 1 at (wx+1, y, fz)
-                ao1 = cornerAO(isSolidForAO(getBlock, wx+1, y, fz),
-                              isSolidForAO(getBlock, wx+1, y-1, fz),
-                              isSolidForAO(getBlock, wx, y-1, fz));
-                // Corner 2 at (wx+1, y+1, fz)
-                ao2 = cornerAO(isSolidForAO(getBlock, wx+1, y, fz),
-                              isSolidForAO(getBlock, wx, y+1, fz),
-                              isSolidForAO(getBlock, wx+1, y+1, fz));
-                // Corner 3 at (wx, y+1, fz)
-                ao3 = cornerAO(isSolidForAO(getBlock, wx-1, y, fz),
-                              isSolidForAO(getBlock, wx, y+1, fz),
-                              isSolidForAO(getBlock, wx-1, y+1, fz));
-                break;
-            }
-            case BGMFace::NEG_Z: {
-                // Back face at z-1
-                int fz = wz - 1;
-                // Corner ordering is mirrored for back face
-                ao0 = cornerAO(isSolidForAO(getBlock, wx+1, y, fz),
-                              isSolidForAO(getBlock, wx, y-1, fz),
-                              isSolidForAO(getBlock, wx+1, y-1, fz));
-                ao1 = cornerAO(isSolidForAO(getBlock, wx-1, y, fz),
-                              isSolidForAO(getBlock, wx-1, y-1, fz),
-                              isSolidForAO(getBlock, wx, y-1, fz));
-                ao2 = cornerAO(isSolidForAO(getBlock, wx-1, y, fz),
-                              isSolidForAO(getBlock, wx, y+1, fz),
-                              isSolidForAO(getBlock, wx-1, y+1, fz));
-                ao3 = cornerAO(isSolidForAO(getBlock, wx+1, y, fz),
-                              isSolidForAO(getBlock, wx, y+1, fz),
-                              isSolidForAO(getBlock, wx+1, y+1, fz));
-                break;
-            }
-            case BGMFace::POS_X: {
-                // Right face at x+1 - check blocks at level x+1 (in ZY plane)
-                int fx = wx + 1;
-                // Corner 0 at (fx, y, wz)
-                ao0 = cornerAO(isSolidForAO(getBlock, fx, y, wz-1),
-                              isSolidForAO(getBlock, fx, y-1, wz),
-                              isSolidForAO(getBlock, fx, y-1, wz-1));
-                // Corner 1 at (fx, y, wz+1)
-                ao1 = cornerAO(isSolidForAO(getBlock, fx, y, wz+1),
-                              isSolidForAO(getBlock, fx, y-1, wz+1),
-                              isSolidForAO(getBlock, fx, y-1, wz));
-                // Corner 2 at (fx, y+1, wz+1)
-                ao2 = cornerAO(isSolidForAO(getBlock, fx, y, wz+1),
-                              isSolidForAO(getBlock, fx, y+1, wz),
-                              isSolidForAO(getBlock, fx, y+1, wz+1));
-                // Corner 3 at (fx, y+1, wz)
-                ao3 = cornerAO(isSolidForAO(getBlock, fx, y, wz-1),
-                              isSolidForAO(getBlock, fx, y+1, wz),
-                              isSolidForAO(getBlock, fx, y+1, wz-1));
-                break;
-            }
-            case BGMFace::NEG_X: {
-                // Left face at x-1
-                int fx = wx - 1;
-                // Corner ordering is mirrored for left face
-                ao0 = cornerAO(isSolidForAO(getBlock, fx, y, wz+1),
-                              isSolidForAO(getBlock, fx, y-1, wz),
-                              isSolidForAO(getBlock, fx, y-1, wz+1));
-                ao1 = cornerAO(isSolidForAO(getBlock, fx, y, wz-1),
-                              isSolidForAO(getBlock, fx, y-1, wz-1),
-                              isSolidForAO(getBlock, fx, y-1, wz));
-                ao2 = cornerAO(isSolidForAO(getBlock, fx, y, wz-1),
-                              isSolidForAO(getBlock, fx, y+1, wz),
-                              isSolidForAO(getBlock, fx, y+1, wz-1));
-                ao3 = cornerAO(isSolidForAO(getBlock, fx, y, wz+1),
-                              isSolidForAO(getBlock, fx, y+1, wz),
-                              isSolidForAO(getBlock, fx, y+1, wz+1));
-                break;
-            }
-        }
-
-        return static_cast<uint8_t>((ao0 & 0x3) | ((ao1 & 0x3) << 2) |
-                                    ((ao2 & 0x3) << 4) | ((ao3 & 0x3) << 6));
-    }
-
-    // Calculate ambient occlusion for all 4 corners of a quad
-    // Returns packed AO: 2 bits per corner (corners 0,1,2,3 in bits 0-1, 2-3, 4-5, 6-7)
-    //
-    // Minecraft-style AO: combines two effects:
-    // 1. Overhang shadows (0fps algorithm) - blocks ABOVE the face
-    // 2. Contact shadows - blocks at SAME level creating edge darkening
-    uint8_t calculateAO(
-        const Chunk& chunk,
-        const BlockGetter& getBlock,
-        int baseX, int baseZ,
-        int x, int y, int z,
-        int width, int height,
-        BGMFace face
-    ) {
-        (void)chunk; // Unused, using getBlock instead
-
-        // World coordinates
-        int wx = baseX + x;
-        int wz = baseZ + z;
-
-        // AO values for 4 corners (default fully lit)
-        int ao0 = 3, ao1 = 3, ao2 = 3, ao3 = 3;
-
-        // 0fps algorithm: For each vertex, check 3 neighbors at FACE level
-        // side1, side2 = two perpendicular neighbors
-        // corner = diagonal neighbor
-        // vertexAO = if(side1 && side2) 0 else 3-(side1+side2+corner)
-        switch (face) {
-            case BGMFace::POS_Y: {
-                // Top face - vertices are at y+1, check neighbors at y+1
-                int fy = y + 1;
-                // Vertex 0 at (wx, wz): check (-1,0), (0,-1), (-1,-1)
-                ao0 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz-1),
-                              isSolidForAO(getBlock, wx-1, fy, wz-1));
-                // Vertex 1 at (wx+width, wz): check (+1,0), (0,-1), (+1,-1)
-                ao1 = cornerAO(isSolidForAO(getBlock, wx+width, fy, wz),
-                              isSolidForAO(getBlock, wx+width-1, fy, wz-1),
-                              isSolidForAO(getBlock, wx+width, fy, wz-1));
-                // Vertex 2 at (wx+width, wz+height): check (+1,0), (0,+1), (+1,+1)
-                ao2 = cornerAO(isSolidForAO(getBlock, wx+width, fy, wz+height-1),
-                              isSolidForAO(getBlock, wx+width-1, fy, wz+height),
-                              isSolidForAO(getBlock, wx+width, fy, wz+height));
-                // Vertex 3 at (wx, wz+height): check (-1,0), (0,+1), (-1,+1)
-                ao3 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz+height-1),
-                              isSolidForAO(getBlock, wx, fy, wz+height),
-                              isSolidForAO(getBlock, wx-1, fy, wz+height));
-                break;
-            }
-            case BGMFace::NEG_Y: {
-                // Bottom face - vertices are at y, check neighbors at y-1
-                int fy = y - 1;
-                ao0 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz),
-                              isSolidForAO(getBlock, wx, fy, wz-1),
-                              isSolidForAO(getBlock, wx-1, fy, wz-1));
-                ao1 = cornerAO(isSolidForAO(getBlock, wx+width, fy, wz),
-                              isSolidForAO(getBlock, wx+width-1, fy, wz-1),
-                              isSolidForAO(getBlock, wx+width, fy, wz-1));
-                ao2 = cornerAO(isSolidForAO(getBlock, wx+width, fy, wz+height-1),
-                              isSolidForAO(getBlock, wx+width-1, fy, wz+height),
-                              isSolidForAO(getBlock, wx+width, fy, wz+height));
-                ao3 = cornerAO(isSolidForAO(getBlock, wx-1, fy, wz+height-1),
-                              isSolidForAO(getBlock, wx, fy, wz+height),
-                              isSolidForAO(getBlock, wx-1, fy, wz+height));
-                break;
-            }
-            case BGMFace::POS_Z: {
-                // Front face (+Z) - vertices at z+1, check neighbors at z+1
-                int fz = wz + 1;
-                ao0 = cornerAO(isSolidForAO(getBlock, wx-1, y, fz),
-                              isSolidForAO(getBlock, wx, y-1, fz),
-                              isSolidForAO(getBlock, wx-1, y-1, fz));
-                ao1 = cornerAO(isSolidForAO(getBlock, wx+width, y, fz),
-                              isSolidForAO(getBlock, wx+width-1, y-1, fz),
-                              isSolidForAO(getBlock, wx+width, y-1, fz));
-                ao2 = cornerAO(isSolidForAO(getBlock, wx+width, y+height-1, fz),
-                              isSolidForAO(getBlock, wx+width-1, y+height, fz),
-                              isSolidForAO(getBlock, wx+width, y+height, fz));
-                ao3 = cornerAO(isSolidForAO(getBlock, wx-1, y+height-1, fz),
-                              isSolidForAO(getBlock, wx, y+height, fz),
-                              isSolidForAO(getBlock, wx-1, y+height, fz));
-                break;
-            }
-            case BGMFace::NEG_Z: {
-                // Back face (-Z) - vertices at z, check neighbors at z-1
-                int fz = wz - 1;
-                ao0 = cornerAO(isSolidForAO(getBlock, wx+width, y, fz),
-                              isSolidForAO(getBlock, wx+width-1, y-1, fz),
-                              isSolidForAO(getBlock, wx+width, y-1, fz));
-                ao1 = cornerAO(isSolidForAO(getBlock, wx-1, y, fz),
-                              isSolidForAO(getBlock, wx, y-1, fz),
-                              isSolidForAO(getBlock, wx-1, y-1, fz));
-                ao2 = cornerAO(isSolidForAO(getBlock, wx-1, y+height-1, fz),
-                              isSolidForAO(getBlock, wx, y+height, fz),
-                              isSolidForAO(getBlock, wx-1, y+height, fz));
-                ao3 = cornerAO(isSolidForAO(getBlock, wx+width, y+height-1, fz),
-                              isSolidForAO(getBlock, wx+width-1, y+height, fz),
-                              isSolidForAO(getBlock, wx+width, y+height, fz));
-                break;
-            }
-            case BGMFace::NEG_X: {
-                // Left face (-X) - vertices at x, check neighbors at x-1
-                int fx = wx - 1;
-                ao0 = cornerAO(isSolidForAO(getBlock, fx, y, wz-1),
-                              isSolidForAO(getBlock, fx, y-1, wz),
-                              isSolidForAO(getBlock, fx, y-1, wz-1));
-                ao1 = cornerAO(isSolidForAO(getBlock, fx, y, wz+width),
-                              isSolidForAO(getBlock, fx, y-1, wz+width-1),
-                              isSolidForAO(getBlock, fx, y-1, wz+width));
-                ao2 = cornerAO(isSolidForAO(getBlock, fx, y+height-1, wz+width),
-                              isSolidForAO(getBlock, fx, y+height, wz+width-1),
-                              isSolidForAO(getBlock, fx, y+height, wz+width));
-                ao3 = cornerAO(isSolidForAO(getBlock, fx, y+height-1, wz-1),
-                              isSolidForAO(getBlock, fx, y+height, wz),
-                              isSolidForAO(getBlock, fx, y+height, wz-1));
-                break;
-            }
-            case BGMFace::POS_X: {
-                // Right face (+X) - vertices at x+1, check neighbors at x+1
-                int fx = wx + 1;
-                ao0 = cornerAO(isSolidForAO(getBlock, fx, y, wz+width),
-                              isSolidForAO(getBlock, fx, y-1, wz+width-1),
-                              isSolidForAO(getBlock, fx, y-1, wz+width));
-                ao1 = cornerAO(isSolidForAO(getBlock, fx, y, wz-1),
-                              isSolidForAO(getBlock, fx, y-1, wz),
-                              isSolidForAO(getBlock, fx, y-1, wz-1));
-                ao2 = cornerAO(isSolidForAO(getBlock, fx, y+height-1, wz-1),
-                              isSolidForAO(getBlock, fx, y+height, wz),
-                              isSolidForAO(getBlock, fx, y+height, wz-1));
-                ao3 = cornerAO(isSolidForAO(getBlock, fx, y+height-1, wz+width),
-                              isSolidForAO(getBlock, fx, y+height, wz+width-1),
-                              isSolidForAO(getBlock, fx, y+height, wz+width));
-                break;
-            }
-        }
-
-        // Pack 4 corners into 8 bits (2 bits per corner, values 0-3)
-        return static_cast<uint8_t>((ao0 & 0x3) | ((ao1 & 0x3) << 2) |
-                                    ((ao2 & 0x3) << 4) | ((ao3 & 0x3) << 6));
-    }
-
-    // Get light level at position (0-15 range)
-    int getLightAt(const Chunk& chunk, int x, int y, int z) const {
-        if (y < 0 || y >= CHUNK_SIZE_Y) return 15;  // Full light outside bounds
-        return chunk.getLightLevel(x, y, z);
-    }
-
-    // Get light level at position (legacy - returns 0-255)
-    uint8_t calculateLight(const Chunk& chunk, int x, int y, int z) {
-        if (y < 0 || y >= CHUNK_SIZE_Y) return 255;
-        return chunk.getLightLevel(x, y, z) * 17;  // Scale 0-15 to 0-255
-    }
-
-    // Calculate smooth lighting for all 4 corners of a quad
-    // Returns packed light: 2 bits per corner (corners 0,1,2,3 in bits 0-1, 2-3, 4-5, 6-7)
-    // Each corner averages light from 4 adjacent blocks for smooth interpolation
-    uint8_t calculateLightCorners(
-        const Chunk& chunk,
-        int x, int y, int z,
-        int width, int height,
-        BGMFace face
-    ) {
-        // Helper to average 4 light values and convert to 2-bit (0-3)
-        auto avgLight = [&](int l0, int l1, int l2, int l3) -> int {
-            int avg = (l0 + l1 + l2 + l3 + 2) / 4;  // Average with rounding
-            return std::min(3, avg / 4);  // Map 0-15 to 0-3
-        };
-
-        int light0 = 3, light1 = 3, light2 = 3, light3 = 3;
-
-        switch (face) {
-            case BGMFace::POS_Y: {
-                // Top face - sample light above the face
-                int fy = y + 1;
-                // Corner 0 (x, z+height)
-                light0 = avgLight(
-                    getLightAt(chunk, x, fy, z+height),
-                    getLightAt(chunk, x-1, fy, z+height),
-                    getLightAt(chunk, x, fy, z+height+1),
-                    getLightAt(chunk, x-1, fy, z+height+1)
-                );
-                // Corner 1 (x+width, z+height)
-                light1 = avgLight(
-                    getLightAt(chunk, x+width-1, fy, z+height),
-                    getLightAt(chunk, x+width, fy, z+height),
-                    getLightAt(chunk, x+width-1, fy, z+height+1),
-                    getLightAt(chunk, x+width, fy, z+height+1)
-                );
-                // Corner 2 (x+width, z)
-                light2 = avgLight(
-                    getLightAt(chunk, x+width-1, fy, z),
-                    getLightAt(chunk, x+width, fy, z),
-                    getLightAt(chunk, x+width-1, fy, z-1),
-                    getLightAt(chunk, x+width, fy, z-1)
-                );
-                // Corner 3 (x, z)
-                light3 = avgLight(
-                    getLightAt(chunk, x, fy, z),
-                    getLightAt(chunk, x-1, fy, z),
-                    getLightAt(chunk, x, fy, z-1),
-                    getLightAt(chunk, x-1, fy, z-1)
-                );
-                break;
-            }
-            case BGMFace::NEG_Y: {
-                // Bottom face - sample light below the face
-                int fy = y - 1;
-                light0 = avgLight(
-                    getLightAt(chunk, x, fy, z),
-                    getLightAt(chunk, x-1, fy, z),
-                    getLightAt(chunk, x, fy, z-1),
-                    getLightAt(chunk, x-1, fy, z-1)
-                );
-                light1 = avgLight(
-                    getLightAt(chunk, x+width-1, fy, z),
-                    getLightAt(chunk, x+width, fy, z),
-                    getLightAt(chunk, x+width-1, fy, z-1),
-                    getLightAt(chunk, x+width, fy, z-1)
-                );
-                light2 = avgLight(
-                    getLightAt(chunk, x+width-1, fy, z+height),
-                    getLightAt(chunk, x+width, fy, z+height),
-                    getLightAt(chunk, x+width-1, fy, z+height+1),
-                    getLightAt(chunk, x+width, fy, z+height+1)
-                );
-                light3 = avgLight(
-                    getLightAt(chunk, x, fy, z+height),
-                    getLightAt(chunk, x-1, fy, z+height),
-                    getLightAt(chunk, x, fy, z+height+1),
-                    getLightAt(chunk, x-1, fy, z+height+1)
-                );
-                break;
-            }
-            case BGMFace::POS_Z: {
-                // Front face (+Z) - sample light in front
-                int fz = z + 1;
-                light0 = avgLight(
-                    getLightAt(chunk, x, y, fz),
-                    getLightAt(chunk, x-1, y, fz),
-                    getLightAt(chunk, x, y-1, fz),
-                    getLightAt(chunk, x-1, y-1, fz)
-                );
-                light1 = avgLight(
-                    getLightAt(chunk, x+width-1, y, fz),
-                    getLightAt(chunk, x+width, y, fz),
-                    getLightAt(chunk, x+width-1, y-1, fz),
-                    getLightAt(chunk, x+width, y-1, fz)
-                );
-                light2 = avgLight(
-                    getLightAt(chunk, x+width-1, y+height-1, fz),
-                    getLightAt(chunk, x+width, y+height-1, fz),
-                    getLightAt(chunk, x+width-1, y+height, fz),
-                    getLightAt(chunk, x+width, y+height, fz)
-                );
-                light3 = avgLight(
-                    getLightAt(chunk, x, y+height-1, fz),
-                    getLightAt(chunk, x-1, y+height-1, fz),
-                    getLightAt(chunk, x, y+height, fz),
-                    getLightAt(chunk, x-1, y+height, fz)
-                );
-                break;
-            }
-            case BGMFace::NEG_Z: {
-                // Back face (-Z) - sample light behind
-                int fz = z - 1;
-                light0 = avgLight(
-                    getLightAt(chunk, x+width-1, y, fz),
-                    getLightAt(chunk, x+width, y, fz),
-                    getLightAt(chunk, x+width-1, y-1, fz),
-                    getLightAt(chunk, x+width, y-1, fz)
-                );
-                light1 = avgLight(
-                    getLightAt(chunk, x, y, fz),
-                    getLightAt(chunk, x-1, y, fz),
-                    getLightAt(chunk, x, y-1, fz),
-                    getLightAt(chunk, x-1, y-1, fz)
-                );
-                light2 = avgLight(
-                    getLightAt(chunk, x, y+height-1, fz),
-                    getLightAt(chunk, x-1, y+height-1, fz),
-                    getLightAt(chunk, x, y+height, fz),
-                    getLightAt(chunk, x-1, y+height, fz)
-                );
-                light3 = avgLight(
-                    getLightAt(chunk, x+width-1, y+height-1, fz),
-                    getLightAt(chunk, x+width, y+height-1, fz),
-                    getLightAt(chunk, x+width-1, y+height, fz),
-                    getLightAt(chunk, x+width, y+height, fz)
-                );
-                break;
-            }
-            case BGMFace::NEG_X: {
-                // Left face (-X) - sample light to the left
-                int fx = x - 1;
-                light0 = avgLight(
-                    getLightAt(chunk, fx, y, z),
-                    getLightAt(chunk, fx, y, z-1),
-                    getLightAt(chunk, fx, y-1, z),
-                    getLightAt(chunk, fx, y-1, z-1)
-                );
-                light1 = avgLight(
-                    getLightAt(chunk, fx, y, z+width-1),
-                    getLightAt(chunk, fx, y, z+width),
-                    getLightAt(chunk, fx, y-1, z+width-1),
-                    getLightAt(chunk, fx, y-1, z+width)
-                );
-                light2 = avgLight(
-                    getLightAt(chunk, fx, y+height-1, z+width-1),
-                    getLightAt(chunk, fx, y+height-1, z+width),
-                    getLightAt(chunk, fx, y+height, z+width-1),
-                    getLightAt(chunk, fx, y+height, z+width)
-                );
-                light3 = avgLight(
-                    getLightAt(chunk, fx, y+height-1, z),
-                    getLightAt(chunk, fx, y+height-1, z-1),
-                    getLightAt(chunk, fx, y+height, z),
-                    getLightAt(chunk, fx, y+height, z-1)
-                );
-                break;
-            }
-            case BGMFace::POS_X: {
-                // Right face (+X) - sample light to the right
-                int fx = x + 1;
-                light0 = avgLight(
-                    getLightAt(chunk, fx, y, z+width-1),
-                    getLightAt(chunk, fx, y, z+width),
-                    getLightAt(chunk, fx, y-1, z+width-1),
-                    getLightAt(chunk, fx, y-1, z+width)
-                );
-                light1 = avgLight(
-                    getLightAt(chunk, fx, y, z),
-                    getLightAt(chunk, fx, y, z-1),
-                    getLightAt(chunk, fx, y-1, z),
-                    getLightAt(chunk, fx, y-1, z-1)
-                );
-                light2 = avgLight(
-                    getLightAt(chunk, fx, y+height-1, z),
-                    getLightAt(chunk, fx, y+height-1, z-1),
-                    getLightAt(chunk, fx, y+height, z),
-                    getLightAt(chunk, fx, y+height, z-1)
-                );
-                light3 = avgLight(
-                    getLightAt(chunk, fx, y+height-1, z+width-1),
-                    getLightAt(chunk, fx, y+height-1, z+width),
-                    getLightAt(chunk, fx, y+height, z+width-1),
-                    getLightAt(chunk, fx, y+height, z+width)
-                );
-                break;
-            }
-        }
-
-        // Pack 4 corners into 8 bits (2 bits per corner, values 0-3)
-        return static_cast<uint8_t>((light0 & 0x3) | ((light1 & 0x3) << 2) |
-                                    ((light2 & 0x3) << 4) | ((light3 & 0x3) << 6));
-    }
-
     // Check if block is opaque
     static bool isBlockOpaque(BlockType block) {
-        return block != BlockType::AIR &&
-               block != BlockType::WATER &&
-               block != BlockType::GLASS &&
-               block != BlockType::LEAVES;
+        return isBlockOccluding(block);
     }
 };
 
 // Utility function to expand a single face bucket to vertices
 // Internal helper - use expandFaceBucketsToVertices for the main API
 // biomeTemp/biomeHumid arrays are indexed by (x + z * CHUNK_SIZE_X), can be nullptr for no biome tinting
+// scale > 1 expands quads meshed from a VoxelPyramid level (one cell = scale blocks)
 inline void expandSingleBucketToVertices(
     const std::vector<BinaryQuad>& quads,
     std::vector<PackedChunkVertex>& vertices,
     const uint8_t* biomeTemp = nullptr,
-    const uint8_t* biomeHumid = nullptr
+    const uint8_t* biomeHumid = nullptr,
+    int scale = 1
 ) {
     vertices.reserve(vertices.size() + quads.size() * 6);  // 6 vertices per quad (2 triangles)
 
     for (const auto& quad : quads) {
-        int x = quad.getX();
-        int y = quad.getY();
-        int z = quad.getZ();
-        int width = quad.getWidth();
-        int height = quad.getHeight();
+        // Everything below works in block units, so LOD cells scale up here
+        int x = quad.getX() * scale;
+        int y = quad.getY() * scale;
+        int z = quad.getZ() * scale;
+        int width = quad.getWidth() * scale;
+        int height = quad.getHeight() * scale;
         int normalIdx = quad.getNormal();
         int texSlot = quad.getTexSlot();
-        uint8_t packedLight = quad.getLight();
+        uint16_t packedLight = quad.getBlockLight();
+        uint16_t packedSky = quad.getSkyLight();
         uint8_t packedAO = quad.getAO();
 
         // Unpack AO values for each corner (2 bits each, 0-3 range)
@@ -1228,12 +688,14 @@ inline void expandSingleBucketToVertices(
             aoValues[i] = static_cast<uint8_t>(50 + aoVal * 68);
         }
 
-        // Unpack per-corner light values (2 bits each, 0-3 range)
-        // Maps 0-3 to 100-255 range for smooth lighting interpolation
+        // Unpack per-corner block + sky light (3 bits each, 0-7 range) into the vertex's
+        // light byte as two 0-15 nibbles (low = block, high = sky), decoded by the shaders
         std::array<uint8_t, 4> lightValues;
         for (int i = 0; i < 4; i++) {
-            int lightVal = (packedLight >> (i * 2)) & 0x3;
-            lightValues[i] = static_cast<uint8_t>(100 + lightVal * 51);  // 100, 151, 202, 253
+            int blockVal = (packedLight >> (i * 3)) & 0x7;
+            int skyVal = (packedSky >> (i * 3)) & 0x7;
+            lightValues[i] = packLight(static_cast<uint8_t>((blockVal * 15 + 3) / 7),
+                                       static_cast<uint8_t>((skyVal * 15 + 3) / 7));
         }
 
         // Local positions (scaled by 256 for precision)
@@ -1247,10 +709,10 @@ inline void expandSingleBucketToVertices(
             case BGMFace::POS_Y: { // Top face (+Y) - normalIndex = 2
                 packedNormalIndex = 2;
                 localCorners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + height) * 256)},
-                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + height) * 256)},
-                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)}
+                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + scale) * 256), static_cast<int16_t>((z + height) * 256)},
+                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>((y + scale) * 256), static_cast<int16_t>((z + height) * 256)},
+                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>((y + scale) * 256), static_cast<int16_t>(z * 256)},
+                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + scale) * 256), static_cast<int16_t>(z * 256)}
                 }};
                 uvCorners = {{
                     {0, static_cast<uint16_t>(height * 256)},
@@ -1279,10 +741,10 @@ inline void expandSingleBucketToVertices(
             case BGMFace::POS_Z: { // Front face (+Z) - normalIndex = 4
                 packedNormalIndex = 4;
                 localCorners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>((z + 1) * 256)}
+                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + scale) * 256)},
+                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + scale) * 256)},
+                    {static_cast<int16_t>((x + width) * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>((z + scale) * 256)},
+                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>((z + scale) * 256)}
                 }};
                 uvCorners = {{
                     {0, static_cast<uint16_t>(height * 256)},
@@ -1327,10 +789,10 @@ inline void expandSingleBucketToVertices(
             case BGMFace::POS_X: { // Right face (+X) - normalIndex = 0
                 packedNormalIndex = 0;
                 localCorners = {{
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + width) * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>((z + width) * 256)}
+                    {static_cast<int16_t>((x + scale) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + width) * 256)},
+                    {static_cast<int16_t>((x + scale) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
+                    {static_cast<int16_t>((x + scale) * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>(z * 256)},
+                    {static_cast<int16_t>((x + scale) * 256), static_cast<int16_t>((y + height) * 256), static_cast<int16_t>((z + width) * 256)}
                 }};
                 uvCorners = {{
                     {0, static_cast<uint16_t>(height * 256)},
@@ -1408,11 +870,12 @@ inline void expandFaceBucketsToVertices(
     const BinaryMeshResult& result,
     std::array<std::vector<PackedChunkVertex>, FACE_BUCKET_COUNT>& faceBucketVertices,
     const uint8_t* biomeTemp = nullptr,
-    const uint8_t* biomeHumid = nullptr
+    const uint8_t* biomeHumid = nullptr,
+    int scale = 1
 ) {
     for (int i = 0; i < FACE_BUCKET_COUNT; i++) {
         faceBucketVertices[i].clear();
-        expandSingleBucketToVertices(result.faceBuckets[i], faceBucketVertices[i], biomeTemp, biomeHumid);
+        expandSingleBucketToVertices(result.faceBuckets[i], faceBucketVertices[i], biomeTemp, biomeHumid, scale);
     }
 }
 
@@ -1422,14 +885,15 @@ inline void expandQuadsToVertices(
     const BinaryMeshResult& result,
     std::vector<PackedChunkVertex>& vertices,
     const uint8_t* biomeTemp = nullptr,
-    const uint8_t* biomeHumid = nullptr
+    const uint8_t* biomeHumid = nullptr,
+    int scale = 1
 ) {
     vertices.clear();
     size_t totalQuads = result.getTotalQuadCount();
     vertices.reserve(totalQuads * 6);
 
     for (int i = 0; i < FACE_BUCKET_COUNT; i++) {
-        expandSingleBucketToVertices(result.faceBuckets[i], vertices, biomeTemp, biomeHumid);
+        expandSingleBucketToVertices(result.faceBuckets[i], vertices, biomeTemp, biomeHumid, scale);
     }
 }
 
@@ -6,6 +6,7 @@
 #include <glad/gl.h>
 #include <glm/glm.hpp>
 #include <vector>
+#include <atomic>
 #include <array>
 #include <functional>
 #include <cstring>
@@ -35,7 +36,7 @@ struct PackedChunkVertex {
     // AO factor (0-255 maps to 0.0-1.0)
     uint8_t ao;            // 1 byte
 
-    // Light level (0-255 maps to 0.0-1.0)
+    // Light levels: low nibble = block light, high nibble = sky light (0-15 each)
     uint8_t light;         // 1 byte
 
     // Texture slot index in atlas (0-255)
@@ -58,9 +59,42 @@ struct ChunkVertex {
     glm::vec2 texSlotBase; // Base UV of texture slot in atlas (for greedy meshing tiling)
 };
 
+// PackedWaterVertex flags
+constexpr uint8_t WATER_VERTEX_LAVA = 1 << 0;  // Lava surface (no wave animation)
+
+// Packed vertex structure for water and lava (16 bytes vs 48 bytes for ChunkVertex)
+// Generated by WaterMesher with coplanar faces of equal level greedy-merged
+struct PackedWaterVertex {
+    // Position relative to chunk origin, scaled by 256
+    // Unsigned so surface heights up to the top of the world fit
+    uint16_t x, y, z;      // 6 bytes
+
+    // Tiling texture coordinates (0 to quad size, 8.8 fixed point)
+    uint16_t u, v;         // 4 bytes
+
+    // Normal direction index (0-5 for +X,-X,+Y,-Y,+Z,-Z)
+    uint8_t normalIndex;   // 1 byte
+
+    // Liquid level (1-7 flowing, 8 = source)
+    uint8_t level;         // 1 byte
+
+    // Texture slot index in atlas (0-255)
+    uint8_t texSlot;       // 1 byte
+
+    // WATER_VERTEX_* flags
+    uint8_t flags;         // 1 byte
+
+    // Horizontal flow direction, normalized to -127..127 (0,0 = still)
+    int8_t flowX, flowZ;   // 2 bytes
+
+    // Total: 16 bytes
+};
+static_assert(sizeof(PackedWaterVertex) == 16, "PackedWaterVertex must stay 16 bytes");
+
 // Include BinaryGreedyMesher.h for FACE_BUCKET_COUNT constant
 // Must be included after PackedChunkVertex is defined (no circular dependency)
 #include "BinaryGreedyMesher.h"
+#include "WaterMesher.h"
 
 // ============================================================
 // MESH SHADER STRUCTURES (GL_NV_mesh_shader)
@@ -84,7 +118,13 @@ struct alignas(16) MeshletDescriptor {
     // Bounding sphere for frustum culling (in local chunk coordinates)
     float centerX, centerY, centerZ;  // Center of bounding sphere
     float radius;                      // Radius of bounding sphere
+
+    // Normal cone for backface culling: the meshlet faces away from the camera when
+    // dot(center - camera, axis) >= coneCutoff * length(center - camera) + radius
+    float coneAxisX, coneAxisY, coneAxisZ;  // Average facing direction
+    float coneCutoff;                       // sin(cone half-angle), 1 = never cull
 };
+static_assert(sizeof(MeshletDescriptor) == 48, "MeshletDescriptor must match the task/mesh shader layout");
 
 // Meshlet data for a sub-chunk (used by mesh shaders)
 struct MeshletData {
@@ -111,8 +151,9 @@ struct MeshletData {
     }
 };
 
-// Global flag to enable meshlet generation (set from main based on GPU support)
-inline bool g_generateMeshlets = false;
+// Global flag to enable meshlet generation (set from main based on GPU support,
+// read by the mesh workers)
+inline std::atomic<bool> g_generateMeshlets{false};
 
 // Normal lookup table (used by shader to decode normal index)
 // 0=+X, 1=-X, 2=+Y, 3=-Y, 4=+Z, 5=-Z
@@ -130,6 +171,81 @@ inline uint8_t encodeNormal(const glm::vec3& normal) {
     return 5;                            // -Z
 }
 
+// Build meshlet descriptors (bounding sphere + normal cone) for non-indexed triangle lists
+// CPU-only so mesh workers can run it; vertexOffsets index the ranges laid out back to back,
+// which is how uploadMeshletsToSubChunk fills the vertex SSBO.
+// Meshlets never straddle two ranges, so face buckets give single-normal (tight) cones.
+inline void buildMeshlets(const std::vector<PackedChunkVertex>* ranges, int rangeCount,
+                          std::vector<MeshletDescriptor>& meshlets) {
+    meshlets.clear();
+
+    // For non-indexed geometry: MESHLET_MAX_VERTICES vertices = MESHLET_MAX_VERTICES/3 triangles
+    const size_t maxVerticesPerMeshlet =
+        std::min((size_t)MESHLET_MAX_TRIANGLES, (size_t)MESHLET_MAX_VERTICES / 3) * 3;
+
+    size_t rangeBase = 0;
+    for (int r = 0; r < rangeCount; r++) {
+        const std::vector<PackedChunkVertex>& vertices = ranges[r];
+        size_t vertexCount = vertices.size() - vertices.size() % 3;
+
+        for (size_t first = 0; first < vertexCount; first += maxVerticesPerMeshlet) {
+            size_t count = std::min(vertexCount - first, maxVerticesPerMeshlet);
+
+            MeshletDescriptor desc = {};
+            desc.vertexOffset = static_cast<uint32_t>(rangeBase + first);
+            desc.vertexCount = static_cast<uint32_t>(count);
+            desc.triangleOffset = static_cast<uint32_t>((rangeBase + first) / 3);
+            desc.triangleCount = static_cast<uint32_t>(count / 3);
+
+            // Bounds and summed normals in one pass
+            float minX = FLT_MAX, minY = FLT_MAX, minZ = FLT_MAX;
+            float maxX = -FLT_MAX, maxY = -FLT_MAX, maxZ = -FLT_MAX;
+            uint32_t normalCounts[6] = {};
+            for (size_t i = first; i < first + count; i++) {
+                const PackedChunkVertex& v = vertices[i];
+                float x = static_cast<float>(v.x) / 256.0f;
+                float y = static_cast<float>(v.y) / 256.0f;
+                float z = static_cast<float>(v.z) / 256.0f;
+                minX = std::min(minX, x); maxX = std::max(maxX, x);
+                minY = std::min(minY, y); maxY = std::max(maxY, y);
+                minZ = std::min(minZ, z); maxZ = std::max(maxZ, z);
+                normalCounts[std::min<uint8_t>(v.normalIndex, 5)]++;
+            }
+
+            // Bounding sphere center and radius
+            desc.centerX = (minX + maxX) * 0.5f;
+            desc.centerY = (minY + maxY) * 0.5f;
+            desc.centerZ = (minZ + maxZ) * 0.5f;
+            float dx = maxX - minX;
+            float dy = maxY - minY;
+            float dz = maxZ - minZ;
+            desc.radius = sqrtf(dx*dx + dy*dy + dz*dz) * 0.5f;
+
+            // Normal cone: axis is the mean normal, half-angle covers the widest normal
+            glm::vec3 axis(0.0f);
+            for (int n = 0; n < 6; n++) {
+                axis += NORMAL_LOOKUP[n] * static_cast<float>(normalCounts[n]);
+            }
+            desc.coneCutoff = 1.0f;
+            if (glm::dot(axis, axis) > 0.0f) {
+                axis = glm::normalize(axis);
+                float minDot = 1.0f;
+                for (int n = 0; n < 6; n++) {
+                    if (normalCounts[n] > 0) minDot = std::min(minDot, glm::dot(axis, NORMAL_LOOKUP[n]));
+                }
+                // Spread of 90 degrees or more can't be backface culled as a whole
+                if (minDot > 0.0f) desc.coneCutoff = sqrtf(std::max(0.0f, 1.0f - minDot * minDot));
+            }
+            desc.coneAxisX = axis.x;
+            desc.coneAxisY = axis.y;
+            desc.coneAxisZ = axis.z;
+
+            meshlets.push_back(desc);
+        }
+        rangeBase += vertices.size();
+    }
+}
+
 // Global flag to enable/disable persistent mapped buffers
 // Set to false to fall back to traditional glBufferSubData
 inline bool g_usePersistentMapping = true;
@@ -225,6 +341,7 @@ constexpr int LOD_SCALES[LOD_LEVELS] = {1, 2, 4, 8};  // Block sampling scale fo
 // Sub-chunk configuration for vertical culling
 constexpr int SUB_CHUNK_HEIGHT = 16;                       // Height of each sub-chunk in blocks
 constexpr int SUB_CHUNKS_PER_COLUMN = CHUNK_SIZE_Y / SUB_CHUNK_HEIGHT;  // 256/16 = 16 sub-chunks
+static_assert(SUB_CHUNK_HEIGHT == CHUNK_SECTION_HEIGHT, "sub-chunks index Chunk::sections directly");
 
 // Sub-chunk mesh - contains LOD meshes for a 16x16x16 section
 // Uses consolidated VBO with glMultiDrawArrays for batched rendering
@@ -258,13 +375,9 @@ struct SubChunkMesh {
     MeshletData meshletData;
     GLuint vertexSSBO = 0;  // SSBO for vertex data (mesh shaders read from SSBO, not VBO)
 
-    // Cached vertex data for deferred meshlet generation (used during burst mode)
-    std::vector<PackedChunkVertex> cachedVerticesForMeshlets;
-    bool needsMeshletGeneration = false;  // Flag for deferred meshlet generation
-
     // Cached vertex data for RHI renderer (Vulkan backend)
     std::vector<PackedChunkVertex> cachedVertices;
-    std::vector<ChunkVertex> cachedWaterVertices;
+    std::vector<PackedWaterVertex> cachedWaterVertices;
 
     int subChunkY = 0;     // Y index (0-15)
     bool isEmpty = true;   // Skip rendering if no geometry
@@ -356,11 +469,6 @@ public:
     int waterVertexCount = 0;
     GLsizeiptr waterVboCapacity = 0;
 
-    // 3D lightmap texture for smooth lighting across greedy-meshed quads
-    // Stores light values per-block, sampled in fragment shader using world position
-    // Size: 16 x 256 x 16 (CHUNK_SIZE_X x CHUNK_SIZE_Y x CHUNK_SIZE_Z)
-    GLuint lightmapTexture = 0;
-
     glm::ivec2 chunkPosition;
 
     // World position of chunk origin (needed for shader to reconstruct world positions)
@@ -377,10 +485,9 @@ public:
         : subChunks(std::move(other.subChunks)),
           lodMeshes(std::move(other.lodMeshes)),
           waterVAO(other.waterVAO), waterVBO(other.waterVBO), waterVertexCount(other.waterVertexCount),
-          waterVboCapacity(other.waterVboCapacity), lightmapTexture(other.lightmapTexture),
+          waterVboCapacity(other.waterVboCapacity),
           chunkPosition(other.chunkPosition), worldOffset(other.worldOffset)
     {
-        other.lightmapTexture = 0;
         // Reset moved-from sub-chunks
         for (auto& sub : other.subChunks) {
             for (auto& lod : sub.lodMeshes) {
@@ -418,10 +525,8 @@ public:
             waterVBO = other.waterVBO;
             waterVertexCount = other.waterVertexCount;
             waterVboCapacity = other.waterVboCapacity;
-            lightmapTexture = other.lightmapTexture;
             chunkPosition = other.chunkPosition;
             worldOffset = other.worldOffset;
-            other.lightmapTexture = 0;
             // Reset moved-from sub-chunks
             for (auto& sub : other.subChunks) {
                 for (auto& lod : sub.lodMeshes) {
@@ -477,68 +582,6 @@ public:
         }
         waterVertexCount = 0;
         waterVboCapacity = 0;
-
-        // Clean up 3D lightmap texture
-        if (lightmapTexture != 0) {
-            glDeleteTextures(1, &lightmapTexture);
-            lightmapTexture = 0;
-        }
-    }
-
-    // Create or update the 3D lightmap texture from chunk light data
-    // This enables smooth lighting across greedy-meshed quads by sampling
-    // light values per-pixel in the fragment shader instead of per-vertex
-    void updateLightmap(const Chunk& chunk) {
-        // Allocate texture data (16 x 256 x 16 = 65536 bytes)
-        std::vector<uint8_t> lightData(CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z);
-
-        // Fill with light values from chunk
-        // 3D texture layout: X varies fastest, then Z, then Y
-        for (int y = 0; y < CHUNK_SIZE_Y; y++) {
-            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    int index = x + z * CHUNK_SIZE_X + y * CHUNK_SIZE_X * CHUNK_SIZE_Z;
-                    // Get light level (0-15) and scale to 0-255
-                    uint8_t light = chunk.getLightLevel(x, y, z);
-                    lightData[index] = light * 17;  // Scale 0-15 to 0-255
-                }
-            }
-        }
-
-        // Create texture if it doesn't exist
-        if (lightmapTexture == 0) {
-            glGenTextures(1, &lightmapTexture);
-            glBindTexture(GL_TEXTURE_3D, lightmapTexture);
-
-            // Set texture parameters for smooth interpolation
-            glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-            glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-            glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
-            // Allocate storage
-            glTexImage3D(GL_TEXTURE_3D, 0, GL_R8,
-                         CHUNK_SIZE_X, CHUNK_SIZE_Z, CHUNK_SIZE_Y,  // width, height, depth
-                         0, GL_RED, GL_UNSIGNED_BYTE, lightData.data());
-        } else {
-            // Update existing texture
-            glBindTexture(GL_TEXTURE_3D, lightmapTexture);
-            glTexSubImage3D(GL_TEXTURE_3D, 0,
-                            0, 0, 0,  // offset
-                            CHUNK_SIZE_X, CHUNK_SIZE_Z, CHUNK_SIZE_Y,  // size
-                            GL_RED, GL_UNSIGNED_BYTE, lightData.data());
-        }
-
-        glBindTexture(GL_TEXTURE_3D, 0);
-    }
-
-    // Bind the lightmap texture to a specific texture unit
-    void bindLightmap(int textureUnit = 2) const {
-        if (lightmapTexture != 0) {
-            glActiveTexture(GL_TEXTURE0 + textureUnit);
-            glBindTexture(GL_TEXTURE_3D, lightmapTexture);
-        }
     }
 
     // Block getter function type - takes world coordinates, returns block type
@@ -583,9 +626,8 @@ public:
     // Uses greedy meshing to merge adjacent faces of same type
     void generate(const Chunk& chunk, const BlockGetter& getWorldBlock, const BlockGetter& getWaterBlock, const BlockGetter& getSafeBlock, const LightGetter& getLightLevel) {
         std::vector<PackedChunkVertex> solidVertices;
-        std::vector<ChunkVertex> waterVertices;
+        std::vector<PackedWaterVertex> waterVertices;
         solidVertices.reserve(CHUNK_VOLUME);
-        waterVertices.reserve(CHUNK_VOLUME / 8);
 
         chunkPosition = chunk.position;
         glm::vec3 chunkWorldPos = chunk.getWorldPosition();
@@ -593,28 +635,11 @@ public:
         int baseX = chunk.position.x * CHUNK_SIZE_X;
         int baseZ = chunk.position.y * CHUNK_SIZE_Z;
 
-        // Process water blocks separately (no greedy meshing for water)
-        // Use heightmaps to skip empty Y regions - major optimization
-        int minY = chunk.chunkMinY;
-        int maxY = chunk.chunkMaxY;
-
-        // Only iterate if chunk has content
-        if (minY <= maxY) {
-            for (int y = minY; y <= maxY; y++) {
-                for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                    for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                        BlockType block = chunk.getBlock(x, y, z);
-                        if (block == BlockType::WATER) {
-                            int wx = baseX + x;
-                            int wz = baseZ + z;
-                            BlockTextures textures = getBlockTextures(block);
-                            glm::vec3 blockPos = chunkWorldPos + glm::vec3(x, y, z);
-                            addWaterBlock(waterVertices, chunk, x, y, z, blockPos, textures.faceSlots[0], getWaterBlock, wx, wz);
-                        }
-                    }
-                }
-            }
-        }
+        // Process liquids separately (greedy-merged packed water quads, chunk-local like
+        // the worker path so the water shader's chunkOffset applies to both)
+        thread_local WaterMesher waterMesher;
+        waterMesher.generateForYRange(chunk, getWaterBlock, baseX, baseZ,
+                                      0, CHUNK_SIZE_Y - 1, waterVertices);
 
         // Greedy meshing for each face direction
         // Process TOP faces (+Y) - most common large flat surface
@@ -662,8 +687,8 @@ public:
             int yStart = subY * SUB_CHUNK_HEIGHT;
             int yEnd = yStart + SUB_CHUNK_HEIGHT - 1;
 
-            // Check if this sub-chunk is empty using heightmaps
-            if (yEnd < chunk.chunkMinY || yStart > chunk.chunkMaxY) {
+            // Check if this sub-chunk is empty using heightmaps and the section summary
+            if (yEnd < chunk.chunkMinY || yStart > chunk.chunkMaxY || chunk.sections[subY].isAllAir()) {
                 // Sub-chunk is entirely empty
                 subChunks[subY].isEmpty = true;
                 subChunks[subY].hasWater = false;
@@ -673,25 +698,12 @@ public:
 
             // Generate mesh for this sub-chunk
             std::vector<PackedChunkVertex> solidVertices;
-            std::vector<ChunkVertex> waterVertices;
+            std::vector<PackedWaterVertex> waterVertices;
             solidVertices.reserve(SUB_CHUNK_HEIGHT * CHUNK_SIZE_X * CHUNK_SIZE_Z / 2);
-            waterVertices.reserve(1024);
 
             // Process water and lava blocks in this Y range (transparent liquids)
-            for (int y = std::max(yStart, static_cast<int>(chunk.chunkMinY)); y <= std::min(yEnd, static_cast<int>(chunk.chunkMaxY)); y++) {
-                for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                    for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                        BlockType block = chunk.getBlock(x, y, z);
-                        if (block == BlockType::WATER || block == BlockType::LAVA) {
-                            int wx = baseX + x;
-                            int wz = baseZ + z;
-                            BlockTextures textures = getBlockTextures(block);
-                            glm::vec3 blockPos = chunkWorldPos + glm::vec3(x, y, z);
-                            addWaterBlock(waterVertices, chunk, x, y, z, blockPos, textures.faceSlots[0], getWaterBlock, wx, wz);
-                        }
-                    }
-                }
-            }
+            thread_local WaterMesher waterMesher;
+            waterMesher.generateForYRange(chunk, getWaterBlock, baseX, baseZ, yStart, yEnd, waterVertices);
 
             // Greedy meshing for this sub-chunk's Y range
             generateGreedyFacesForSubChunk(solidVertices, chunk, chunkWorldPos, baseX, baseZ,
@@ -703,7 +715,9 @@ public:
 
             // Generate meshlets for mesh shader rendering (if enabled)
             if (g_generateMeshlets && !solidVertices.empty()) {
-                generateMeshlets(subY, solidVertices);
+                std::vector<MeshletDescriptor> meshletDescriptors;
+                buildMeshlets(&solidVertices, 1, meshletDescriptors);
+                uploadMeshletsToSubChunk(subY, &solidVertices, 1, meshletDescriptors);
             }
 
             // Generate LODs for this sub-chunk
@@ -876,7 +890,7 @@ private:
                         int ny = y + nOffset.y;
 
                         if (shouldRenderFace(getSafeBlock, wx, ny, wz)) {
-                            BlockTextures textures = getBlockTextures(block);
+                            const BlockTextures& textures = getBlockTextures(block);
                             int slot = (face == BlockFace::TOP) ? textures.faceSlots[4] : textures.faceSlots[5];
                             maskXZ[z * CHUNK_SIZE_X + x] = slot;
                         }
@@ -931,7 +945,7 @@ private:
                         int nz = wz + nOffset.z;
 
                         if (shouldRenderFace(getSafeBlock, wx, y, nz)) {
-                            BlockTextures textures = getBlockTextures(block);
+                            const BlockTextures& textures = getBlockTextures(block);
                             int slot = (face == BlockFace::FRONT) ? textures.faceSlots[0] : textures.faceSlots[1];
                             maskXY[localY * CHUNK_SIZE_X + x] = slot;
                         }
@@ -988,7 +1002,7 @@ private:
                         int nx = wx + nOffset.x;
 
                         if (shouldRenderFace(getSafeBlock, nx, y, wz)) {
-                            BlockTextures textures = getBlockTextures(block);
+                            const BlockTextures& textures = getBlockTextures(block);
                             int slot = (face == BlockFace::LEFT) ? textures.faceSlots[2] : textures.faceSlots[3];
                             maskYZ[localY * CHUNK_SIZE_Z + z] = slot;
                         }
@@ -1055,7 +1069,7 @@ private:
                         BlockType dominant = getDominantBlock(chunk, lodX, lodZ, y, scale);
                         if (dominant == BlockType::AIR) continue;
 
-                        BlockTextures textures = getBlockTextures(dominant);
+                        const BlockTextures& textures = getBlockTextures(dominant);
 
                         if (shouldRenderLODFace(chunk, getSafeBlock, lodX, lodZ, y, y + 1, scale, BlockFace::TOP))
                             addLODQuad(vertices, lodX, y, lodZ, scale, BlockFace::TOP, textures.faceSlots[4]);
@@ -1154,7 +1168,7 @@ private:
                     if (dominant == BlockType::AIR) continue;
 
                     // Get texture for this block
-                    BlockTextures textures = getBlockTextures(dominant);
+                    const BlockTextures& textures = getBlockTextures(dominant);
 
                     // World coordinates for neighbor checks
                     int wx = baseX + lodX;
@@ -1374,7 +1388,7 @@ private:
 
         uint8_t packedTexSlot = static_cast<uint8_t>(textureSlot);
         uint8_t ao = 230;   // Default AO
-        uint8_t light = 0;  // No light
+        uint8_t light = FULL_SKY_LIGHT;  // No block light, open sky
 
         auto makeVertex = [&](int cornerIdx) -> PackedChunkVertex {
             return PackedChunkVertex{
@@ -1450,7 +1464,7 @@ private:
                         int ny = y + nOffset.y;
 
                         if (shouldRenderFace(getSafeBlock, wx, ny, wz)) {
-                            BlockTextures textures = getBlockTextures(block);
+                            const BlockTextures& textures = getBlockTextures(block);
                             int slot = (face == BlockFace::TOP) ? textures.faceSlots[4] : textures.faceSlots[5];
                             maskXZ[z * CHUNK_SIZE_X + x] = slot;
                         }
@@ -1516,7 +1530,7 @@ private:
                         int nz = wz + nOffset.z;
 
                         if (shouldRenderFace(getSafeBlock, wx, y, nz)) {
-                            BlockTextures textures = getBlockTextures(block);
+                            const BlockTextures& textures = getBlockTextures(block);
                             int slot = (face == BlockFace::FRONT) ? textures.faceSlots[0] : textures.faceSlots[1];
                             maskXY[y * CHUNK_SIZE_X + x] = slot;
                         }
@@ -1578,7 +1592,7 @@ private:
                         int nx = wx + nOffset.x;
 
                         if (shouldRenderFace(getSafeBlock, nx, y, wz)) {
-                            BlockTextures textures = getBlockTextures(block);
+                            const BlockTextures& textures = getBlockTextures(block);
                             int slot = (face == BlockFace::LEFT) ? textures.faceSlots[2] : textures.faceSlots[3];
                             maskYZ[y * CHUNK_SIZE_Z + z] = slot;
                         }
@@ -1746,7 +1760,7 @@ private:
 
         // AO and light (0-255 range) - use defaults for greedy merged quads
         uint8_t ao = 230;   // Slightly darker than max (0.9 * 255)
-        uint8_t light = 0;  // No light for now
+        uint8_t light = FULL_SKY_LIGHT;  // No block light, open sky
 
         // Create 6 packed vertices (2 triangles)
         auto makeVertex = [&](int cornerIdx) -> PackedChunkVertex {
@@ -1783,290 +1797,6 @@ private:
         return isBlockTransparent(neighbor);
     }
 
-    // Add water block with variable height based on water level - uses world coordinates
-    // SIMPLE RULE: Only render faces at the actual boundary of the water body
-    // - TOP: render if no water above (this is the visible water surface)
-    // - SIDES: render only if neighbor is AIR (edge of water body)
-    // - BOTTOM: render only if below is AIR (rare, like floating water)
-    // - NEVER render faces between adjacent water blocks (no internal geometry)
-    // Helper to get water height at a world position for smooth interpolation
-    float getWaterHeightAt(const BlockGetter& getBlock, int wx, int wy, int wz) {
-        BlockType block = getBlock(wx, wy, wz);
-        if (block == BlockType::WATER) {
-            // Check if there's water above - if so, this is submerged (full height)
-            BlockType above = getBlock(wx, wy + 1, wz);
-            if (above == BlockType::WATER) {
-                return 1.0f;
-            }
-            return 0.875f;  // Surface water slightly below full
-        }
-        // Check if there's water below (we're above a water block)
-        BlockType below = getBlock(wx, wy - 1, wz);
-        if (below == BlockType::WATER) {
-            return 0.0f;  // Transition point
-        }
-        return -1.0f;  // No water here
-    }
-
-    void addWaterBlock(std::vector<ChunkVertex>& vertices, const Chunk& chunk,
-                       int bx, int by, int bz, const glm::vec3& pos, int textureSlot,
-                       const BlockGetter& getBlock, int wx, int wz) {
-
-        uint8_t waterLevel = chunk.getWaterLevel(bx, by, bz);
-        if (waterLevel == 0) {
-            waterLevel = WATER_SOURCE;
-        }
-
-        // Get UV coordinates
-        glm::vec4 uv = TextureAtlas::getUV(textureSlot);
-        glm::vec2 texSlotBase(uv.x, uv.y);
-
-        glm::vec3 normal;
-        float ao = 1.0f;
-        float light = 0.0f;
-
-        // Check water neighbors for smooth height interpolation
-        bool waterAbove = (by + 1 < CHUNK_SIZE_Y) && (chunk.getBlock(bx, by + 1, bz) == BlockType::WATER);
-        bool waterBelow = (by > 0) && (chunk.getBlock(bx, by - 1, bz) == BlockType::WATER);
-                (void)waterBelow; // May be used in future for water column optimization
-
-        // If water above, we're submerged - use full height
-        if (waterAbove) {
-            // Submerged water - no top face, sides go full height
-            float topY = 1.0f;
-
-            auto shouldRenderWaterSide = [&](int worldNeighborX, int worldNeighborZ) -> bool {
-                BlockType neighbor = getBlock(worldNeighborX, by, worldNeighborZ);
-                return neighbor != BlockType::WATER;
-            };
-
-            // Render side faces for submerged water
-            if (shouldRenderWaterSide(wx, wz + 1)) {
-                normal = glm::vec3(0, 0, 1);
-                glm::vec3 corners[4] = {
-                    pos + glm::vec3(0, 0, 1), pos + glm::vec3(1, 0, 1),
-                    pos + glm::vec3(1, topY, 1), pos + glm::vec3(0, topY, 1)
-                };
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            }
-            if (shouldRenderWaterSide(wx, wz - 1)) {
-                normal = glm::vec3(0, 0, -1);
-                glm::vec3 corners[4] = {
-                    pos + glm::vec3(1, 0, 0), pos + glm::vec3(0, 0, 0),
-                    pos + glm::vec3(0, topY, 0), pos + glm::vec3(1, topY, 0)
-                };
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            }
-            if (shouldRenderWaterSide(wx - 1, wz)) {
-                normal = glm::vec3(-1, 0, 0);
-                glm::vec3 corners[4] = {
-                    pos + glm::vec3(0, 0, 0), pos + glm::vec3(0, 0, 1),
-                    pos + glm::vec3(0, topY, 1), pos + glm::vec3(0, topY, 0)
-                };
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            }
-            if (shouldRenderWaterSide(wx + 1, wz)) {
-                normal = glm::vec3(1, 0, 0);
-                glm::vec3 corners[4] = {
-                    pos + glm::vec3(1, 0, 1), pos + glm::vec3(1, 0, 0),
-                    pos + glm::vec3(1, topY, 0), pos + glm::vec3(1, topY, 1)
-                };
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-                vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            }
-            return;
-        }
-
-        // ============================================
-        // SURFACE WATER - Calculate smooth sloped heights per corner
-        // ============================================
-
-        // Sample water presence at each corner and neighbors for smooth interpolation
-        // Corner order: (-X,-Z), (+X,-Z), (+X,+Z), (-X,+Z) relative to block center
-
-        // Get heights at the 4 corners by averaging neighboring blocks
-        auto getCornerHeight = [&](int cornerX, int cornerZ) -> float {
-            // cornerX/Z are 0 or 1 (local block coords)
-            // We sample the 4 blocks that share this corner
-            int worldCornerX = wx + cornerX;
-            int worldCornerZ = wz + cornerZ;
-
-            float totalHeight = 0.0f;
-            int waterCount = 0;
-            bool hasWaterBelow = false;
-
-            // Sample the 4 blocks sharing this corner
-            for (int dx = -1; dx <= 0; dx++) {
-                for (int dz = -1; dz <= 0; dz++) {
-                    int sampleX = worldCornerX + dx;
-                    int sampleZ = worldCornerZ + dz;
-
-                    BlockType block = getBlock(sampleX, by, sampleZ);
-                    if (block == BlockType::WATER) {
-                        // Check if this water has water above (submerged)
-                        BlockType above = getBlock(sampleX, by + 1, sampleZ);
-                        if (above == BlockType::WATER) {
-                            totalHeight += 1.0f;
-                        } else {
-                            totalHeight += 0.9f;  // Surface water
-                        }
-                        waterCount++;
-                    } else if (block == BlockType::AIR) {
-                        // Check if there's water below - creates slope
-                        BlockType below = getBlock(sampleX, by - 1, sampleZ);
-                        if (below == BlockType::WATER) {
-                            hasWaterBelow = true;
-                        }
-                    }
-                }
-            }
-
-            if (waterCount == 0) {
-                // No water at this corner - check if we should slope down
-                if (hasWaterBelow) {
-                    return 0.0f;  // Slope down to water below
-                }
-                return 0.9f;  // Default surface height
-            }
-
-            // Average the heights, but if some neighbors are air, blend towards lower
-            float avgHeight = totalHeight / waterCount;
-
-            // If not all 4 corners have water, slope down slightly
-            if (waterCount < 4) {
-                avgHeight = avgHeight * (0.5f + 0.5f * (waterCount / 4.0f));
-            }
-
-            return avgHeight;
-        };
-
-        // Calculate height at each corner
-        // Corners: 0=(-X,-Z), 1=(+X,-Z), 2=(+X,+Z), 3=(-X,+Z)
-        float h00 = getCornerHeight(0, 0);  // -X, -Z corner
-        float h10 = getCornerHeight(1, 0);  // +X, -Z corner
-        float h11 = getCornerHeight(1, 1);  // +X, +Z corner
-        float h01 = getCornerHeight(0, 1);  // -X, +Z corner
-
-        // Clamp heights
-        h00 = std::max(0.1f, std::min(1.0f, h00));
-        h10 = std::max(0.1f, std::min(1.0f, h10));
-        h11 = std::max(0.1f, std::min(1.0f, h11));
-        h01 = std::max(0.1f, std::min(1.0f, h01));
-
-        // Calculate normal from the slope
-        glm::vec3 v1 = glm::vec3(1, h10 - h00, 0);
-        glm::vec3 v2 = glm::vec3(0, h01 - h00, 1);
-        normal = glm::normalize(glm::cross(v2, v1));
-
-        // TOP face with smooth heights
-        glm::vec3 corners[4] = {
-            pos + glm::vec3(0, h01, 1),  // -X, +Z
-            pos + glm::vec3(1, h11, 1),  // +X, +Z
-            pos + glm::vec3(1, h10, 0),  // +X, -Z
-            pos + glm::vec3(0, h00, 0)   // -X, -Z
-        };
-
-        vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-
-        // SIDE FACES - use the sloped heights at edges
-        auto shouldRenderWaterSide = [&](int worldNeighborX, int worldNeighborZ) -> bool {
-            BlockType neighbor = getBlock(worldNeighborX, by, worldNeighborZ);
-            return neighbor != BlockType::WATER;
-        };
-
-        // Front face (+Z)
-        if (shouldRenderWaterSide(wx, wz + 1)) {
-            normal = glm::vec3(0, 0, 1);
-            glm::vec3 sideCorners[4] = {
-                pos + glm::vec3(0, 0, 1),
-                pos + glm::vec3(1, 0, 1),
-                pos + glm::vec3(1, h11, 1),
-                pos + glm::vec3(0, h01, 1)
-            };
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-        }
-
-        // Back face (-Z)
-        if (shouldRenderWaterSide(wx, wz - 1)) {
-            normal = glm::vec3(0, 0, -1);
-            glm::vec3 sideCorners[4] = {
-                pos + glm::vec3(1, 0, 0),
-                pos + glm::vec3(0, 0, 0),
-                pos + glm::vec3(0, h00, 0),
-                pos + glm::vec3(1, h10, 0)
-            };
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-        }
-
-        // Left face (-X)
-        if (shouldRenderWaterSide(wx - 1, wz)) {
-            normal = glm::vec3(-1, 0, 0);
-            glm::vec3 sideCorners[4] = {
-                pos + glm::vec3(0, 0, 0),
-                pos + glm::vec3(0, 0, 1),
-                pos + glm::vec3(0, h01, 1),
-                pos + glm::vec3(0, h00, 0)
-            };
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-        }
-
-        // Right face (+X)
-        if (shouldRenderWaterSide(wx + 1, wz)) {
-            normal = glm::vec3(1, 0, 0);
-            glm::vec3 sideCorners[4] = {
-                pos + glm::vec3(1, 0, 1),
-                pos + glm::vec3(1, 0, 0),
-                pos + glm::vec3(1, h10, 0),
-                pos + glm::vec3(1, h11, 1)
-            };
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[1], {1.0f, 1.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[2], {1.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[3], {0.0f, 0.0f}, normal, ao, light, texSlotBase });
-            vertices.push_back({ sideCorners[0], {0.0f, 1.0f}, normal, ao, light, texSlotBase });
-        }
-    }
-
     // Check if a block position is solid (for AO calculation) - world coordinates
     bool isSolidForAO(const BlockGetter& getBlock, int wx, int wy, int wz) const {
         if (wy < 0) return true;  // Below world is solid
@@ -2439,7 +2169,7 @@ private:
     }
 
     // Upload water geometry to GPU with smart buffer reuse
-    void uploadWaterToGPU(const std::vector<ChunkVertex>& vertices) {
+    void uploadWaterToGPU(const std::vector<PackedWaterVertex>& vertices) {
         if (vertices.empty()) {
             // Don't delete buffers - they might be reused
             waterVertexCount = 0;
@@ -2447,7 +2177,7 @@ private:
         }
 
         waterVertexCount = static_cast<int>(vertices.size());
-        GLsizeiptr dataSize = vertices.size() * sizeof(ChunkVertex);
+        GLsizeiptr dataSize = vertices.size() * sizeof(PackedWaterVertex);
 
         // Reuse existing buffer if data fits within capacity
         if (waterVAO != 0 && waterVBO != 0 && dataSize <= waterVboCapacity) {
@@ -2479,38 +2209,33 @@ private:
         glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, vertices.data());
         waterVboCapacity = initialCapacity;
 
-        // Position attribute (location 0)
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, position));
+        setupWaterVertexAttributes();
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+
+    // Vertex layout for PackedWaterVertex (VAO and VBO must be bound)
+    static void setupWaterVertexAttributes() {
+        // Position attribute (location 0) - uint16 * 3, scaled by 256
+        glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(PackedWaterVertex),
+                              (void*)offsetof(PackedWaterVertex, x));
         glEnableVertexAttribArray(0);
 
-        // TexCoord attribute (location 1)
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, texCoord));
+        // TexCoord attribute (location 1) - uint16 * 2, 8.8 fixed point
+        glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(PackedWaterVertex),
+                              (void*)offsetof(PackedWaterVertex, u));
         glEnableVertexAttribArray(1);
 
-        // Normal attribute (location 2)
-        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, normal));
+        // Packed data (location 2) - normalIndex, level, texSlot, flags as integers
+        glVertexAttribIPointer(2, 4, GL_UNSIGNED_BYTE, sizeof(PackedWaterVertex),
+                               (void*)offsetof(PackedWaterVertex, normalIndex));
         glEnableVertexAttribArray(2);
 
-        // AO factor attribute (location 3)
-        glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, aoFactor));
+        // Flow direction (location 3) - int8 * 2, normalized to -1..1
+        glVertexAttribPointer(3, 2, GL_BYTE, GL_TRUE, sizeof(PackedWaterVertex),
+                              (void*)offsetof(PackedWaterVertex, flowX));
         glEnableVertexAttribArray(3);
-
-        // Light level attribute (location 4)
-        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, lightLevel));
-        glEnableVertexAttribArray(4);
-
-        // Texture slot base UV attribute (location 5) - for greedy meshing tiling
-        glVertexAttribPointer(5, 2, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, texSlotBase));
-        glEnableVertexAttribArray(5);
-
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
     }
 
 public:
@@ -2803,7 +2528,7 @@ public:
     }
 
     // Upload water geometry to a specific sub-chunk
-    void uploadWaterToSubChunk(int subChunkY, const std::vector<ChunkVertex>& vertices) {
+    void uploadWaterToSubChunk(int subChunkY, const std::vector<PackedWaterVertex>& vertices) {
         if (subChunkY < 0 || subChunkY >= SUB_CHUNKS_PER_COLUMN) return;
 
         SubChunkMesh& sub = subChunks[subChunkY];
@@ -2816,7 +2541,7 @@ public:
 
         sub.hasWater = true;
         sub.waterVertexCount = static_cast<int>(vertices.size());
-        GLsizeiptr dataSize = vertices.size() * sizeof(ChunkVertex);
+        GLsizeiptr dataSize = vertices.size() * sizeof(PackedWaterVertex);
 
         // Reuse existing buffer if data fits
         if (sub.waterVAO != 0 && sub.waterVBO != 0 && dataSize <= sub.waterVboCapacity) {
@@ -2849,43 +2574,22 @@ public:
         sub.waterVboCapacity = initialCapacity;
 
         // Same layout as regular water
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, position));
-        glEnableVertexAttribArray(0);
-
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, texCoord));
-        glEnableVertexAttribArray(1);
-
-        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, normal));
-        glEnableVertexAttribArray(2);
-
-        glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, aoFactor));
-        glEnableVertexAttribArray(3);
-
-        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, lightLevel));
-        glEnableVertexAttribArray(4);
-
-        glVertexAttribPointer(5, 2, GL_FLOAT, GL_FALSE, sizeof(ChunkVertex),
-                              (void*)offsetof(ChunkVertex, texSlotBase));
-        glEnableVertexAttribArray(5);
+        setupWaterVertexAttributes();
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glBindVertexArray(0);
     }
 
     // ============================================================
-    // MESH SHADER - Meshlet Generation
+    // MESH SHADER - Meshlet Upload
     // ============================================================
 
-    // Generate meshlets from vertex data for mesh shader rendering
-    // Divides vertices into groups of up to MESHLET_MAX_VERTICES vertices
-    void generateMeshlets(int subChunkY, const std::vector<PackedChunkVertex>& vertices) {
+    // Upload meshlets built by buildMeshlets() (normally on a mesh worker)
+    // The vertex ranges are written back to back into one SSBO, matching the
+    // descriptors' vertexOffsets, so no combined CPU-side copy is needed
+    void uploadMeshletsToSubChunk(int subChunkY, const std::vector<PackedChunkVertex>* ranges, int rangeCount,
+                                  const std::vector<MeshletDescriptor>& descriptors) {
         if (subChunkY < 0 || subChunkY >= SUB_CHUNKS_PER_COLUMN) return;
-        if (vertices.empty()) return;
 
         SubChunkMesh& sub = subChunks[subChunkY];
         MeshletData& meshlets = sub.meshletData;
@@ -2897,74 +2601,27 @@ public:
             sub.vertexSSBO = 0;
         }
 
-        // Create meshlets - each holds up to MESHLET_MAX_VERTICES vertices
-        // Since we use triangle lists (non-indexed), every 3 vertices = 1 triangle
-        size_t vertexCount = vertices.size();
-        size_t triangleCount = vertexCount / 3;
+        if (descriptors.empty()) return;
+        meshlets.meshlets = descriptors;
 
-        // Calculate number of meshlets needed
-        // For non-indexed geometry: MESHLET_MAX_VERTICES vertices = MESHLET_MAX_VERTICES/3 triangles
-        size_t maxTrianglesPerMeshlet = std::min((size_t)MESHLET_MAX_TRIANGLES, (size_t)MESHLET_MAX_VERTICES / 3);
-        size_t meshletCount = (triangleCount + maxTrianglesPerMeshlet - 1) / maxTrianglesPerMeshlet;
-
-        meshlets.meshlets.reserve(meshletCount);
-
-        size_t currentVertex = 0;
-        while (currentVertex < vertexCount) {
-            MeshletDescriptor desc = {};
-
-            // Calculate vertices for this meshlet (must be multiple of 3 for triangles)
-            size_t remainingVertices = vertexCount - currentVertex;
-            size_t meshletVertices = std::min(remainingVertices, (size_t)MESHLET_MAX_VERTICES);
-            meshletVertices = (meshletVertices / 3) * 3;  // Round down to triangle boundary
-
-            if (meshletVertices == 0) break;
-
-            desc.vertexOffset = static_cast<uint32_t>(currentVertex);
-            desc.vertexCount = static_cast<uint32_t>(meshletVertices);
-            desc.triangleOffset = static_cast<uint32_t>(currentVertex / 3);
-            desc.triangleCount = static_cast<uint32_t>(meshletVertices / 3);
-
-            // Calculate bounding sphere for frustum culling
-            // Position is stored as int16 with 8.8 fixed point (multiply by 1/256 for world coords)
-            float minX = FLT_MAX, minY = FLT_MAX, minZ = FLT_MAX;
-            float maxX = -FLT_MAX, maxY = -FLT_MAX, maxZ = -FLT_MAX;
-
-            for (size_t i = 0; i < meshletVertices; i++) {
-                const PackedChunkVertex& v = vertices[currentVertex + i];
-                float x = static_cast<float>(v.x) / 256.0f;
-                float y = static_cast<float>(v.y) / 256.0f;
-                float z = static_cast<float>(v.z) / 256.0f;
-                minX = std::min(minX, x);
-                minY = std::min(minY, y);
-                minZ = std::min(minZ, z);
-                maxX = std::max(maxX, x);
-                maxY = std::max(maxY, y);
-                maxZ = std::max(maxZ, z);
-            }
-
-            // Bounding sphere center and radius
-            desc.centerX = (minX + maxX) * 0.5f;
-            desc.centerY = (minY + maxY) * 0.5f;
-            desc.centerZ = (minZ + maxZ) * 0.5f;
-
-            float dx = maxX - minX;
-            float dy = maxY - minY;
-            float dz = maxZ - minZ;
-            desc.radius = sqrtf(dx*dx + dy*dy + dz*dz) * 0.5f;
-
-            meshlets.meshlets.push_back(desc);
-            currentVertex += meshletVertices;
-        }
-
-        if (meshlets.meshlets.empty()) return;
+        size_t totalVertices = 0;
+        for (int r = 0; r < rangeCount; r++) totalVertices += ranges[r].size();
 
         // Upload vertex data to SSBO (mesh shaders read from SSBO, not VBO)
         glGenBuffers(1, &sub.vertexSSBO);
         glBindBuffer(GL_SHADER_STORAGE_BUFFER, sub.vertexSSBO);
         glBufferData(GL_SHADER_STORAGE_BUFFER,
-                     vertices.size() * sizeof(PackedChunkVertex),
-                     vertices.data(), GL_STATIC_DRAW);
+                     totalVertices * sizeof(PackedChunkVertex),
+                     nullptr, GL_STATIC_DRAW);
+        size_t offset = 0;
+        for (int r = 0; r < rangeCount; r++) {
+            if (ranges[r].empty()) continue;
+            glBufferSubData(GL_SHADER_STORAGE_BUFFER,
+                            offset * sizeof(PackedChunkVertex),
+                            ranges[r].size() * sizeof(PackedChunkVertex),
+                            ranges[r].data());
+            offset += ranges[r].size();
+        }
         glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 
         // Upload meshlet descriptors to SSBO
@@ -2978,11 +2635,4 @@ public:
         // No index SSBO needed for non-indexed triangle lists
         // Mesh shader will directly output triangles from vertex data
     }
-
-    // Public wrapper for water block generation (used by World for async mesh completion)
-    void addWaterBlockPublic(std::vector<ChunkVertex>& vertices, const Chunk& chunk,
-                             int bx, int by, int bz, const glm::vec3& pos, int textureSlot,
-                             const BlockGetter& getBlock, int wx, int wz) {
-        addWaterBlock(vertices, chunk, bx, by, bz, pos, textureSlot, getBlock, wx, wz);
-    }
 };
@@ -2314,7 +2314,9 @@ void main() {
     normalIndex = min(normalIndex, 5u);
 
     fragNormal = NORMALS[normalIndex];
-    fragAO = float(ao) / 255.0;
+    // Sky light (high nibble of the light byte) darkens faces the sky can't reach
+    float skyLight = float(inPackedData.z >> 4u) / 15.0;
+    fragAO = float(ao) / 255.0 * mix(0.05, 1.0, skyLight);
 
     // Pass through texture coordinates (fixed point 8.8 format)
     fragTexCoord = vec2(inTexCoord) / 256.0;
@@ -0,0 +1,364 @@
+#pragma once
+
+#include "../world/Chunk.h"
+#include "../world/Block.h"
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+// ============================================================================
+// GREEDY WATER MESHER
+// ============================================================================
+// Builds PackedWaterVertex geometry for water and lava in a Y range of a chunk.
+//
+// The old path emitted one 48-byte ChunkVertex quad per exposed liquid face,
+// so a 16x16 ocean surface cost 256 quads x 6 vertices x 48 bytes per layer.
+// Here every exposed face gets a key (liquid type, level, flow, full/surface
+// height) and coplanar faces with equal keys are greedy-merged into one quad.
+// Vertices are 16 bytes and carry the level and flow the water shaders use.
+//
+// Face rules match the previous worker-thread mesher:
+//   - TOP:    liquid with no liquid above (surface at WATER_SURFACE_HEIGHT)
+//   - SIDES:  neighbor is not liquid (full height if submerged)
+//   - BOTTOM: block below is neither solid nor liquid
+// ============================================================================
+
+class WaterMesher {
+public:
+    using BlockGetter = std::function<BlockType(int, int, int)>;
+
+    // Surface height in 1/256 block units (0.875 blocks, slightly below full)
+    static constexpr uint32_t WATER_SURFACE_HEIGHT = 224;
+    // Inward offset for side faces to prevent Z-fighting with adjacent solid blocks
+    static constexpr uint32_t WATER_SIDE_INSET = 1;
+    // Top faces are wave-displaced per vertex in the water shaders, so keep enough
+    // vertices on the surface for the waves (shortest wavelength is ~17 blocks)
+    static constexpr int MAX_SURFACE_MERGE = 4;
+
+    WaterMesher() {
+        m_keys.resize(CHUNK_SIZE_X * CHUNK_SIZE_Z * CHUNK_SIZE_Y, 0);
+        m_plane.resize(PLANE_WIDTH * CHUNK_SIZE_Y, 0);
+    }
+
+    // Append merged liquid quads for [yStart, yEnd] (chunk-local positions)
+    // getBlock takes world coordinates and is only used across the chunk border
+    void generateForYRange(const Chunk& chunk, const BlockGetter& getBlock,
+                           int baseX, int baseZ, int yStart, int yEnd,
+                           std::vector<PackedWaterVertex>& vertices) {
+        yStart = std::max(yStart, static_cast<int>(chunk.chunkMinY));
+        yEnd = std::min(yEnd, static_cast<int>(chunk.chunkMaxY));
+        if (yStart > yEnd) return;
+
+        m_yStart = yStart;
+        m_yRange = yEnd - yStart + 1;
+
+        if (!buildKeys(chunk)) return;
+
+        m_waterSlot = static_cast<uint8_t>(getBlockTextures(BlockType::WATER).faceSlots[0]);
+        m_lavaSlot = static_cast<uint8_t>(getBlockTextures(BlockType::LAVA).faceSlots[0]);
+
+        emitTopFaces(vertices);
+        emitBottomFaces(chunk, vertices);
+        emitSideFaces(chunk, getBlock, baseX, baseZ, vertices);
+    }
+
+private:
+    static constexpr int PLANE_WIDTH = CHUNK_SIZE_X;
+    static_assert(CHUNK_SIZE_X == CHUNK_SIZE_Z, "merge planes assume square chunk columns");
+
+    // Face key layout (0 = no face):
+    //   [0]     present
+    //   [1]     lava
+    //   [2]     full height (submerged cell, no surface)
+    //   [7:4]   level (1-8)
+    //   [15:8]  flowX (int8)
+    //   [23:16] flowZ (int8)
+    static constexpr uint32_t KEY_PRESENT = 1u << 0;
+    static constexpr uint32_t KEY_LAVA = 1u << 1;
+    static constexpr uint32_t KEY_FULL = 1u << 2;
+
+    // Per-cell keys for the range, indexed (yRel * CHUNK_SIZE_Z + z) * CHUNK_SIZE_X + x
+    std::vector<uint32_t> m_keys;
+    // Merge plane scratch, indexed row * PLANE_WIDTH + col
+    std::vector<uint32_t> m_plane;
+    int m_yStart = 0;
+    int m_yRange = 0;
+    uint8_t m_waterSlot = 0;
+    uint8_t m_lavaSlot = 0;
+
+    static bool isLiquid(BlockType block) {
+        return block == BlockType::WATER || block == BlockType::LAVA;
+    }
+
+    uint32_t keyAt(int x, int yRel, int z) const {
+        return m_keys[(yRel * CHUNK_SIZE_Z + z) * CHUNK_SIZE_X + x];
+    }
+
+    static uint8_t levelOf(const Chunk& chunk, int x, int y, int z) {
+        uint8_t level = chunk.getWaterLevel(x, y, z);
+        return level == 0 ? WATER_SOURCE : level;
+    }
+
+    // Compute the face key of every liquid cell; returns false if the range has none
+    bool buildKeys(const Chunk& chunk) {
+        static constexpr int DX[4] = {1, -1, 0, 0};
+        static constexpr int DZ[4] = {0, 0, 1, -1};
+        bool anyLiquid = false;
+
+        for (int yRel = 0; yRel < m_yRange; yRel++) {
+            int y = m_yStart + yRel;
+            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+                for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                    uint32_t& key = m_keys[(yRel * CHUNK_SIZE_Z + z) * CHUNK_SIZE_X + x];
+                    BlockType block = chunk.getBlock(x, y, z);
+                    if (!isLiquid(block)) {
+                        key = 0;
+                        continue;
+                    }
+                    anyLiquid = true;
+
+                    int level = levelOf(chunk, x, y, z);
+                    bool submerged = (y + 1 < CHUNK_SIZE_Y) && isLiquid(chunk.getBlock(x, y + 1, z));
+
+                    // Flow points downhill: toward lower-level liquid or open air in the
+                    // same layer. Neighbors in other chunks are assumed level (no flow).
+                    float flowX = 0.0f, flowZ = 0.0f;
+                    for (int d = 0; d < 4; d++) {
+                        int nx = x + DX[d];
+                        int nz = z + DZ[d];
+                        if (nx < 0 || nx >= CHUNK_SIZE_X || nz < 0 || nz >= CHUNK_SIZE_Z) continue;
+
+                        BlockType neighbor = chunk.getBlock(nx, y, nz);
+                        int neighborLevel;
+                        if (neighbor == block) {
+                            neighborLevel = levelOf(chunk, nx, y, nz);
+                        } else if (neighbor == BlockType::AIR) {
+                            neighborLevel = 0;
+                        } else {
+                            continue;
+                        }
+                        flowX += static_cast<float>(DX[d] * (level - neighborLevel));
+                        flowZ += static_cast<float>(DZ[d] * (level - neighborLevel));
+                    }
+
+                    int8_t fx = 0, fz = 0;
+                    float len = std::sqrt(flowX * flowX + flowZ * flowZ);
+                    if (len > 0.0f) {
+                        fx = static_cast<int8_t>(std::lround(flowX / len * 127.0f));
+                        fz = static_cast<int8_t>(std::lround(flowZ / len * 127.0f));
+                    }
+
+                    key = KEY_PRESENT
+                        | (block == BlockType::LAVA ? KEY_LAVA : 0u)
+                        | (submerged ? KEY_FULL : 0u)
+                        | (static_cast<uint32_t>(level) << 4)
+                        | (static_cast<uint32_t>(static_cast<uint8_t>(fx)) << 8)
+                        | (static_cast<uint32_t>(static_cast<uint8_t>(fz)) << 16);
+                }
+            }
+        }
+        return anyLiquid;
+    }
+
+    // Greedy merge over m_plane (rows x PLANE_WIDTH), emitting (col, row, w, h, key)
+    // Cells are merged only when their keys are identical
+    template <typename Emit>
+    void greedyMergePlane(int rows, int maxExtent, Emit emit) {
+        for (int row = 0; row < rows; row++) {
+            uint32_t* rowKeys = &m_plane[row * PLANE_WIDTH];
+            for (int col = 0; col < PLANE_WIDTH; col++) {
+                uint32_t key = rowKeys[col];
+                if (key == 0) continue;
+
+                int width = 1;
+                while (col + width < PLANE_WIDTH && width < maxExtent &&
+                       rowKeys[col + width] == key) {
+                    width++;
+                }
+
+                int height = 1;
+                while (row + height < rows && height < maxExtent) {
+                    const uint32_t* next = &m_plane[(row + height) * PLANE_WIDTH + col];
+                    bool match = true;
+                    for (int i = 0; i < width; i++) {
+                        if (next[i] != key) { match = false; break; }
+                    }
+                    if (!match) break;
+                    height++;
+                }
+
+                for (int h = 0; h < height; h++) {
+                    std::fill_n(&m_plane[(row + h) * PLANE_WIDTH + col], width, 0u);
+                }
+                emit(col, row, width, height, key);
+            }
+        }
+    }
+
+    // Top faces (+Y): one XZ plane per layer, rows are Z, columns are X
+    void emitTopFaces(std::vector<PackedWaterVertex>& vertices) {
+        for (int yRel = 0; yRel < m_yRange; yRel++) {
+            bool any = false;
+            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+                for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                    uint32_t key = keyAt(x, yRel, z);
+                    if (key & KEY_FULL) key = 0;  // Submerged: no surface
+                    m_plane[z * PLANE_WIDTH + x] = key;
+                    any |= (key != 0);
+                }
+            }
+            if (!any) continue;
+
+            uint32_t top = static_cast<uint32_t>(m_yStart + yRel) * 256 + WATER_SURFACE_HEIGHT;
+            greedyMergePlane(CHUNK_SIZE_Z, MAX_SURFACE_MERGE,
+                [&](int x, int z, int w, int d, uint32_t key) {
+                    uint32_t x0 = x * 256, x1 = (x + w) * 256;
+                    uint32_t z0 = z * 256, z1 = (z + d) * 256;
+                    addQuad(vertices, 2, key, w, d,
+                            {x0, top, z1}, {x1, top, z1}, {x1, top, z0}, {x0, top, z0});
+                });
+        }
+    }
+
+    // Bottom faces (-Y): liquid hanging over air or other non-solid blocks
+    void emitBottomFaces(const Chunk& chunk, std::vector<PackedWaterVertex>& vertices) {
+        for (int yRel = 0; yRel < m_yRange; yRel++) {
+            int y = m_yStart + yRel;
+            if (y == 0) continue;  // Bottom of the world counts as solid
+
+            bool any = false;
+            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+                for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                    uint32_t key = keyAt(x, yRel, z);
+                    if (key != 0) {
+                        BlockType below = chunk.getBlock(x, y - 1, z);
+                        if (isBlockSolid(below) || isLiquid(below)) key = 0;
+                    }
+                    m_plane[z * PLANE_WIDTH + x] = key;
+                    any |= (key != 0);
+                }
+            }
+            if (!any) continue;
+
+            uint32_t bottom = static_cast<uint32_t>(y) * 256;
+            greedyMergePlane(CHUNK_SIZE_Z, CHUNK_SIZE_X,
+                [&](int x, int z, int w, int d, uint32_t key) {
+                    uint32_t x0 = x * 256, x1 = (x + w) * 256;
+                    uint32_t z0 = z * 256, z1 = (z + d) * 256;
+                    addQuad(vertices, 3, key, w, d,
+                            {x0, bottom, z0}, {x1, bottom, z0}, {x1, bottom, z1}, {x0, bottom, z1});
+                });
+        }
+    }
+
+    // Side faces: one vertical plane per slice, rows are Y, columns run along the face
+    void emitSideFaces(const Chunk& chunk, const BlockGetter& getBlock, int baseX, int baseZ,
+                       std::vector<PackedWaterVertex>& vertices) {
+        // normalIndex, dx, dz (same normal table as PackedChunkVertex)
+        struct SideFace { uint8_t normalIndex; int dx, dz; };
+        static constexpr SideFace SIDES[4] = {{0, 1, 0}, {1, -1, 0}, {4, 0, 1}, {5, 0, -1}};
+
+        for (const SideFace& side : SIDES) {
+            bool alongX = (side.dz != 0);  // Z-facing planes run along X
+
+            for (int slice = 0; slice < PLANE_WIDTH; slice++) {
+                bool any = false;
+                for (int yRel = 0; yRel < m_yRange; yRel++) {
+                    int y = m_yStart + yRel;
+                    for (int col = 0; col < PLANE_WIDTH; col++) {
+                        int x = alongX ? col : slice;
+                        int z = alongX ? slice : col;
+                        uint32_t key = keyAt(x, yRel, z);
+                        if (key != 0) {
+                            int nx = x + side.dx;
+                            int nz = z + side.dz;
+                            BlockType neighbor;
+                            if (nx >= 0 && nx < CHUNK_SIZE_X && nz >= 0 && nz < CHUNK_SIZE_Z) {
+                                neighbor = chunk.getBlock(nx, y, nz);
+                            } else {
+                                neighbor = getBlock(baseX + nx, y, baseZ + nz);
+                            }
+                            if (isLiquid(neighbor)) key = 0;
+                        }
+                        m_plane[yRel * PLANE_WIDTH + col] = key;
+                        any |= (key != 0);
+                    }
+                }
+                if (!any) continue;
+
+                // Plane position with a small inward inset (far side for +X/+Z)
+                bool positive = (side.dx + side.dz) > 0;
+                uint32_t planePos = positive ? (slice + 1) * 256 - WATER_SIDE_INSET
+                                             : slice * 256 + WATER_SIDE_INSET;
+
+                greedyMergePlane(m_yRange, CHUNK_SIZE_Y,
+                    [&](int col, int row, int w, int h, uint32_t key) {
+                        // Keys are uniform across the rect, so only a surface rect (h == 1)
+                        // stops below the next block
+                        uint32_t y0 = static_cast<uint32_t>(m_yStart + row) * 256;
+                        uint32_t y1 = static_cast<uint32_t>(m_yStart + row + h - 1) * 256 +
+                                      ((key & KEY_FULL) ? 256 : WATER_SURFACE_HEIGHT);
+                        uint32_t a0 = col * 256, a1 = (col + w) * 256;
+                        switch (side.normalIndex) {
+                            case 0:  // +X
+                                addQuad(vertices, 0, key, w, h,
+                                        {planePos, y0, a1}, {planePos, y0, a0},
+                                        {planePos, y1, a0}, {planePos, y1, a1});
+                                break;
+                            case 1:  // -X
+                                addQuad(vertices, 1, key, w, h,
+                                        {planePos, y0, a0}, {planePos, y0, a1},
+                                        {planePos, y1, a1}, {planePos, y1, a0});
+                                break;
+                            case 4:  // +Z
+                                addQuad(vertices, 4, key, w, h,
+                                        {a0, y0, planePos}, {a1, y0, planePos},
+                                        {a1, y1, planePos}, {a0, y1, planePos});
+                                break;
+                            default:  // -Z
+                                addQuad(vertices, 5, key, w, h,
+                                        {a1, y0, planePos}, {a0, y0, planePos},
+                                        {a0, y1, planePos}, {a1, y1, planePos});
+                                break;
+                        }
+                    });
+            }
+        }
+    }
+
+    struct Corner { uint32_t x, y, z; };
+
+    // Emit a merged quad as two triangles (0,1,2)(2,3,0); UVs tile once per block
+    void addQuad(std::vector<PackedWaterVertex>& vertices, uint8_t normalIndex, uint32_t key,
+                 int width, int height, Corner c0, Corner c1, Corner c2, Corner c3) const {
+        bool lava = (key & KEY_LAVA) != 0;
+        uint8_t level = static_cast<uint8_t>((key >> 4) & 0xF);
+        int8_t flowX = static_cast<int8_t>(static_cast<uint8_t>((key >> 8) & 0xFF));
+        int8_t flowZ = static_cast<int8_t>(static_cast<uint8_t>((key >> 16) & 0xFF));
+        uint8_t texSlot = lava ? m_lavaSlot : m_waterSlot;
+        uint8_t flags = lava ? WATER_VERTEX_LAVA : 0;
+
+        uint16_t u1 = static_cast<uint16_t>(width * 256);
+        uint16_t v1 = static_cast<uint16_t>(height * 256);
+
+        auto makeVertex = [&](const Corner& c, uint16_t u, uint16_t v) -> PackedWaterVertex {
+            return PackedWaterVertex{
+                static_cast<uint16_t>(c.x), static_cast<uint16_t>(c.y), static_cast<uint16_t>(c.z),
+                u, v,
+                normalIndex, level, texSlot, flags,
+                flowX, flowZ
+            };
+        };
+
+        PackedWaterVertex v0 = makeVertex(c0, 0, v1);
+        PackedWaterVertex v2 = makeVertex(c2, u1, 0);
+        vertices.push_back(v0);
+        vertices.push_back(makeVertex(c1, u1, v1));
+        vertices.push_back(v2);
+        vertices.push_back(v2);
+        vertices.push_back(makeVertex(c3, 0, 0));
+        vertices.push_back(v0);
+    }
+};
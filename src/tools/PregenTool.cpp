@@ -0,0 +1,232 @@
+// ============================================================================
+// HEADLESS WORLD PREGENERATION
+// ============================================================================
+// Generates a square region of chunks on every core and streams them straight
+// into a world folder in the regular save format, without a window or GL
+// context. The client picks the chunks up through its disk cache.
+//
+// Usage:
+//   VoxelPregen --world <name> [--seed <seed>] [--preset <name>] [--radius <chunks>]
+//               [--threads <n>] [--center <chunkX> <chunkZ>] [--out <path>] [--assets <dir>]
+//
+// Every chunk is complete once generated (cross-chunk features are
+// re-evaluated by each chunk they reach), so a worker saves and frees it right
+// away. Memory stays proportional to the thread count, not to the region.
+// ============================================================================
+
+#include "world/Chunk.h"
+#include "world/TerrainGenerator.h"
+#include "world/WorldPresets.h"
+#include "world/WorldSaveLoad.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace {
+
+struct PregenOptions {
+    std::string worldName = "Pregenerated World";
+    std::string outPath;           // Empty = new folder under saves/
+    std::string seed;              // Empty = random
+    std::string preset = "default";
+    std::string assetsPath = "assets";
+    int radius = 32;
+    int threads = 0;               // 0 = all cores
+    glm::ivec2 center{0, 0};
+};
+
+void printUsage() {
+    std::cout << "Usage: VoxelPregen --world <name> [--seed <seed>] [--preset <name>] [--radius <chunks>]\n"
+              << "                   [--threads <n>] [--center <chunkX> <chunkZ>] [--out <path>] [--assets <dir>]\n";
+}
+
+bool parseArgs(int argc, char** argv, PregenOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto next = [&](std::string& value) {
+            if (i + 1 >= argc) return false;
+            value = argv[++i];
+            return true;
+        };
+
+        std::string value;
+        if (arg == "--help" || arg == "-h") {
+            return false;
+        } else if (arg == "--world" && next(value)) {
+            options.worldName = value;
+        } else if (arg == "--out" && next(value)) {
+            options.outPath = value;
+        } else if (arg == "--seed" && next(value)) {
+            options.seed = value;
+        } else if (arg == "--preset" && next(value)) {
+            options.preset = value;
+        } else if (arg == "--assets" && next(value)) {
+            options.assetsPath = value;
+        } else if (arg == "--radius" && next(value)) {
+            options.radius = std::max(0, std::atoi(value.c_str()));
+        } else if (arg == "--threads" && next(value)) {
+            options.threads = std::max(0, std::atoi(value.c_str()));
+        } else if (arg == "--center" && i + 2 < argc) {
+            options.center.x = std::atoi(argv[++i]);
+            options.center.y = std::atoi(argv[++i]);
+        } else {
+            std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Same spiral order as World::buildPregenerationQueue (spawn area first)
+std::vector<glm::ivec2> buildSpiral(glm::ivec2 center, int radius) {
+    std::vector<glm::ivec2> queue;
+    queue.reserve(static_cast<size_t>(2 * radius + 1) * (2 * radius + 1));
+    queue.push_back(center);
+    for (int ring = 1; ring <= radius; ring++) {
+        for (int x = -ring; x <= ring; x++) queue.push_back(center + glm::ivec2(x, -ring));
+        for (int z = -ring + 1; z < ring; z++) queue.push_back(center + glm::ivec2(ring, z));
+        for (int x = ring; x >= -ring; x--) queue.push_back(center + glm::ivec2(x, ring));
+        for (int z = ring - 1; z > -ring; z--) queue.push_back(center + glm::ivec2(-ring, z));
+    }
+    return queue;
+}
+
+class Pregenerator {
+public:
+    Pregenerator(const PregenOptions& options, int seed, const WorldSettings& settings, std::string worldPath)
+        : options(options), seed(seed), settings(settings), worldPath(std::move(worldPath)) {
+        queue = buildSpiral(options.center, options.radius);
+    }
+
+    void run(int threadCount) {
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threadCount; i++) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+
+        // Progress reporting from the main thread
+        size_t total = queue.size();
+        size_t lastGenerated = 0;
+        auto lastReport = start;
+        while (generatedCount.load() < total) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            auto now = std::chrono::steady_clock::now();
+            float sinceReport = std::chrono::duration<float>(now - lastReport).count();
+            if (sinceReport < 1.0f && generatedCount.load() < total) continue;
+
+            size_t generated = generatedCount.load();
+            float elapsed = std::chrono::duration<float>(now - start).count();
+            float rate = static_cast<float>(generated - lastGenerated) / sinceReport;
+            float average = elapsed > 0.0f ? static_cast<float>(generated) / elapsed : 0.0f;
+            float eta = average > 0.0f ? static_cast<float>(total - generated) / average : 0.0f;
+            std::cout << "[Pregen] " << generated << "/" << total
+                      << " (" << std::fixed << std::setprecision(1) << (100.0f * generated / total) << "%)"
+                      << "  " << std::setprecision(0) << rate << " chunks/s"
+                      << "  saved " << savedCount.load()
+                      << "  ETA " << eta << "s" << std::endl;
+            lastGenerated = generated;
+            lastReport = now;
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[Pregen] Done: " << total << " chunks in " << std::setprecision(1) << elapsed << "s ("
+                  << std::setprecision(0) << (elapsed > 0.0f ? total / elapsed : 0.0f) << " chunks/s, "
+                  << threadCount << " threads)" << std::endl;
+        if (failedSaves.load() > 0) {
+            std::cerr << "[Pregen] " << failedSaves.load() << " chunks failed to save" << std::endl;
+        }
+    }
+
+private:
+    const PregenOptions& options;
+    int seed;
+    WorldSettings settings;
+    std::string worldPath;
+
+    std::vector<glm::ivec2> queue;
+    std::atomic<size_t> nextIndex{0};
+    std::atomic<size_t> generatedCount{0};
+    std::atomic<size_t> savedCount{0};
+    std::atomic<size_t> failedSaves{0};
+
+    void workerLoop() {
+        TerrainGenerator generator(seed);
+        generator.maxHeight = settings.maxYHeight;
+        generator.caveSampling = settings.caveSampling;
+
+        while (true) {
+            size_t index = nextIndex.fetch_add(1);
+            if (index >= queue.size()) break;
+            glm::ivec2 pos = queue[index];
+
+            auto chunk = std::make_unique<Chunk>(pos);
+            generator.generateChunk(*chunk);
+            generatedCount++;
+
+            if (WorldSaveLoad::saveChunk(worldPath, *chunk)) {
+                savedCount++;
+            } else {
+                failedSaves++;
+            }
+        }
+    }
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    PregenOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    PresetManager::init(options.assetsPath);
+    GenerationPreset preset = PresetManager::loadFromFile(options.preset);
+
+    WorldSettings settings;
+    settings.worldName = options.worldName;
+    settings.seed = options.seed;
+    settings.computeSeed();
+    preset.applyToSettings(settings);
+    int seed = static_cast<int>(settings.seedValue & 0x7FFFFFFF);  // Same derivation as the client
+
+    std::string worldPath = options.outPath;
+    if (worldPath.empty()) {
+        worldPath = WorldSaveLoad::createWorldFolder(options.worldName);
+    } else {
+        std::filesystem::create_directories(worldPath + "/region");
+    }
+    if (!WorldSaveLoad::saveWorldMeta(worldPath, settings.worldName, seed,
+                                      static_cast<int>(settings.generationType), settings.maxYHeight,
+                                      static_cast<int>(settings.caveSampling))) {
+        return 1;
+    }
+
+    int threads = options.threads > 0 ? options.threads
+                                      : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    int diameter = options.radius * 2 + 1;
+    std::cout << "[Pregen] World '" << settings.worldName << "' -> " << worldPath << std::endl;
+    std::cout << "[Pregen] Seed " << seed << ", preset " << options.preset
+              << ", cave sampling " << getCaveSamplingName(settings.caveSampling) << std::endl;
+    std::cout << "[Pregen] Radius " << options.radius << " around (" << options.center.x << ", "
+              << options.center.y << "): " << diameter * diameter << " chunks on " << threads << " threads"
+              << std::endl;
+
+    Pregenerator pregenerator(options, seed, settings, worldPath);
+    pregenerator.run(threads);
+    return 0;
+}
@@ -765,7 +765,7 @@ private:
 
         if (stack.isBlock()) {
             // Render block from block atlas using top face
-            BlockTextures tex = getBlockTextures(stack.blockType);
+            const BlockTextures& tex = getBlockTextures(stack.blockType);
             int slot = tex.faceSlots[4];  // Top face
             glm::vec4 uv = TextureAtlas::getUV(slot);
             drawTextureRegion(textureAtlas, iconX, iconY, iconSize, iconSize,
@@ -794,7 +794,7 @@ private:
         if (type == BlockType::AIR || textureAtlas == 0) return;
 
         // Get texture UV from atlas (use top face for icon)
-        BlockTextures tex = getBlockTextures(type);
+        const BlockTextures& tex = getBlockTextures(type);
         int slot = tex.faceSlots[4];  // Top face
 
         glm::vec4 uv = TextureAtlas::getUV(slot);
@@ -104,7 +104,7 @@ public:
             // Skip non-obtainable blocks
             if (bt == BlockType::BEDROCK) continue;
 
-            BlockTextures tex = getBlockTextures(bt);
+            const BlockTextures& tex = getBlockTextures(bt);
             std::string name = getBlockName(bt);
             items.emplace_back(bt, name, tex.faceSlots[4]);  // Top face
         }
@@ -242,7 +242,7 @@ public:
         if (item.isEmpty()) return;
 
         if (item.isBlock) {
-            BlockTextures tex = getBlockTextures(item.blockType);
+            const BlockTextures& tex = getBlockTextures(item.blockType);
             int slot = tex.faceSlots[4];  // Top face
             glm::vec4 uv = TextureAtlas::getUV(slot);
             drawTextureRegion(textureAtlas, x, y, size, size, uv.x, uv.y, uv.z - uv.x, uv.w - uv.y);
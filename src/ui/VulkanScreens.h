@@ -19,6 +19,7 @@ struct VulkanSavedWorldInfo {
     int seed = 0;
     int generationType = 0;
     int maxHeight = 256;
+    int caveSampling = 0;  // Missing in older world.meta files = per-voxel caves
     time_t lastPlayed = 0;
     std::string lastPlayedStr;
     bool isValid = false;
@@ -161,6 +162,7 @@ public:
                                 else if (key == "seed") info.seed = std::stoi(value);
                                 else if (key == "generationType") info.generationType = std::stoi(value);
                                 else if (key == "maxHeight") info.maxHeight = std::stoi(value);
+                                else if (key == "caveSampling") info.caveSampling = std::stoi(value);
                                 else if (key == "lastPlayed") info.lastPlayed = std::stoll(value);
                             }
                         }
@@ -335,6 +335,7 @@ public:
         preset.name = presetNameInput.text;
         preset.description = "Custom preset";
         preset.type = settings.generationType;
+        preset.caveSampling = settings.caveSampling;
         preset.baseHeight = settings.baseHeight;
         preset.seaLevel = settings.seaLevel;
         preset.maxHeight = settings.maxYHeight;
@@ -3,6 +3,12 @@
 #include <glm/glm.hpp>
 #include <cstdint>
 #include <array>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
 
 // Forward declarations for tool system
 enum class ToolCategory : uint8_t;
@@ -47,356 +53,426 @@ enum class BlockFace : uint8_t {
     BOTTOM      // -Y
 };
 
-// Block properties
-struct BlockProperties {
-    bool isSolid;       // Does it block movement/visibility?
-    bool isTransparent; // Can you see through it?
-    bool isLiquid;      // Is it a fluid?
+// Block drop: a block or an item (ItemType id from Item.h)
+struct BlockDrop {
+    bool isItem;       // true = item drop, false = block drop
+    int typeId;        // BlockType or ItemType cast to int
+    int count;         // How many drop
+
+    BlockDrop() : isItem(false), typeId(0), count(0) {}
+    BlockDrop(BlockType block, int cnt = 1) : isItem(false), typeId(static_cast<int>(block)), count(cnt) {}
+
+    // For item drops - use ItemType values directly
+    static BlockDrop item(int itemTypeId, int cnt = 1) {
+        BlockDrop d;
+        d.isItem = true;
+        d.typeId = itemTypeId;
+        d.count = cnt;
+        return d;
+    }
+
+    bool isEmpty() const { return count <= 0 || typeId == 0; }
+};
 
-    // Colors per face (temporary until we add textures)
-    // Order: front, back, left, right, top, bottom
-    std::array<glm::vec3, 6> faceColors;
+// Texture slots in the atlas
+// Order: front, back, left, right, top, bottom
+struct BlockTextures {
+    std::array<int, 6> faceSlots;
+};
+
+// ============================================================================
+// BLOCK REGISTRY
+// ============================================================================
+// Every block's properties, compiled from definitions into flat tables
+// indexed by block id. The hot queries (isBlockSolid, getBlockTextures...)
+// run per voxel and per face in meshing, lighting, water and collision, so
+// each one is a single indexed load. Tables have 256 entries, so any byte is
+// a valid id; ids without a definition read as plain solid stone-textured
+// blocks.
+//
+// The built-in definitions below can be overridden from a data file with
+// loadFromFile() (assets/blocks.cfg), one [section] per block name:
+//
+//   [glowstone]
+//   solid=true            # Blocks movement
+//   transparent=false     # Can be seen through
+//   liquid=false
+//   occluding=true        # Hides the faces of blocks next to it
+//   textures=22           # One slot, or six: front,back,left,right,top,bottom
+//   hardness=0.4          # Seconds to mine by hand, -1 = unbreakable
+//   emission=1.0          # Glow strength 0-1
+//   tool=pickaxe          # none/pickaxe/axe/shovel/hoe/sword/shears
+//   minTier=none          # none/wood/stone/iron/gold/diamond/never
+//   drop=self             # self/none/<block name>/item:<ItemType id>
+//   dropCount=1           # After a block or item drop
+//
+// Load the file once at startup, before any world threads run; the tables
+// are read without locking.
+// ============================================================================
+
+// Flag bits in BlockRegistry::flags
+constexpr uint8_t BLOCK_FLAG_SOLID       = 1 << 0;
+constexpr uint8_t BLOCK_FLAG_TRANSPARENT = 1 << 1;
+constexpr uint8_t BLOCK_FLAG_LIQUID      = 1 << 2;
+constexpr uint8_t BLOCK_FLAG_OCCLUDING   = 1 << 3;
+constexpr uint8_t BLOCK_FLAG_EMISSIVE    = 1 << 4;  // Derived: emission > 0
+constexpr uint8_t BLOCK_FLAG_BREAKABLE   = 1 << 5;  // Derived: hardness >= 0 and not air
+
+// Minimum tool tier for blocks that never drop anything
+constexpr int BLOCK_TIER_NEVER = 99;
+
+// One block's properties, as written in code or in the data file
+struct BlockDefinition {
+    std::string name;                                   // Section name in the data file
+    uint8_t flags = BLOCK_FLAG_SOLID | BLOCK_FLAG_OCCLUDING;
+    BlockTextures textures{{0, 0, 0, 0, 0, 0}};
+    float hardness = 1.0f;
+    float emission = 0.0f;
+    int toolCategory = 0;                               // ToolCategory as int (0 = any tool)
+    int minToolTier = 0;                                // ToolTier as int (0 = hand works)
+    bool dropsSelf = true;                              // Otherwise `drop` is used
+    BlockDrop drop;
 };
 
-// Get properties for a block type
-inline BlockProperties getBlockProperties(BlockType type) {
-    switch (type) {
-        case BlockType::AIR:
-            return { false, true, false, {} };
-
-        case BlockType::STONE:
-            return { true, false, false, {{
-                {0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f},
-                {0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f},
-                {0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f}
-            }}};
-
-        case BlockType::DIRT:
-            return { true, false, false, {{
-                {0.55f, 0.35f, 0.2f}, {0.55f, 0.35f, 0.2f},
-                {0.55f, 0.35f, 0.2f}, {0.55f, 0.35f, 0.2f},
-                {0.55f, 0.35f, 0.2f}, {0.55f, 0.35f, 0.2f}
-            }}};
-
-        case BlockType::GRASS:
-            return { true, false, false, {{
-                {0.55f, 0.35f, 0.2f}, {0.55f, 0.35f, 0.2f},  // Front/back (dirt)
-                {0.55f, 0.35f, 0.2f}, {0.55f, 0.35f, 0.2f},  // Left/right (dirt)
-                {0.3f, 0.7f, 0.2f},   {0.55f, 0.35f, 0.2f}   // Top (grass) / bottom (dirt)
-            }}};
-
-        case BlockType::COBBLESTONE:
-            return { true, false, false, {{
-                {0.4f, 0.4f, 0.4f}, {0.4f, 0.4f, 0.4f},
-                {0.4f, 0.4f, 0.4f}, {0.4f, 0.4f, 0.4f},
-                {0.4f, 0.4f, 0.4f}, {0.4f, 0.4f, 0.4f}
-            }}};
-
-        case BlockType::WOOD_PLANKS:
-            return { true, false, false, {{
-                {0.7f, 0.5f, 0.3f}, {0.7f, 0.5f, 0.3f},
-                {0.7f, 0.5f, 0.3f}, {0.7f, 0.5f, 0.3f},
-                {0.7f, 0.5f, 0.3f}, {0.7f, 0.5f, 0.3f}
-            }}};
-
-        case BlockType::WOOD_LOG:
-            return { true, false, false, {{
-                {0.4f, 0.3f, 0.2f}, {0.4f, 0.3f, 0.2f},  // Bark sides
-                {0.4f, 0.3f, 0.2f}, {0.4f, 0.3f, 0.2f},
-                {0.6f, 0.5f, 0.3f}, {0.6f, 0.5f, 0.3f}   // Top/bottom rings
-            }}};
-
-        case BlockType::LEAVES:
-            return { true, true, false, {{
-                {0.2f, 0.5f, 0.1f}, {0.2f, 0.5f, 0.1f},
-                {0.2f, 0.5f, 0.1f}, {0.2f, 0.5f, 0.1f},
-                {0.2f, 0.5f, 0.1f}, {0.2f, 0.5f, 0.1f}
-            }}};
-
-        case BlockType::SAND:
-            return { true, false, false, {{
-                {0.9f, 0.85f, 0.6f}, {0.9f, 0.85f, 0.6f},
-                {0.9f, 0.85f, 0.6f}, {0.9f, 0.85f, 0.6f},
-                {0.9f, 0.85f, 0.6f}, {0.9f, 0.85f, 0.6f}
-            }}};
-
-        case BlockType::GRAVEL:
-            return { true, false, false, {{
-                {0.55f, 0.52f, 0.5f}, {0.55f, 0.52f, 0.5f},
-                {0.55f, 0.52f, 0.5f}, {0.55f, 0.52f, 0.5f},
-                {0.55f, 0.52f, 0.5f}, {0.55f, 0.52f, 0.5f}
-            }}};
-
-        case BlockType::WATER:
-            return { false, true, true, {{
-                {0.2f, 0.4f, 0.8f}, {0.2f, 0.4f, 0.8f},
-                {0.2f, 0.4f, 0.8f}, {0.2f, 0.4f, 0.8f},
-                {0.2f, 0.4f, 0.8f}, {0.2f, 0.4f, 0.8f}
-            }}};
-
-        case BlockType::BEDROCK:
-            return { true, false, false, {{
-                {0.2f, 0.2f, 0.2f}, {0.2f, 0.2f, 0.2f},
-                {0.2f, 0.2f, 0.2f}, {0.2f, 0.2f, 0.2f},
-                {0.2f, 0.2f, 0.2f}, {0.2f, 0.2f, 0.2f}
-            }}};
-
-        case BlockType::COAL_ORE:
-            return { true, false, false, {{
-                {0.4f, 0.4f, 0.4f}, {0.4f, 0.4f, 0.4f},
-                {0.4f, 0.4f, 0.4f}, {0.4f, 0.4f, 0.4f},
-                {0.4f, 0.4f, 0.4f}, {0.4f, 0.4f, 0.4f}
-            }}};
-
-        case BlockType::IRON_ORE:
-            return { true, false, false, {{
-                {0.6f, 0.55f, 0.5f}, {0.6f, 0.55f, 0.5f},
-                {0.6f, 0.55f, 0.5f}, {0.6f, 0.55f, 0.5f},
-                {0.6f, 0.55f, 0.5f}, {0.6f, 0.55f, 0.5f}
-            }}};
-
-        case BlockType::GOLD_ORE:
-            return { true, false, false, {{
-                {0.8f, 0.7f, 0.3f}, {0.8f, 0.7f, 0.3f},
-                {0.8f, 0.7f, 0.3f}, {0.8f, 0.7f, 0.3f},
-                {0.8f, 0.7f, 0.3f}, {0.8f, 0.7f, 0.3f}
-            }}};
-
-        case BlockType::DIAMOND_ORE:
-            return { true, false, false, {{
-                {0.4f, 0.8f, 0.9f}, {0.4f, 0.8f, 0.9f},
-                {0.4f, 0.8f, 0.9f}, {0.4f, 0.8f, 0.9f},
-                {0.4f, 0.8f, 0.9f}, {0.4f, 0.8f, 0.9f}
-            }}};
-
-        case BlockType::GLASS:
-            return { true, true, false, {{
-                {0.8f, 0.9f, 0.95f}, {0.8f, 0.9f, 0.95f},
-                {0.8f, 0.9f, 0.95f}, {0.8f, 0.9f, 0.95f},
-                {0.8f, 0.9f, 0.95f}, {0.8f, 0.9f, 0.95f}
-            }}};
-
-        case BlockType::BRICK:
-            return { true, false, false, {{
-                {0.7f, 0.35f, 0.3f}, {0.7f, 0.35f, 0.3f},
-                {0.7f, 0.35f, 0.3f}, {0.7f, 0.35f, 0.3f},
-                {0.7f, 0.35f, 0.3f}, {0.7f, 0.35f, 0.3f}
-            }}};
-
-        case BlockType::SNOW_BLOCK:
-            return { true, false, false, {{
-                {0.95f, 0.97f, 1.0f}, {0.95f, 0.97f, 1.0f},
-                {0.95f, 0.97f, 1.0f}, {0.95f, 0.97f, 1.0f},
-                {0.95f, 0.97f, 1.0f}, {0.95f, 0.97f, 1.0f}
-            }}};
-
-        case BlockType::CACTUS:
-            return { true, false, false, {{
-                {0.2f, 0.5f, 0.2f}, {0.2f, 0.5f, 0.2f},
-                {0.2f, 0.5f, 0.2f}, {0.2f, 0.5f, 0.2f},
-                {0.25f, 0.55f, 0.2f}, {0.25f, 0.55f, 0.2f}
-            }}};
-
-        case BlockType::GLOWSTONE:
-            return { true, false, false, {{
-                {1.0f, 0.9f, 0.5f}, {1.0f, 0.9f, 0.5f},
-                {1.0f, 0.9f, 0.5f}, {1.0f, 0.9f, 0.5f},
-                {1.0f, 0.9f, 0.5f}, {1.0f, 0.9f, 0.5f}
-            }}};
-
-        case BlockType::LAVA:
-            return { false, true, true, {{
-                {1.0f, 0.4f, 0.1f}, {1.0f, 0.4f, 0.1f},
-                {1.0f, 0.4f, 0.1f}, {1.0f, 0.4f, 0.1f},
-                {1.0f, 0.4f, 0.1f}, {1.0f, 0.4f, 0.1f}
-            }}};
-
-        case BlockType::CRAFTING_TABLE:
-            return { true, false, false, {{
-                {0.55f, 0.35f, 0.2f}, {0.55f, 0.35f, 0.2f},  // Front/Back (side)
-                {0.55f, 0.35f, 0.2f}, {0.55f, 0.35f, 0.2f},  // Left/Right (side)
-                {0.45f, 0.3f, 0.15f}, {0.5f, 0.32f, 0.18f}   // Top (crafting grid) / Bottom
-            }}};
-
-        default:
-            return { true, false, false, {{
-                {1.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f},
-                {1.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f},
-                {1.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f}
-            }}}; // Magenta for missing
+class BlockRegistry {
+public:
+    static constexpr int TABLE_SIZE = 256;
+    static_assert(static_cast<int>(BlockType::COUNT) <= TABLE_SIZE, "block ids are one byte");
+
+    // Compiled tables, indexed by block id (read directly by the inline helpers below)
+    std::array<uint8_t, TABLE_SIZE> flags;
+    std::array<BlockTextures, TABLE_SIZE> textures;
+    std::array<float, TABLE_SIZE> hardness;
+    std::array<float, TABLE_SIZE> emission;
+    std::array<uint8_t, TABLE_SIZE> lightEmission;     // emission as a 0-15 light level
+    std::array<uint8_t, TABLE_SIZE> toolCategory;
+    std::array<uint8_t, TABLE_SIZE> minToolTier;
+    std::array<BlockDrop, TABLE_SIZE> drops;
+
+    BlockRegistry() {
+        for (int id = 0; id < TABLE_SIZE; id++) {
+            definitions[id].name = "block_" + std::to_string(id);
+            compile(id);
+        }
+        defineBuiltins();
     }
+
+    // Replace a block's definition and recompile its table entries
+    void define(BlockType type, const BlockDefinition& definition) {
+        int id = static_cast<int>(type);
+        definitions[id] = definition;
+        compile(id);
+    }
+
+    const BlockDefinition& getDefinition(BlockType type) const {
+        return definitions[static_cast<uint8_t>(type)];
+    }
+
+    // Block id for a definition name; false if no block has that name
+    bool findByName(const std::string& name, BlockType& out) const {
+        for (int id = 0; id < static_cast<int>(BlockType::COUNT); id++) {
+            if (definitions[id].name == name) {
+                out = static_cast<BlockType>(id);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Override definitions from a data file (format above). Keys a section
+    // doesn't mention keep their current value. Returns false if the file
+    // couldn't be opened; bad lines are reported and skipped.
+    bool loadFromFile(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            std::cout << "No block definition file found, using built-in blocks" << std::endl;
+            return false;
+        }
+
+        BlockDefinition* current = nullptr;
+        int currentId = -1;
+        int lineNumber = 0;
+        int defined = 0;
+        std::string line;
+
+        auto finishSection = [&]() {
+            if (current) {
+                compile(currentId);
+                defined++;
+            }
+        };
+
+        while (std::getline(file, line)) {
+            lineNumber++;
+            line = trim(line.substr(0, line.find('#')));
+            if (line.empty()) continue;
+
+            if (line.front() == '[' && line.back() == ']') {
+                finishSection();
+                std::string name = trim(line.substr(1, line.size() - 2));
+                BlockType type;
+                if (findByName(name, type)) {
+                    currentId = static_cast<int>(type);
+                    current = &definitions[currentId];
+                } else {
+                    std::cout << filename << ":" << lineNumber << ": unknown block '" << name << "'" << std::endl;
+                    current = nullptr;
+                }
+                continue;
+            }
+            if (!current) continue;
+
+            size_t eq = line.find('=');
+            if (eq == std::string::npos || !applyKey(*current, trim(line.substr(0, eq)), trim(line.substr(eq + 1)))) {
+                std::cout << filename << ":" << lineNumber << ": ignored '" << line << "'" << std::endl;
+            }
+        }
+        finishSection();
+
+        std::cout << "Loaded " << defined << " block definitions from " << filename << std::endl;
+        return true;
+    }
+
+private:
+    std::array<BlockDefinition, TABLE_SIZE> definitions;
+
+    // Build one id's table entries from its definition
+    void compile(int id) {
+        const BlockDefinition& def = definitions[id];
+        BlockType type = static_cast<BlockType>(id);
+
+        uint8_t f = def.flags & (BLOCK_FLAG_SOLID | BLOCK_FLAG_TRANSPARENT | BLOCK_FLAG_LIQUID | BLOCK_FLAG_OCCLUDING);
+        if (def.emission > 0.0f) f |= BLOCK_FLAG_EMISSIVE;
+        if (def.hardness >= 0.0f && type != BlockType::AIR) f |= BLOCK_FLAG_BREAKABLE;
+
+        flags[id] = f;
+        textures[id] = def.textures;
+        hardness[id] = def.hardness;
+        emission[id] = def.emission;
+        lightEmission[id] = static_cast<uint8_t>(std::clamp(def.emission, 0.0f, 1.0f) * 15.0f);
+        toolCategory[id] = static_cast<uint8_t>(def.toolCategory);
+        minToolTier[id] = static_cast<uint8_t>(def.minToolTier);
+        drops[id] = def.dropsSelf ? BlockDrop(type, 1) : def.drop;
+    }
+
+    void defineBuiltins() {
+        constexpr uint8_t SOLID = BLOCK_FLAG_SOLID | BLOCK_FLAG_OCCLUDING;
+        constexpr uint8_t SEE_THROUGH = BLOCK_FLAG_SOLID | BLOCK_FLAG_TRANSPARENT;
+        constexpr uint8_t FLUID = BLOCK_FLAG_TRANSPARENT | BLOCK_FLAG_LIQUID;
+        constexpr int NONE = 0, PICKAXE = 1, AXE = 2, SHOVEL = 3, SWORD = 5, SHEARS = 6;  // ToolCategory
+        constexpr int STONE_TIER = 2, IRON_TIER = 3;                                     // ToolTier
+
+        auto def = [this](BlockType type, const char* name, uint8_t flags, BlockTextures textures,
+                          float hardness, int tool, int minTier) -> BlockDefinition& {
+            BlockDefinition& d = definitions[static_cast<int>(type)];
+            d = BlockDefinition{};
+            d.name = name;
+            d.flags = flags;
+            d.textures = textures;
+            d.hardness = hardness;
+            d.toolCategory = tool;
+            d.minToolTier = minTier;
+            return d;
+        };
+        auto dropNothing = [](BlockDefinition& d) { d.dropsSelf = false; d.drop = BlockDrop(); };
+        auto dropBlock = [](BlockDefinition& d, BlockType block) { d.dropsSelf = false; d.drop = BlockDrop(block, 1); };
+        auto dropItem = [](BlockDefinition& d, int item) { d.dropsSelf = false; d.drop = BlockDrop::item(item, 1); };
+
+        def(BlockType::AIR,          "air",          BLOCK_FLAG_TRANSPARENT, {{0, 0, 0, 0, 0, 0}}, 0.0f, NONE, 0);
+        dropBlock(def(BlockType::STONE, "stone",     SOLID, {{0, 0, 0, 0, 0, 0}}, 2.0f, PICKAXE, 0), BlockType::COBBLESTONE);
+        def(BlockType::DIRT,         "dirt",         SOLID, {{1, 1, 1, 1, 1, 1}}, 0.6f, SHOVEL, 0);
+        dropBlock(def(BlockType::GRASS, "grass",     SOLID, {{3, 3, 3, 3, 2, 1}}, 0.7f, SHOVEL, 0), BlockType::DIRT);
+        def(BlockType::COBBLESTONE,  "cobblestone",  SOLID, {{4, 4, 4, 4, 4, 4}}, 2.5f, PICKAXE, 0);
+        def(BlockType::WOOD_PLANKS,  "wood_planks",  SOLID, {{5, 5, 5, 5, 5, 5}}, 1.2f, AXE, 0);
+        def(BlockType::WOOD_LOG,     "wood_log",     SOLID, {{6, 6, 6, 6, 7, 7}}, 1.5f, AXE, 0);
+        dropNothing(def(BlockType::LEAVES, "leaves", SEE_THROUGH, {{8, 8, 8, 8, 8, 8}}, 0.3f, SHEARS, 0));
+        def(BlockType::SAND,         "sand",         SOLID, {{9, 9, 9, 9, 9, 9}}, 0.6f, SHOVEL, 0);
+        def(BlockType::GRAVEL,       "gravel",       SOLID, {{10, 10, 10, 10, 10, 10}}, 0.7f, SHOVEL, 0);
+        dropNothing(def(BlockType::WATER, "water",   FLUID, {{11, 11, 11, 11, 11, 11}}, -1.0f, NONE, BLOCK_TIER_NEVER));
+        dropNothing(def(BlockType::BEDROCK, "bedrock", SOLID, {{12, 12, 12, 12, 12, 12}}, -1.0f, PICKAXE, BLOCK_TIER_NEVER));
+        dropItem(def(BlockType::COAL_ORE, "coal_ore", SOLID, {{13, 13, 13, 13, 13, 13}}, 2.5f, PICKAXE, 0), 101);  // COAL
+        def(BlockType::IRON_ORE,     "iron_ore",     SOLID, {{14, 14, 14, 14, 14, 14}}, 3.0f, PICKAXE, STONE_TIER);
+        def(BlockType::GOLD_ORE,     "gold_ore",     SOLID, {{15, 15, 15, 15, 15, 15}}, 3.5f, PICKAXE, IRON_TIER);
+        dropItem(def(BlockType::DIAMOND_ORE, "diamond_ore", SOLID, {{16, 16, 16, 16, 16, 16}}, 4.0f, PICKAXE, IRON_TIER), 105);  // DIAMOND
+        dropNothing(def(BlockType::GLASS, "glass",   SEE_THROUGH, {{17, 17, 17, 17, 17, 17}}, 0.4f, NONE, 0));
+        def(BlockType::BRICK,        "brick",        SOLID, {{18, 18, 18, 18, 18, 18}}, 2.5f, PICKAXE, 0);
+        def(BlockType::SNOW_BLOCK,   "snow_block",   SOLID, {{19, 19, 19, 19, 19, 19}}, 0.3f, SHOVEL, 0);
+        def(BlockType::CACTUS,       "cactus",       SOLID, {{20, 20, 20, 20, 21, 21}}, 0.5f, SWORD, 0);
+        def(BlockType::GLOWSTONE,    "glowstone",    SOLID, {{22, 22, 22, 22, 22, 22}}, 0.4f, PICKAXE, 0).emission = 1.0f;
+        // Lava hides the faces next to it (unlike water)
+        BlockDefinition& lava = def(BlockType::LAVA, "lava", FLUID | BLOCK_FLAG_OCCLUDING,
+                                    {{23, 23, 23, 23, 23, 23}}, -1.0f, NONE, BLOCK_TIER_NEVER);
+        lava.emission = 0.9f;
+        dropNothing(lava);
+        def(BlockType::CRAFTING_TABLE, "crafting_table", SOLID, {{0, 0, 0, 0, 0, 0}}, 1.0f, AXE, 0);
+
+        for (int id = 0; id < static_cast<int>(BlockType::COUNT); id++) compile(id);
+    }
+
+    bool applyKey(BlockDefinition& def, const std::string& key, const std::string& value) {
+        try {
+            if (key == "solid") return setFlag(def, BLOCK_FLAG_SOLID, value);
+            if (key == "transparent") return setFlag(def, BLOCK_FLAG_TRANSPARENT, value);
+            if (key == "liquid") return setFlag(def, BLOCK_FLAG_LIQUID, value);
+            if (key == "occluding") return setFlag(def, BLOCK_FLAG_OCCLUDING, value);
+            if (key == "hardness") { def.hardness = std::stof(value); return true; }
+            if (key == "emission") { def.emission = std::stof(value); return true; }
+            if (key == "textures") return parseTextures(def.textures, value);
+            if (key == "tool") return parseName(value, TOOL_NAMES, def.toolCategory);
+            if (key == "minTier") {
+                if (value == "never") { def.minToolTier = BLOCK_TIER_NEVER; return true; }
+                return parseName(value, TIER_NAMES, def.minToolTier);
+            }
+            if (key == "dropCount") {
+                if (def.dropsSelf) return false;
+                def.drop.count = std::stoi(value);
+                return true;
+            }
+            if (key == "drop") return parseDrop(def, value);
+        } catch (...) {
+            return false;  // Bad number
+        }
+        return false;
+    }
+
+    static bool setFlag(BlockDefinition& def, uint8_t flag, const std::string& value) {
+        if (value != "true" && value != "false") return false;
+        if (value == "true") def.flags |= flag;
+        else def.flags &= static_cast<uint8_t>(~flag);
+        return true;
+    }
+
+    static bool parseTextures(BlockTextures& out, const std::string& value) {
+        std::vector<int> slots;
+        std::stringstream stream(value);
+        std::string item;
+        while (std::getline(stream, item, ',')) slots.push_back(std::stoi(item));
+        if (slots.size() == 1) slots.resize(6, slots[0]);
+        if (slots.size() != 6) return false;
+        std::copy(slots.begin(), slots.end(), out.faceSlots.begin());
+        return true;
+    }
+
+    static constexpr const char* TOOL_NAMES[] = {"none", "pickaxe", "axe", "shovel", "hoe", "sword", "shears"};
+    static constexpr const char* TIER_NAMES[] = {"none", "wood", "stone", "iron", "gold", "diamond"};
+
+    template<size_t N>
+    static bool parseName(const std::string& value, const char* const (&names)[N], int& out) {
+        for (size_t i = 0; i < N; i++) {
+            if (value == names[i]) {
+                out = static_cast<int>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool parseDrop(BlockDefinition& def, const std::string& value) const {
+        if (value == "self") {
+            def.dropsSelf = true;
+            return true;
+        }
+        if (value == "none") {
+            def.dropsSelf = false;
+            def.drop = BlockDrop();
+            return true;
+        }
+        if (value.compare(0, 5, "item:") == 0) {
+            def.dropsSelf = false;
+            def.drop = BlockDrop::item(std::stoi(value.substr(5)), 1);
+            return true;
+        }
+        BlockType block;
+        if (!findByName(value, block)) return false;
+        def.dropsSelf = false;
+        def.drop = BlockDrop(block, 1);
+        return true;
+    }
+
+    static std::string trim(const std::string& text) {
+        size_t begin = text.find_first_not_of(" \t\r");
+        if (begin == std::string::npos) return "";
+        size_t end = text.find_last_not_of(" \t\r");
+        return text.substr(begin, end - begin + 1);
+    }
+};
+
+inline BlockRegistry g_blockRegistry;
+
+// ==================== BLOCK QUERIES ====================
+// Table lookups into g_blockRegistry
+
+inline uint8_t getBlockFlags(BlockType type) {
+    return g_blockRegistry.flags[static_cast<uint8_t>(type)];
 }
 
 // Helper to check if block is solid
 inline bool isBlockSolid(BlockType type) {
-    return getBlockProperties(type).isSolid;
+    return (getBlockFlags(type) & BLOCK_FLAG_SOLID) != 0;
 }
 
 // Helper to check if block is transparent
 inline bool isBlockTransparent(BlockType type) {
-    return getBlockProperties(type).isTransparent;
+    return (getBlockFlags(type) & BLOCK_FLAG_TRANSPARENT) != 0;
+}
+
+// Helper to check if block is a fluid
+inline bool isBlockLiquid(BlockType type) {
+    return (getBlockFlags(type) & BLOCK_FLAG_LIQUID) != 0;
+}
+
+// Helper to check if block is a full occluder (hides the faces of blocks next to it)
+// Shared by the mesher's face culling and the chunk section summaries
+inline bool isBlockOccluding(BlockType type) {
+    return (getBlockFlags(type) & BLOCK_FLAG_OCCLUDING) != 0;
 }
 
 // Helper to check if block is emissive (glows)
 inline bool isBlockEmissive(BlockType type) {
-    return type == BlockType::GLOWSTONE || type == BlockType::LAVA;
+    return (getBlockFlags(type) & BLOCK_FLAG_EMISSIVE) != 0;
 }
 
 // Get emission strength for emissive blocks (0-1)
 inline float getBlockEmission(BlockType type) {
-    switch (type) {
-        case BlockType::GLOWSTONE: return 1.0f;
-        case BlockType::LAVA: return 0.9f;
-        default: return 0.0f;
-    }
+    return g_blockRegistry.emission[static_cast<uint8_t>(type)];
+}
+
+// Light level an emissive block gives off (0-15)
+inline uint8_t getBlockLightEmission(BlockType type) {
+    return g_blockRegistry.lightEmission[static_cast<uint8_t>(type)];
 }
 
 // Get block hardness (time in seconds to mine with bare hands)
 // -1 means unbreakable (bedrock)
 inline float getBlockHardness(BlockType type) {
-    switch (type) {
-        case BlockType::AIR:           return 0.0f;
-        case BlockType::BEDROCK:       return -1.0f;  // Unbreakable
-        case BlockType::WATER:         return -1.0f;  // Can't mine water
-        case BlockType::LAVA:          return -1.0f;  // Can't mine lava
-
-        // Instant/very fast
-        case BlockType::LEAVES:        return 0.3f;
-        case BlockType::GLASS:         return 0.4f;
-        case BlockType::GLOWSTONE:     return 0.4f;
-
-        // Soft blocks
-        case BlockType::DIRT:          return 0.6f;
-        case BlockType::GRASS:         return 0.7f;
-        case BlockType::SAND:          return 0.6f;
-        case BlockType::GRAVEL:        return 0.7f;
-        case BlockType::SNOW_BLOCK:    return 0.3f;
-
-        // Wood
-        case BlockType::WOOD_LOG:      return 1.5f;
-        case BlockType::WOOD_PLANKS:   return 1.2f;
-        case BlockType::CRAFTING_TABLE: return 1.0f;
-        case BlockType::CACTUS:        return 0.5f;
-
-        // Stone/ores (slower without pickaxe)
-        case BlockType::STONE:         return 2.0f;
-        case BlockType::COBBLESTONE:   return 2.5f;
-        case BlockType::BRICK:         return 2.5f;
-        case BlockType::COAL_ORE:      return 2.5f;
-        case BlockType::IRON_ORE:      return 3.0f;
-        case BlockType::GOLD_ORE:      return 3.5f;
-        case BlockType::DIAMOND_ORE:   return 4.0f;
-
-        default:                       return 1.0f;
-    }
-}
-
-// Get what block type drops when mined
-// Returns AIR if the block drops nothing
-inline BlockType getBlockDrop(BlockType type) {
-    switch (type) {
-        case BlockType::STONE:         return BlockType::COBBLESTONE;  // Stone drops cobblestone
-        case BlockType::GRASS:         return BlockType::DIRT;         // Grass drops dirt
-        case BlockType::LEAVES:        return BlockType::AIR;          // Leaves drop nothing (no saplings yet)
-        case BlockType::GLASS:         return BlockType::AIR;          // Glass breaks, drops nothing
-
-        // Ores drop themselves (would drop items like coal/diamonds with proper item system)
-        case BlockType::COAL_ORE:      return BlockType::COAL_ORE;
-        case BlockType::IRON_ORE:      return BlockType::IRON_ORE;
-        case BlockType::GOLD_ORE:      return BlockType::GOLD_ORE;
-        case BlockType::DIAMOND_ORE:   return BlockType::DIAMOND_ORE;
-
-        // Unbreakable blocks drop nothing
-        case BlockType::BEDROCK:       return BlockType::AIR;
-        case BlockType::WATER:         return BlockType::AIR;
-        case BlockType::LAVA:          return BlockType::AIR;
-
-        // Everything else drops itself
-        default:                       return type;
-    }
+    return g_blockRegistry.hardness[static_cast<uint8_t>(type)];
 }
 
 // Check if a block can be broken in survival
 inline bool isBlockBreakable(BlockType type) {
-    float hardness = getBlockHardness(type);
-    return hardness >= 0.0f && type != BlockType::AIR;
+    return (getBlockFlags(type) & BLOCK_FLAG_BREAKABLE) != 0;
 }
 
-// ==================== TOOL INTEGRATION ====================
-// These functions require Item.h to be included for full functionality
-// Forward-declared enums allow this header to compile standalone
+// Get texture slots for a block type
+inline const BlockTextures& getBlockTextures(BlockType type) {
+    return g_blockRegistry.textures[static_cast<uint8_t>(type)];
+}
 
+// ==================== TOOL INTEGRATION ====================
 // Note: ToolCategory and ToolTier are defined in Item.h
 // NONE = 0, PICKAXE = 1, AXE = 2, SHOVEL = 3, HOE = 4, SWORD = 5, SHEARS = 6
 
 // Get what tool type is most effective for this block
+// Returns integer matching ToolCategory enum (0 = any tool works equally)
 inline int getEffectiveToolCategory(BlockType type) {
-    // Returns integer matching ToolCategory enum
-    // 0=NONE, 1=PICKAXE, 2=AXE, 3=SHOVEL, 4=HOE, 5=SWORD, 6=SHEARS
-    switch (type) {
-        // Pickaxe blocks (stone, ores, brick)
-        case BlockType::STONE:
-        case BlockType::COBBLESTONE:
-        case BlockType::COAL_ORE:
-        case BlockType::IRON_ORE:
-        case BlockType::GOLD_ORE:
-        case BlockType::DIAMOND_ORE:
-        case BlockType::BRICK:
-        case BlockType::BEDROCK:
-        case BlockType::GLOWSTONE:
-            return 1;  // PICKAXE
-
-        // Axe blocks (wood)
-        case BlockType::WOOD_LOG:
-        case BlockType::WOOD_PLANKS:
-        case BlockType::CRAFTING_TABLE:
-            return 2;  // AXE
-
-        // Shovel blocks (soft ground)
-        case BlockType::DIRT:
-        case BlockType::GRASS:
-        case BlockType::SAND:
-        case BlockType::GRAVEL:
-        case BlockType::SNOW_BLOCK:
-            return 3;  // SHOVEL
-
-        // Shears effective
-        case BlockType::LEAVES:
-            return 6;  // SHEARS
-
-        // Sword effective
-        case BlockType::CACTUS:
-            return 5;  // SWORD
-
-        default:
-            return 0;  // NONE - any tool works equally
-    }
+    return g_blockRegistry.toolCategory[static_cast<uint8_t>(type)];
 }
 
 // Get minimum tool tier required to harvest this block (get drops)
 // Returns integer matching ToolTier enum
-// 0=NONE (hand works), 1=WOOD, 2=STONE, 3=IRON, 4=GOLD, 5=DIAMOND
+// 0=NONE (hand works), 1=WOOD, 2=STONE, 3=IRON, 4=GOLD, 5=DIAMOND, 99=never
 inline int getMinimumToolTier(BlockType type) {
-    switch (type) {
-        // Stone tier required
-        case BlockType::IRON_ORE:
-            return 2;  // STONE
-
-        // Iron tier required
-        case BlockType::GOLD_ORE:
-        case BlockType::DIAMOND_ORE:
-            return 3;  // IRON
-
-        // These drop nothing regardless of tool
-        case BlockType::BEDROCK:
-        case BlockType::WATER:
-        case BlockType::LAVA:
-            return 99;  // Unharvestabl
-
-        // Everything else can be harvested by hand
-        default:
-            return 0;  // NONE - hand works
-    }
+    return g_blockRegistry.minToolTier[static_cast<uint8_t>(type)];
 }
 
 // Check if a block will drop items with the given tool
@@ -409,7 +485,7 @@ inline bool canHarvestBlock(BlockType block, int toolCategory, int toolTier) {
     if (requiredTier == 0) return true;
 
     // If block is unharvestable (bedrock, etc.)
-    if (requiredTier >= 99) return false;
+    if (requiredTier >= BLOCK_TIER_NEVER) return false;
 
     // If block requires specific tool category
     if (requiredCategory != 0) {
@@ -429,145 +505,16 @@ inline bool isCorrectToolForBlock(BlockType block, int toolCategory) {
 }
 
 // ==================== ITEM DROP SYSTEM ====================
-// Structure to represent what drops from a block
-struct BlockDrop {
-    bool isItem;       // true = item drop, false = block drop
-    int typeId;        // BlockType or ItemType cast to int
-    int count;         // How many drop
-
-    BlockDrop() : isItem(false), typeId(0), count(0) {}
-    BlockDrop(BlockType block, int cnt = 1) : isItem(false), typeId(static_cast<int>(block)), count(cnt) {}
-
-    // For item drops - use ItemType values directly
-    static BlockDrop item(int itemTypeId, int cnt = 1) {
-        BlockDrop d;
-        d.isItem = true;
-        d.typeId = itemTypeId;
-        d.count = cnt;
-        return d;
-    }
-
-    bool isEmpty() const { return count <= 0 || typeId == 0; }
-};
 
 // Get what a block drops when mined (supports both block and item drops)
-// ItemType values: COAL=101, DIAMOND=105 (from Item.h)
-inline BlockDrop getBlockDropNew(BlockType type) {
-    switch (type) {
-        case BlockType::STONE:
-            return BlockDrop(BlockType::COBBLESTONE, 1);
-
-        case BlockType::GRASS:
-            return BlockDrop(BlockType::DIRT, 1);
-
-        case BlockType::LEAVES:
-            return BlockDrop();  // Nothing (could add sapling chance)
-
-        case BlockType::GLASS:
-            return BlockDrop();  // Glass breaks
-
-        // Ores that drop items
-        case BlockType::COAL_ORE:
-            return BlockDrop::item(101, 1);  // COAL = 101
-
-        case BlockType::DIAMOND_ORE:
-            return BlockDrop::item(105, 1);  // DIAMOND = 105
-
-        // Ores that drop themselves (need smelting)
-        case BlockType::IRON_ORE:
-            return BlockDrop(BlockType::IRON_ORE, 1);
-
-        case BlockType::GOLD_ORE:
-            return BlockDrop(BlockType::GOLD_ORE, 1);
-
-        // Unbreakable blocks
-        case BlockType::BEDROCK:
-        case BlockType::WATER:
-        case BlockType::LAVA:
-            return BlockDrop();
-
-        // Everything else drops itself
-        default:
-            return BlockDrop(type, 1);
-    }
+inline const BlockDrop& getBlockDropNew(BlockType type) {
+    return g_blockRegistry.drops[static_cast<uint8_t>(type)];
 }
 
-// Texture slots in the atlas
-// Order: front, back, left, right, top, bottom
-struct BlockTextures {
-    std::array<int, 6> faceSlots;
-};
-
-// Get texture slots for a block type
-inline BlockTextures getBlockTextures(BlockType type) {
-    switch (type) {
-        case BlockType::AIR:
-            return {{ 0, 0, 0, 0, 0, 0 }};
-
-        case BlockType::STONE:
-            return {{ 0, 0, 0, 0, 0, 0 }};  // Stone texture
-
-        case BlockType::DIRT:
-            return {{ 1, 1, 1, 1, 1, 1 }};  // Dirt texture
-
-        case BlockType::GRASS:
-            return {{ 3, 3, 3, 3, 2, 1 }};  // Side, side, side, side, grass top, dirt bottom
-
-        case BlockType::COBBLESTONE:
-            return {{ 4, 4, 4, 4, 4, 4 }};  // Cobblestone
-
-        case BlockType::WOOD_PLANKS:
-            return {{ 5, 5, 5, 5, 5, 5 }};  // Planks
-
-        case BlockType::WOOD_LOG:
-            return {{ 6, 6, 6, 6, 7, 7 }};  // Bark sides, log top
-
-        case BlockType::LEAVES:
-            return {{ 8, 8, 8, 8, 8, 8 }};  // Leaves
-
-        case BlockType::SAND:
-            return {{ 9, 9, 9, 9, 9, 9 }};  // Sand
-
-        case BlockType::GRAVEL:
-            return {{ 10, 10, 10, 10, 10, 10 }};  // Gravel
-
-        case BlockType::WATER:
-            return {{ 11, 11, 11, 11, 11, 11 }};  // Water
-
-        case BlockType::BEDROCK:
-            return {{ 12, 12, 12, 12, 12, 12 }};  // Bedrock
-
-        case BlockType::COAL_ORE:
-            return {{ 13, 13, 13, 13, 13, 13 }};  // Coal ore
-
-        case BlockType::IRON_ORE:
-            return {{ 14, 14, 14, 14, 14, 14 }};  // Iron ore
-
-        case BlockType::GOLD_ORE:
-            return {{ 15, 15, 15, 15, 15, 15 }};  // Gold ore
-
-        case BlockType::DIAMOND_ORE:
-            return {{ 16, 16, 16, 16, 16, 16 }};  // Diamond ore (row 1)
-
-        case BlockType::GLASS:
-            return {{ 17, 17, 17, 17, 17, 17 }};  // Glass
-
-        case BlockType::BRICK:
-            return {{ 18, 18, 18, 18, 18, 18 }};  // Brick
-
-        case BlockType::SNOW_BLOCK:
-            return {{ 19, 19, 19, 19, 19, 19 }};  // Snow
-
-        case BlockType::CACTUS:
-            return {{ 20, 20, 20, 20, 21, 21 }};  // Cactus side, top
-
-        case BlockType::GLOWSTONE:
-            return {{ 22, 22, 22, 22, 22, 22 }};  // Glowstone
-
-        case BlockType::LAVA:
-            return {{ 23, 23, 23, 23, 23, 23 }};  // Lava
-
-        default:
-            return {{ 0, 0, 0, 0, 0, 0 }};  // Default to stone
-    }
+// Get what block type drops when mined (blocks that drop items give themselves)
+// Returns AIR if the block drops nothing
+inline BlockType getBlockDrop(BlockType type) {
+    const BlockDrop& drop = getBlockDropNew(type);
+    if (drop.isItem) return type;
+    return drop.isEmpty() ? BlockType::AIR : static_cast<BlockType>(drop.typeId);
 }
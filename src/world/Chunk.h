@@ -3,6 +3,7 @@
 #include "Block.h"
 #include <glm/glm.hpp>
 #include <array>
+#include <algorithm>
 #include <vector>
 #include <cstdint>
 
@@ -16,6 +17,52 @@ constexpr int CHUNK_VOLUME = CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z;
 constexpr uint8_t WATER_SOURCE = 8;  // Full water source block
 constexpr uint8_t WATER_MAX_SPREAD = 7;  // Max horizontal spread distance
 
+// Light: two 4-bit channels packed into one byte per voxel
+// Low nibble = block light (emissive blocks), high nibble = sky light
+constexpr uint8_t MAX_LIGHT_LEVEL = 15;
+constexpr int SKY_LIGHT_SHIFT = 4;
+constexpr uint8_t BLOCK_LIGHT_MASK = 0x0F;
+constexpr uint8_t FULL_SKY_LIGHT = MAX_LIGHT_LEVEL << SKY_LIGHT_SHIFT;  // Packed value above the world
+
+inline uint8_t packLight(uint8_t blockLight, uint8_t skyLight) {
+    return static_cast<uint8_t>((blockLight & BLOCK_LIGHT_MASK) | (skyLight << SKY_LIGHT_SHIFT));
+}
+
+// Sections: 16x16x16 vertical slices of a chunk (same size as render sub-chunks)
+constexpr int CHUNK_SECTION_HEIGHT = 16;
+constexpr int CHUNK_SECTION_COUNT = CHUNK_SIZE_Y / CHUNK_SECTION_HEIGHT;
+constexpr int CHUNK_SECTION_VOLUME = CHUNK_SIZE_X * CHUNK_SECTION_HEIGHT * CHUNK_SIZE_Z;
+constexpr int CHUNK_SECTION_FACE_AREA = 16 * 16;
+
+// Section boundary faces (same order as the mesher's face buckets)
+constexpr int SECTION_FACE_POS_X = 0;
+constexpr int SECTION_FACE_NEG_X = 1;
+constexpr int SECTION_FACE_POS_Y = 2;
+constexpr int SECTION_FACE_NEG_Y = 3;
+constexpr int SECTION_FACE_POS_Z = 4;
+constexpr int SECTION_FACE_NEG_Z = 5;
+
+// Occupancy summary for one section, kept up to date by generation and edits
+// Lets meshing and culling skip sections that are empty or buried without touching blocks
+struct SectionSummary {
+    uint16_t nonAirCount = 0;   // Blocks that aren't AIR (includes water)
+    uint16_t opaqueCount = 0;   // Blocks that occlude neighbouring faces
+    std::array<uint16_t, 6> faceOpaqueCount = {};  // Occluding blocks on each boundary layer
+
+    bool isAllAir() const { return nonAirCount == 0; }
+    bool isAllOpaque() const { return opaqueCount == CHUNK_SECTION_VOLUME; }
+    bool isFaceOpaque(int face) const { return faceOpaqueCount[face] == CHUNK_SECTION_FACE_AREA; }
+
+    // Bit f set when boundary face f is completely covered by occluding blocks
+    uint8_t opaqueFaceMask() const {
+        uint8_t mask = 0;
+        for (int f = 0; f < 6; f++) {
+            if (isFaceOpaque(f)) mask |= static_cast<uint8_t>(1u << f);
+        }
+        return mask;
+    }
+};
+
 class Chunk {
 public:
     // Chunk position in chunk coordinates (not world coordinates)
@@ -28,8 +75,8 @@ public:
     // Water level data (0 = no water, 1-7 = flowing, 8 = source)
     std::array<uint8_t, CHUNK_VOLUME> waterLevels;
 
-    // Light levels (0-15, like Minecraft)
-    // Stores block light from emissive sources (glowstone, lava, etc.)
+    // Light levels (0-15 per channel, like Minecraft), nibble-packed - see packLight()
+    // Block light from emissive sources (glowstone, lava) + sky light from the heightmap
     std::array<uint8_t, CHUNK_VOLUME> lightLevels;
 
     // Heightmap optimization: min/max Y per column to skip empty regions
@@ -46,6 +93,9 @@ public:
     uint8_t chunkMinY = 255;
     uint8_t chunkMaxY = 0;
 
+    // Per-section occupancy summaries (index = y / CHUNK_SECTION_HEIGHT)
+    std::array<SectionSummary, CHUNK_SECTION_COUNT> sections;
+
     // Mesh needs rebuilding?
     bool isDirty = true;
 
@@ -101,6 +151,7 @@ public:
         int idx = toIndex(x, y, z);
         BlockType oldType = blocks[idx];
         blocks[idx] = type;
+        updateSectionSummary(x, y, z, oldType, type);
 
         // Update heightmap
         int colIdx = x + z * CHUNK_SIZE_X;
@@ -131,6 +182,119 @@ public:
         isDirty = true;
     }
 
+    // ============================================
+    // BULK WRITES (terrain generation)
+    // These skip the per-block heightmap and section summary upkeep that
+    // setBlock does. Call finalizeBulkWrites() once after the last write.
+    // ============================================
+
+    // Fill the inclusive Y range [yMin, yMax] of one column with a block
+    void fillColumn(int x, int z, int yMin, int yMax, BlockType type) {
+        if (x < 0 || x >= CHUNK_SIZE_X || z < 0 || z >= CHUNK_SIZE_Z) return;
+        yMin = std::max(yMin, 0);
+        yMax = std::min(yMax, CHUNK_SIZE_Y - 1);
+        for (int y = yMin; y <= yMax; y++) {
+            writeBlockDeferred(toIndex(x, y, z), type);
+        }
+        if (yMin <= yMax) markBulkWrite(type);
+    }
+
+    // Write a whole column (CHUNK_SIZE_Y blocks, index = y) from a buffer
+    void writeColumn(int x, int z, const BlockType* column) {
+        int idx = toIndex(x, 0, z);
+        bool anyWater = false;
+        for (int y = 0; y < CHUNK_SIZE_Y; y++, idx += CHUNK_SIZE_X * CHUNK_SIZE_Z) {
+            writeBlockDeferred(idx, column[y]);
+            anyWater |= (column[y] == BlockType::WATER);
+        }
+        markBulkWrite(anyWater ? BlockType::WATER : BlockType::AIR);
+    }
+
+    // Copy a whole column (CHUNK_SIZE_Y blocks, index = y) into a buffer
+    void readColumn(int x, int z, BlockType* column) const {
+        int idx = toIndex(x, 0, z);
+        for (int y = 0; y < CHUNK_SIZE_Y; y++, idx += CHUNK_SIZE_X * CHUNK_SIZE_Z) {
+            column[y] = blocks[idx];
+        }
+    }
+
+    // Single scattered write (ores, leaves) without heightmap upkeep
+    void setBlockDeferred(int x, int y, int z, BlockType type) {
+        if (!isValidPosition(x, y, z)) return;
+        writeBlockDeferred(toIndex(x, y, z), type);
+        markBulkWrite(type);
+    }
+
+    // Rebuild heightmaps and section summaries after bulk writes
+    void finalizeBulkWrites() {
+        recalculateHeightmaps();
+    }
+
+    // ============================================
+    // EDIT BATCHES (WorldEditBatch -> World::applyEdits)
+    // ============================================
+
+    // One block write inside the chunk (index = toIndex(x, y, z))
+    struct BlockEdit {
+        uint16_t index;
+        BlockType type;
+    };
+
+    // Apply edits sorted by index, at most one per block, in one pass over the
+    // block array. Section summaries and water are kept up to date per block
+    // like setBlock; a column whose top or bottom block was removed is
+    // rescanned once at the end instead of once per removal. Edits that change
+    // nothing are dropped, so afterwards the list holds the applied writes.
+    void applyEdits(std::vector<BlockEdit>& edits) {
+        static_assert(CHUNK_VOLUME <= 0x10000, "BlockEdit index is 16 bits");
+
+        std::array<bool, CHUNK_SIZE_X * CHUNK_SIZE_Z> staleColumns{};
+        bool anyStale = false;
+        size_t applied = 0;
+
+        for (const BlockEdit& edit : edits) {
+            BlockType oldType = blocks[edit.index];
+            // Water over flowing water still resets it to a source
+            if (oldType == edit.type &&
+                (edit.type != BlockType::WATER || waterLevels[edit.index] == WATER_SOURCE)) {
+                continue;
+            }
+
+            int x = edit.index % CHUNK_SIZE_X;
+            int z = (edit.index / CHUNK_SIZE_X) % CHUNK_SIZE_Z;
+            int y = edit.index / (CHUNK_SIZE_X * CHUNK_SIZE_Z);
+            writeBlockDeferred(edit.index, edit.type);
+            updateSectionSummary(x, y, z, oldType, edit.type);
+            if (edit.type == BlockType::WATER) {
+                hasWaterUpdates = true;
+                hasWater = true;
+            }
+
+            // Heightmap: placements widen the column range right away
+            int colIdx = x + z * CHUNK_SIZE_X;
+            uint8_t uy = static_cast<uint8_t>(y);
+            if (edit.type != BlockType::AIR) {
+                if (uy < minY[colIdx]) minY[colIdx] = uy;
+                if (uy > maxY[colIdx]) maxY[colIdx] = uy;
+                if (uy < chunkMinY) chunkMinY = uy;
+                if (uy > chunkMaxY) chunkMaxY = uy;
+            } else if (oldType != BlockType::AIR && (uy == minY[colIdx] || uy == maxY[colIdx])) {
+                staleColumns[colIdx] = true;
+                anyStale = true;
+            }
+
+            edits[applied++] = edit;
+        }
+        edits.resize(applied);
+
+        if (anyStale) {
+            for (int colIdx = 0; colIdx < CHUNK_SIZE_X * CHUNK_SIZE_Z; colIdx++) {
+                if (staleColumns[colIdx]) recalculateColumnHeight(colIdx % CHUNK_SIZE_X, colIdx / CHUNK_SIZE_X);
+            }
+        }
+        if (applied > 0) isDirty = true;
+    }
+
     // Recalculate height for a single column
     void recalculateColumnHeight(int x, int z) {
         int colIdx = x + z * CHUNK_SIZE_X;
@@ -168,6 +332,68 @@ public:
                 if (maxY[colIdx] > chunkMaxY) chunkMaxY = maxY[colIdx];
             }
         }
+
+        recalculateSectionSummaries();
+    }
+
+    // Rebuild all section summaries from block data (after generation or loading)
+    void recalculateSectionSummaries() {
+        sections.fill(SectionSummary{});
+        for (int y = 0; y < CHUNK_SIZE_Y; y++) {
+            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+                for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                    updateSectionSummary(x, y, z, BlockType::AIR, blocks[toIndex(x, y, z)]);
+                }
+            }
+        }
+    }
+
+    // Apply a single block change to its section summary (O(1))
+    void updateSectionSummary(int x, int y, int z, BlockType oldType, BlockType newType) {
+        SectionSummary& section = sections[y / CHUNK_SECTION_HEIGHT];
+
+        bool wasFilled = oldType != BlockType::AIR;
+        bool isFilled = newType != BlockType::AIR;
+        if (wasFilled != isFilled) {
+            if (isFilled) section.nonAirCount++;
+            else section.nonAirCount--;
+        }
+
+        bool wasOpaque = isBlockOccluding(oldType);
+        bool isOpaque = isBlockOccluding(newType);
+        if (wasOpaque == isOpaque) return;
+
+        int delta = isOpaque ? 1 : -1;
+        int ly = y % CHUNK_SECTION_HEIGHT;
+        section.opaqueCount += delta;
+        if (x == CHUNK_SIZE_X - 1) section.faceOpaqueCount[SECTION_FACE_POS_X] += delta;
+        if (x == 0) section.faceOpaqueCount[SECTION_FACE_NEG_X] += delta;
+        if (ly == CHUNK_SECTION_HEIGHT - 1) section.faceOpaqueCount[SECTION_FACE_POS_Y] += delta;
+        if (ly == 0) section.faceOpaqueCount[SECTION_FACE_NEG_Y] += delta;
+        if (z == CHUNK_SIZE_Z - 1) section.faceOpaqueCount[SECTION_FACE_POS_Z] += delta;
+        if (z == 0) section.faceOpaqueCount[SECTION_FACE_NEG_Z] += delta;
+    }
+
+    // Bitmask of sections that are fully opaque and enclosed by fully opaque neighbour faces
+    // Such sections can't produce a visible face, so meshing and drawing can skip them.
+    // The bottom section is never buried (the mesher treats y < 0 as air)
+    uint16_t getBuriedSectionMask(const Chunk* negX, const Chunk* posX,
+                                  const Chunk* negZ, const Chunk* posZ) const {
+        static_assert(CHUNK_SECTION_COUNT <= 16, "buried mask is 16 bits");
+        if (!negX || !posX || !negZ || !posZ) return 0;
+
+        uint16_t mask = 0;
+        for (int s = 1; s < CHUNK_SECTION_COUNT - 1; s++) {
+            if (!sections[s].isAllOpaque()) continue;
+            if (!sections[s + 1].isFaceOpaque(SECTION_FACE_NEG_Y)) continue;
+            if (!sections[s - 1].isFaceOpaque(SECTION_FACE_POS_Y)) continue;
+            if (!posX->sections[s].isFaceOpaque(SECTION_FACE_NEG_X)) continue;
+            if (!negX->sections[s].isFaceOpaque(SECTION_FACE_POS_X)) continue;
+            if (!posZ->sections[s].isFaceOpaque(SECTION_FACE_NEG_Z)) continue;
+            if (!negZ->sections[s].isFaceOpaque(SECTION_FACE_POS_Z)) continue;
+            mask |= static_cast<uint16_t>(1u << s);
+        }
+        return mask;
     }
 
     // Get min/max Y for a column (for mesh generation optimization)
@@ -198,28 +424,56 @@ public:
         // Update block type based on water level
         if (level > 0 && blocks[idx] == BlockType::AIR) {
             blocks[idx] = BlockType::WATER;
+            updateSectionSummary(x, y, z, BlockType::AIR, BlockType::WATER);
             isDirty = true;
             hasWater = true;
         } else if (level == 0 && blocks[idx] == BlockType::WATER) {
             blocks[idx] = BlockType::AIR;
+            updateSectionSummary(x, y, z, BlockType::WATER, BlockType::AIR);
             isDirty = true;
         }
     }
 
-    // Get light level at local position
+    // Get block light level at local position
     uint8_t getLightLevel(int x, int y, int z) const {
         if (!isValidPosition(x, y, z)) {
             return 0;
         }
-        return lightLevels[toIndex(x, y, z)];
+        return lightLevels[toIndex(x, y, z)] & BLOCK_LIGHT_MASK;
     }
 
-    // Set light level at local position
+    // Set block light level at local position (sky light is kept)
     void setLightLevel(int x, int y, int z, uint8_t level) {
         if (!isValidPosition(x, y, z)) {
             return;
         }
-        lightLevels[toIndex(x, y, z)] = level;
+        uint8_t& packed = lightLevels[toIndex(x, y, z)];
+        packed = static_cast<uint8_t>((packed & ~BLOCK_LIGHT_MASK) | (level & BLOCK_LIGHT_MASK));
+    }
+
+    // Get sky light level at local position (full sky above the world)
+    uint8_t getSkyLight(int x, int y, int z) const {
+        if (!isValidPosition(x, y, z)) {
+            return y >= CHUNK_SIZE_Y ? MAX_LIGHT_LEVEL : 0;
+        }
+        return lightLevels[toIndex(x, y, z)] >> SKY_LIGHT_SHIFT;
+    }
+
+    // Set sky light level at local position (block light is kept)
+    void setSkyLight(int x, int y, int z, uint8_t level) {
+        if (!isValidPosition(x, y, z)) {
+            return;
+        }
+        uint8_t& packed = lightLevels[toIndex(x, y, z)];
+        packed = packLight(packed & BLOCK_LIGHT_MASK, level);
+    }
+
+    // Both channels as stored (what the mesher samples)
+    uint8_t getPackedLight(int x, int y, int z) const {
+        if (!isValidPosition(x, y, z)) {
+            return y >= CHUNK_SIZE_Y ? FULL_SKY_LIGHT : 0;
+        }
+        return lightLevels[toIndex(x, y, z)];
     }
 
     // Get world position of chunk origin
@@ -247,4 +501,24 @@ public:
             static_cast<int>(floor(worldPos.z / CHUNK_SIZE_Z))
         );
     }
+
+private:
+    // Block + water bookkeeping shared by the bulk writers (mirrors setBlock)
+    inline void writeBlockDeferred(int idx, BlockType type) {
+        BlockType oldType = blocks[idx];
+        blocks[idx] = type;
+        if (type == BlockType::WATER) {
+            waterLevels[idx] = WATER_SOURCE;
+        } else if (oldType == BlockType::WATER) {
+            waterLevels[idx] = 0;
+        }
+    }
+
+    inline void markBulkWrite(BlockType type) {
+        if (type == BlockType::WATER) {
+            hasWaterUpdates = true;
+            hasWater = true;
+        }
+        isDirty = true;
+    }
 };
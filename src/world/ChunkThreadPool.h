@@ -2,9 +2,11 @@
 
 #include "Chunk.h"
 #include "TerrainGenerator.h"
+#include "LightEngine.h"
 #include "Block.h"
 #include "../render/ChunkMesh.h"
 #include "../render/BinaryGreedyMesher.h"
+#include "VoxelPyramid.h"
 #include "../render/MeshOptimizer.h"
 #include <thread>
 #include <mutex>
@@ -49,7 +51,7 @@ public:
     struct MeshResult {
         glm::ivec2 position;
         glm::vec3 worldOffset;
-        bool isPriority = false;  // True for player-modified chunks (bypass processing limits)
+        bool isPriority = false;  // True for player-modified chunks (built ahead of other meshes)
 
         // Per sub-chunk mesh data with face-orientation buckets for backface culling
         struct SubChunkMeshData {
@@ -60,7 +62,10 @@ public:
             // Combined vertices for LOD levels 1+ (face culling not used for distant LODs)
             std::array<std::vector<PackedChunkVertex>, LOD_LEVELS> lodVertices;
             
-            std::vector<ChunkVertex> waterVertices;
+            std::vector<PackedWaterVertex> waterVertices;
+
+            // Meshlet descriptors over the face buckets laid out back to back (mesh shader path)
+            std::vector<MeshletDescriptor> meshlets;
             int subChunkY = 0;
             bool isEmpty = true;
             bool hasWater = false;
@@ -75,6 +80,7 @@ public:
             }
         };
         std::array<SubChunkMeshData, SUB_CHUNKS_PER_COLUMN> subChunks;
+        uint16_t sectionMask = 0xFFFF;  // Sub-chunks that were regenerated
     };
 
     // Request for mesh generation
@@ -83,11 +89,12 @@ public:
         Chunk* chunk;  // Pointer to existing chunk data
         int distanceSquared = 0;  // Distance from player (for priority ordering)
         bool isPriority = false;  // True for player-modified chunks (bypass processing limits)
+        uint16_t buriedSections = 0;  // Chunk::getBuriedSectionMask() at queue time
         // Block getters for neighbor access
         std::function<BlockType(int, int, int)> getWorldBlock;
         std::function<BlockType(int, int, int)> getWaterBlock;
         std::function<BlockType(int, int, int)> getSafeBlock;
-        std::function<uint8_t(int, int, int)> getLightLevel;
+        std::function<uint8_t(int, int, int)> getLightLevel;  // Packed block + sky light
 
         // Comparator for priority queue (priority chunks first, then lower distance)
         bool operator>(const MeshRequest& other) const {
@@ -109,6 +116,10 @@ private:
     std::mutex pendingMutex;
     std::condition_variable pendingCondition;
 
+    // Short simulation tasks (water jobs), run by the chunk threads ahead of generation
+    // Shares pendingMutex/pendingCondition with the chunk queue
+    std::queue<std::function<void()>> taskQueue;
+
     // Completed chunks ready for main thread
     std::queue<ChunkResult> completedQueue;
     std::mutex completedMutex;
@@ -130,7 +141,6 @@ private:
 
     // Control
     std::atomic<bool> running{true};
-    std::atomic<bool> fastLoadMode{true};  // Skip extra LOD levels during initial load
     int worldSeed;
     int numWorkerThreads = 0;
 
@@ -164,10 +174,6 @@ public:
 
     int getThreadCount() const { return numWorkerThreads; }
 
-    // Disable fast load mode (enables full LOD generation)
-    void setFastLoadMode(bool enabled) { fastLoadMode = enabled; }
-    bool isFastLoadMode() const { return fastLoadMode; }
-
     ~ChunkThreadPool() {
         shutdown();
     }
@@ -204,6 +210,16 @@ public:
         pendingCondition.notify_one();
     }
 
+    // Queue a short task for the chunk threads (thread-safe)
+    // Tasks run before queued generation so a busy load doesn't stall them
+    void queueTask(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            taskQueue.push(std::move(task));
+        }
+        pendingCondition.notify_one();
+    }
+
     // Check if a position is being generated
     bool isGenerating(glm::ivec2 pos) {
         std::lock_guard<std::mutex> lock(inProgressMutex);
@@ -244,6 +260,12 @@ public:
         }
     }
 
+    void setCaveSampling(CaveSampling mode) {
+        for (auto& gen : generators) {
+            gen->caveSampling = mode;
+        }
+    }
+
     // Clear all pending chunks and meshes (for world reset)
     void clearPendingChunks() {
         // Clear pending chunk queue
@@ -363,35 +385,42 @@ private:
 
         while (running) {
             glm::ivec2 pos;
+            std::function<void()> task;
 
             // Wait for work
             {
                 std::unique_lock<std::mutex> lock(pendingMutex);
                 pendingCondition.wait(lock, [this]() {
-                    return !pendingQueue.empty() || !running;
+                    return !pendingQueue.empty() || !taskQueue.empty() || !running;
                 });
 
                 if (!running && pendingQueue.empty()) {
                     break;
                 }
 
-                if (pendingQueue.empty()) {
+                if (!taskQueue.empty()) {
+                    task = std::move(taskQueue.front());
+                    taskQueue.pop();
+                } else if (pendingQueue.empty()) {
                     continue;
+                } else {
+                    pos = pendingQueue.front();
+                    pendingQueue.pop();
                 }
+            }
 
-                pos = pendingQueue.front();
-                pendingQueue.pop();
+            if (task) {
+                task();
+                continue;
             }
 
             // Generate chunk
             auto chunk = std::make_unique<Chunk>(pos);
+            // (generateChunk finalizes heightmaps and section summaries itself)
             generator->generateChunk(*chunk);
 
-            // Calculate heightmaps for optimization (skip empty Y regions)
-            chunk->recalculateHeightmaps();
-
-            // Calculate lighting (chunk-local)
-            calculateChunkLighting(*chunk, *generator);
+            // Block light from the chunk's own emitters; World floods it across seams on arrival
+            LightEngine::lightChunk(*chunk);
 
             // Add to completed queue
             {
@@ -407,72 +436,6 @@ private:
         }
     }
 
-    // Calculate lighting within a chunk (same logic as World but standalone)
-    void calculateChunkLighting(Chunk& chunk, TerrainGenerator& /*gen*/) {
-        for (int y = 0; y < CHUNK_SIZE_Y; y++) {
-            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    BlockType block = chunk.getBlock(x, y, z);
-
-                    if (isBlockEmissive(block)) {
-                        uint8_t emission = static_cast<uint8_t>(getBlockEmission(block) * 15.0f);
-                        propagateLightInChunk(chunk, x, y, z, emission);
-                    }
-                }
-            }
-        }
-    }
-
-    void propagateLightInChunk(Chunk& chunk, int startX, int startY, int startZ, uint8_t lightLevel) {
-        if (lightLevel == 0) return;
-
-        struct LightNode {
-            int x, y, z;
-            uint8_t level;
-        };
-
-        std::vector<LightNode> queue;
-        queue.reserve(256);
-        queue.push_back({startX, startY, startZ, lightLevel});
-
-        chunk.setLightLevel(startX, startY, startZ, lightLevel);
-
-        size_t head = 0;
-        while (head < queue.size()) {
-            LightNode node = queue[head++];
-
-            if (node.level <= 1) continue;
-
-            uint8_t newLevel = node.level - 1;
-
-            const int dirs[6][3] = {
-                {1, 0, 0}, {-1, 0, 0},
-                {0, 1, 0}, {0, -1, 0},
-                {0, 0, 1}, {0, 0, -1}
-            };
-
-            for (const auto& dir : dirs) {
-                int nx = node.x + dir[0];
-                int ny = node.y + dir[1];
-                int nz = node.z + dir[2];
-
-                if (nx < 0 || nx >= CHUNK_SIZE_X) continue;
-                if (ny < 0 || ny >= CHUNK_SIZE_Y) continue;
-                if (nz < 0 || nz >= CHUNK_SIZE_Z) continue;
-
-                BlockType neighbor = chunk.getBlock(nx, ny, nz);
-
-                if (!isBlockSolid(neighbor) || isBlockTransparent(neighbor)) {
-                    uint8_t currentLight = chunk.getLightLevel(nx, ny, nz);
-                    if (newLevel > currentLight) {
-                        chunk.setLightLevel(nx, ny, nz, newLevel);
-                        queue.push_back({nx, ny, nz, newLevel});
-                    }
-                }
-            }
-        }
-    }
-
     // Mesh generation worker loop
     void meshWorkerLoop() {
         while (running) {
@@ -511,7 +474,8 @@ private:
 
             // Generate sub-chunk meshes
             generateMeshData(result, *request.chunk, request.getWorldBlock,
-                           request.getWaterBlock, request.getSafeBlock, request.getLightLevel);
+                           request.getWaterBlock, request.getSafeBlock, request.getLightLevel,
+                           request.buriedSections);
 
             // Add to completed queue
             {
@@ -534,15 +498,27 @@ public:
                          const std::function<BlockType(int, int, int)>& /*getWorldBlock*/,
                          const std::function<BlockType(int, int, int)>& /*getWaterBlock*/,
                          const std::function<BlockType(int, int, int)>& getSafeBlock,
-                         const std::function<uint8_t(int, int, int)>& getLightLevel) {
+                         const std::function<uint8_t(int, int, int)>& getLightLevel,
+                         uint16_t buriedSections = 0,
+                         uint16_t sectionMask = 0xFFFF) {
 
         int baseX = chunk.position.x * CHUNK_SIZE_X;
         int baseZ = chunk.position.y * CHUNK_SIZE_Z;
 
+        thread_local BinaryGreedyMesher binaryMesher;
+        thread_local BinaryMeshResult binaryResult;
+
+        // Downsample the chunk once for all sub-chunks and LOD levels
+        thread_local VoxelPyramid pyramid;
+        pyramid.build(chunk);
+
         // Process each sub-chunk (16 blocks high)
+        // Sub-chunks outside sectionMask are left untouched; the caller keeps their old upload
+        result.sectionMask = sectionMask;
         for (int subY = 0; subY < SUB_CHUNKS_PER_COLUMN; subY++) {
             auto& subData = result.subChunks[subY];
             subData.subChunkY = subY;
+            if (!(sectionMask & (1u << subY))) continue;
 
             int yStart = subY * SUB_CHUNK_HEIGHT;
             int yEnd = yStart + SUB_CHUNK_HEIGHT - 1;
@@ -557,31 +533,25 @@ public:
                 continue;
             }
 
+            // OPTIMIZATION: Section summaries short-circuit sections that can't produce faces:
+            // all air, or fully opaque and sealed by opaque neighbour faces (deep underground)
+            // Empty sub-chunks never enter the render lists either
+            if (chunk.sections[subY].isAllAir() || (buriedSections & (1u << subY))) {
+                subData.isEmpty = true;
+                subData.hasWater = false;
+                continue;
+            }
+
             // Generate LOD 0 (full detail) using BINARY GREEDY MESHING (10-50x faster!)
             // Now with FACE-ORIENTATION BUCKETS for 35% better backface culling
-            std::vector<ChunkVertex> waterVertices;
+            std::vector<PackedWaterVertex> waterVertices;
 
             // Use binary greedy mesher for solid geometry
             {
-                thread_local BinaryGreedyMesher binaryMesher;
-                thread_local BinaryMeshResult binaryResult;
-
-                // Texture getter for binary mesher
-                auto getTexture = [](BlockType block, BGMFace face) -> int {
-                    BlockTextures textures = getBlockTextures(block);
-                    switch (face) {
-                        case BGMFace::POS_Z: return textures.faceSlots[0];  // Front
-                        case BGMFace::NEG_Z: return textures.faceSlots[1];  // Back
-                        case BGMFace::NEG_X: return textures.faceSlots[2];  // Left
-                        case BGMFace::POS_X: return textures.faceSlots[3];  // Right
-                        case BGMFace::POS_Y: return textures.faceSlots[4];  // Top
-                        case BGMFace::NEG_Y: return textures.faceSlots[5];  // Bottom
-                        default: return textures.faceSlots[0];
-                    }
-                };
-
-                binaryMesher.generateMeshForYRange(chunk, getSafeBlock, getTexture, binaryResult,
-                                                   baseX, baseZ, yStart, yEnd);
+                // Per-corner AO and smooth block light are computed inside the mesher from
+                // its padded bitmasks, so they ride along in BinaryQuad::attributes
+                binaryMesher.generateMeshForYRange(chunk, getSafeBlock, getBinaryTexture, binaryResult,
+                                                   baseX, baseZ, yStart, yEnd, getLightLevel);
 
                 // Expand to 6 face-orientation buckets for efficient backface culling
                 // Pass biome data for grass/foliage tinting
@@ -595,6 +565,12 @@ public:
                         MeshOpt::optimizeFast(subData.faceBucketVertices[bucket]);
                     }
                 }
+
+                // Cluster into meshlets here so the main thread only uploads finished buffers
+                // (must run after optimizeFast, which reorders the vertices the meshlets cover)
+                if (g_generateMeshlets) {
+                    buildMeshlets(subData.faceBucketVertices.data(), FACE_BUCKET_COUNT, subData.meshlets);
+                }
             }
 
             // Generate water/lava geometry on worker thread (not greedy meshed)
@@ -607,412 +583,53 @@ public:
                 subData.waterVertices = std::move(waterVertices);
             }
 
-            // Generate lower LOD levels for sub-chunk (skip in fast load mode)
-            if (!fastLoadMode) {
-                for (int lodLevel = 1; lodLevel < LOD_LEVELS; lodLevel++) {
-                    generateLODForRange(subData.lodVertices[lodLevel], chunk, baseX, baseZ,
-                                       lodLevel, yStart, yEnd);
-                }
+            // Generate lower LOD levels from the pyramid (cheap enough to keep on during initial load)
+            for (int lodLevel = 1; lodLevel < LOD_LEVELS; lodLevel++) {
+                generateLODForRange(subData.lodVertices[lodLevel], chunk, pyramid,
+                                    binaryMesher, binaryResult, lodLevel, yStart, yEnd);
             }
         }
     }
 
-    // Greedy face generation for a Y range
-    void generateGreedyFacesForRange(std::vector<PackedChunkVertex>& vertices,
-                                     const Chunk& chunk, int baseX, int baseZ,
-                                     const std::function<BlockType(int, int, int)>& getSafeBlock,
-                                     const std::function<uint8_t(int, int, int)>& getLightLevel,
-                                     BlockFace face, int yStart, int yEnd) {
-
-        // Direction info for each face
-        int normalIndex = static_cast<int>(face); (void)normalIndex;
-        int dx = 0, dy = 0, dz = 0;
-
+    // Texture getter for binary mesher (maps BGMFace to faceSlots order)
+    static int getBinaryTexture(BlockType block, BGMFace face) {
+        const BlockTextures& textures = getBlockTextures(block);
         switch (face) {
-            case BlockFace::TOP:    dy = 1; break;
-            case BlockFace::BOTTOM: dy = -1; break;
-            case BlockFace::FRONT:  dz = 1; break;
-            case BlockFace::BACK:   dz = -1; break;
-            case BlockFace::RIGHT:  dx = 1; break;
-            case BlockFace::LEFT:   dx = -1; break;
-        }
-
-        // Iterate through blocks in Y range
-        for (int y = yStart; y <= yEnd; y++) {
-            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    BlockType block = chunk.getBlock(x, y, z);
-
-                    // Skip if not a solid, visible block
-                    if (block == BlockType::AIR || block == BlockType::WATER ||
-                        block == BlockType::LAVA) continue;
-
-                    // Check if face is visible
-                    int wx = baseX + x;
-                    int wz = baseZ + z;
-                    int nx = wx + dx;
-                    int ny = y + dy;
-                    int nz = wz + dz;
-
-                    // Check bounds - same as original shouldRenderFace
-                    if (ny < 0) continue;  // Don't render faces below world
-                    bool faceVisible;
-                    if (ny >= CHUNK_SIZE_Y) {
-                        faceVisible = true;  // Always render faces above world limit
-                    } else {
-                        BlockType neighbor = getSafeBlock(nx, ny, nz);
-                        faceVisible = isBlockTransparent(neighbor);
-                    }
-                    if (!faceVisible) continue;
-
-                    // Get texture and light
-                    // faceSlots order: front(0), back(1), left(2), right(3), top(4), bottom(5)
-                    int faceIndex = getFaceSlotIndex(face);
-                    int textureSlot = getBlockTextures(block).faceSlots[faceIndex];
-                    uint8_t light = getLightLevel(wx, y, wz);
-                    uint8_t ao = 255;  // No AO calculation for async (simplified)
-
-                    // Add single-block quad (no greedy merging for async - keep it simple)
-                    addPackedQuad(vertices, x, y, z, face, textureSlot, light, ao);
-                }
-            }
+            case BGMFace::POS_Z: return textures.faceSlots[0];  // Front
+            case BGMFace::NEG_Z: return textures.faceSlots[1];  // Back
+            case BGMFace::NEG_X: return textures.faceSlots[2];  // Left
+            case BGMFace::POS_X: return textures.faceSlots[3];  // Right
+            case BGMFace::POS_Y: return textures.faceSlots[4];  // Top
+            case BGMFace::NEG_Y: return textures.faceSlots[5];  // Bottom
+            default: return textures.faceSlots[0];
         }
     }
 
-    // Add a packed quad for a single face (matches ChunkMesh.h addGreedyQuad)
-    void addPackedQuad(std::vector<PackedChunkVertex>& vertices,
-                       int x, int y, int z, BlockFace face,
-                       int textureSlot, uint8_t light, uint8_t ao) {
-
-        // Normal index and corner positions - must match ChunkMesh.h exactly
-        uint8_t normalIndex;
-        std::array<std::array<int16_t, 3>, 4> corners;  // [corner][x,y,z]
-        std::array<std::array<uint16_t, 2>, 4> uvs;     // [corner][u,v]
-
-        // For single block: width=1, height=1 in greedy terms
-        switch (face) {
-            case BlockFace::TOP: { // +Y
-                normalIndex = 2;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)}
-                }};
-                uvs = {{
-                    {0, 256},
-                    {256, 256},
-                    {256, 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::BOTTOM: { // -Y
-                normalIndex = 3;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)}
-                }};
-                uvs = {{
-                    {0, 0},
-                    {256, 0},
-                    {256, 256},
-                    {0, 256}
-                }};
-                break;
-            }
-            case BlockFace::FRONT: { // +Z
-                normalIndex = 4;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + 1) * 256)}
-                }};
-                uvs = {{
-                    {0, 256},
-                    {256, 256},
-                    {256, 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::BACK: { // -Z
-                normalIndex = 5;
-                corners = {{
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)}
-                }};
-                uvs = {{
-                    {0, 256},
-                    {256, 256},
-                    {256, 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::LEFT: { // -X
-                normalIndex = 1;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)}
-                }};
-                uvs = {{
-                    {0, 256},
-                    {256, 256},
-                    {256, 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::RIGHT: { // +X
-                normalIndex = 0;
-                corners = {{
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + 1) * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + 1) * 256), static_cast<int16_t>((y + 1) * 256), static_cast<int16_t>((z + 1) * 256)}
-                }};
-                uvs = {{
-                    {0, 256},
-                    {256, 256},
-                    {256, 0},
-                    {0, 0}
-                }};
-                break;
-            }
-        }
-
-        // Create vertices for two triangles (0,1,2) and (2,3,0)
-        auto makeVertex = [&](int cornerIdx) -> PackedChunkVertex {
-            return PackedChunkVertex{
-                corners[cornerIdx][0],
-                corners[cornerIdx][1],
-                corners[cornerIdx][2],
-                uvs[cornerIdx][0],
-                uvs[cornerIdx][1],
-                normalIndex,
-                ao,
-                light,
-                static_cast<uint8_t>(textureSlot),
-                0  // padding
-            };
-        };
-
-        // Triangle 1: 0, 1, 2
-        vertices.push_back(makeVertex(0));
-        vertices.push_back(makeVertex(1));
-        vertices.push_back(makeVertex(2));
-        // Triangle 2: 2, 3, 0
-        vertices.push_back(makeVertex(2));
-        vertices.push_back(makeVertex(3));
-        vertices.push_back(makeVertex(0));
-    }
+    static_assert(VoxelPyramid::LEVEL_COUNT == LOD_LEVELS, "one pyramid level per LOD level");
 
     // Note: Water generation is handled synchronously on main thread
     // due to complexity of water levels, texture atlas lookups, etc.
 
-    // Generate LOD mesh for a Y range
+    // Generate LOD mesh for a Y range from one level of the chunk's voxel pyramid
+    // OPTIMIZATION: The pyramid is reduced once per mesh pass, and each level is meshed by
+    // the same binary greedy mesher as LOD 0 (merged quads, per-face textures, AO)
+    // instead of emitting one unmerged quad per sampled voxel.
     void generateLODForRange(std::vector<PackedChunkVertex>& vertices,
-                            const Chunk& chunk, int baseX, int baseZ,
+                            const Chunk& chunk, const VoxelPyramid& pyramid,
+                            BinaryGreedyMesher& mesher, BinaryMeshResult& meshResult,
                             int lodLevel, int yStart, int yEnd) {
-
+        vertices.clear();
         if (lodLevel <= 0 || lodLevel >= LOD_LEVELS) return;
 
-        int scale = LOD_SCALES[lodLevel];
-        vertices.reserve((yEnd - yStart + 1) * CHUNK_SIZE_X * CHUNK_SIZE_Z / (scale * scale * 2));
-
-        // Sample blocks at LOD scale
-        for (int y = yStart; y <= yEnd; y += scale) {
-            for (int z = 0; z < CHUNK_SIZE_Z; z += scale) {
-                for (int x = 0; x < CHUNK_SIZE_X; x += scale) {
-                    BlockType block = chunk.getBlock(x, y, z);
-
-                    if (block == BlockType::AIR || block == BlockType::WATER ||
-                        block == BlockType::LAVA) continue;
-
-                    // Add scaled block faces - use top texture for all faces in LOD
-                    int textureSlot = getBlockTextures(block).faceSlots[4];  // TOP = 4
-
-                    // Check each face
-                    for (int face = 0; face < 6; face++) {
-                        int dx = 0, dy = 0, dz = 0;
-                        switch (face) {
-                            case 0: dy = scale; break;
-                            case 1: dy = -1; break;
-                            case 2: dz = scale; break;
-                            case 3: dz = -1; break;
-                            case 4: dx = scale; break;
-                            case 5: dx = -1; break;
-                        }
-
-                        int nx = x + dx;
-                        int ny = y + dy;
-                        int nz = z + dz;
-
-                        // Check bounds
-                        if (ny < 0 || ny >= CHUNK_SIZE_Y) {
-                            addPackedQuadScaled(vertices, x, y, z, scale,
-                                               static_cast<BlockFace>(face), textureSlot);
-                            continue;
-                        }
-
-                        if (nx < 0 || nx >= CHUNK_SIZE_X || nz < 0 || nz >= CHUNK_SIZE_Z) {
-                            addPackedQuadScaled(vertices, x, y, z, scale,
-                                               static_cast<BlockFace>(face), textureSlot);
-                            continue;
-                        }
-
-                        BlockType neighbor = chunk.getBlock(
-                            std::min(nx, CHUNK_SIZE_X - 1),
-                            ny,
-                            std::min(nz, CHUNK_SIZE_Z - 1));
-
-                        if (!isBlockSolid(neighbor)) {
-                            addPackedQuadScaled(vertices, x, y, z, scale,
-                                               static_cast<BlockFace>(face), textureSlot);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Add a scaled packed quad for LOD (matches ChunkMesh.h addGreedyQuad with scale)
-    void addPackedQuadScaled(std::vector<PackedChunkVertex>& vertices,
-                             int x, int y, int z, int scale, BlockFace face, int textureSlot) {
-
-        uint8_t normalIndex;
-        std::array<std::array<int16_t, 3>, 4> corners;
-        std::array<std::array<uint16_t, 2>, 4> uvs;
-        int s = scale;
+        mesher.generateLODMeshForYRange(pyramid, lodLevel, getBinaryTexture, meshResult, yStart, yEnd);
+        if (meshResult.getTotalQuadCount() == 0) return;
 
-        switch (face) {
-            case BlockFace::TOP: { // +Y
-                normalIndex = 2;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>(z * 256)}
-                }};
-                uvs = {{
-                    {0, static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::BOTTOM: { // -Y
-                normalIndex = 3;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + s) * 256)}
-                }};
-                uvs = {{
-                    {0, 0},
-                    {static_cast<uint16_t>(s * 256), 0},
-                    {static_cast<uint16_t>(s * 256), static_cast<uint16_t>(s * 256)},
-                    {0, static_cast<uint16_t>(s * 256)}
-                }};
-                break;
-            }
-            case BlockFace::FRONT: { // +Z
-                normalIndex = 4;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>((z + s) * 256)}
-                }};
-                uvs = {{
-                    {0, static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::BACK: { // -Z
-                normalIndex = 5;
-                corners = {{
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>(z * 256)}
-                }};
-                uvs = {{
-                    {0, static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::LEFT: { // -X
-                normalIndex = 1;
-                corners = {{
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>(x * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>(z * 256)}
-                }};
-                uvs = {{
-                    {0, static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), 0},
-                    {0, 0}
-                }};
-                break;
-            }
-            case BlockFace::RIGHT: { // +X
-                normalIndex = 0;
-                corners = {{
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>((z + s) * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>(y * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>(z * 256)},
-                    {static_cast<int16_t>((x + s) * 256), static_cast<int16_t>((y + s) * 256), static_cast<int16_t>((z + s) * 256)}
-                }};
-                uvs = {{
-                    {0, static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), static_cast<uint16_t>(s * 256)},
-                    {static_cast<uint16_t>(s * 256), 0},
-                    {0, 0}
-                }};
-                break;
-            }
+        expandQuadsToVertices(meshResult, vertices,
+                              chunk.biomeTemperature.data(), chunk.biomeHumidity.data(),
+                              LOD_SCALES[lodLevel]);
+        if (vertices.size() >= 6) {
+            MeshOpt::optimizeFast(vertices);
         }
-
-        auto makeVertex = [&](int cornerIdx) -> PackedChunkVertex {
-            return PackedChunkVertex{
-                corners[cornerIdx][0],
-                corners[cornerIdx][1],
-                corners[cornerIdx][2],
-                uvs[cornerIdx][0],
-                uvs[cornerIdx][1],
-                normalIndex,
-                255,  // ao
-                15,   // light
-                static_cast<uint8_t>(textureSlot),
-                0     // padding
-            };
-        };
-
-        vertices.push_back(makeVertex(0));
-        vertices.push_back(makeVertex(1));
-        vertices.push_back(makeVertex(2));
-        vertices.push_back(makeVertex(2));
-        vertices.push_back(makeVertex(3));
-        vertices.push_back(makeVertex(0));
     }
 
     // ================================================================
@@ -1020,157 +637,13 @@ public:
     // ================================================================
 
     // Generate water vertices for a Y range
-    void generateWaterForRange(std::vector<ChunkVertex>& vertices,
+    // OPTIMIZATION: Greedy-merged 16-byte PackedWaterVertex quads instead of one 48-byte
+    // ChunkVertex quad per exposed face (an ocean surface layer drops from 256 quads to 16)
+    void generateWaterForRange(std::vector<PackedWaterVertex>& vertices,
                                const Chunk& chunk, int baseX, int baseZ,
                                const std::function<BlockType(int, int, int)>& getBlock,
                                int yStart, int yEnd) {
-
-        // Get water texture slot
-        int waterTextureSlot = getBlockTextures(BlockType::WATER).faceSlots[0];
-        glm::vec4 uv = TextureAtlas::getUV(waterTextureSlot);
-        glm::vec2 texSlotBase(uv.x, uv.y);
-
-        float ao = 1.0f;
-        float light = 0.0f;
-
-        // Clamp to chunk bounds
-        int effectiveMinY = std::max(yStart, static_cast<int>(chunk.chunkMinY));
-        int effectiveMaxY = std::min(yEnd, static_cast<int>(chunk.chunkMaxY));
-
-        for (int y = effectiveMinY; y <= effectiveMaxY; y++) {
-            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    BlockType block = chunk.getBlock(x, y, z);
-                    if (block != BlockType::WATER && block != BlockType::LAVA) continue;
-
-                    // Use lava texture if lava
-                    if (block == BlockType::LAVA) {
-                        int lavaSlot = getBlockTextures(BlockType::LAVA).faceSlots[0];
-                        glm::vec4 lavaUv = TextureAtlas::getUV(lavaSlot);
-                        texSlotBase = glm::vec2(lavaUv.x, lavaUv.y);
-                    }
-
-                    int wx = baseX + x;
-                    int wz = baseZ + z;
-                    glm::vec3 pos(x, y, z);
-
-                    // Check if water above (submerged)
-                    bool waterAbove = (y + 1 < CHUNK_SIZE_Y) &&
-                                     (chunk.getBlock(x, y + 1, z) == BlockType::WATER ||
-                                      chunk.getBlock(x, y + 1, z) == BlockType::LAVA);
-
-                    // Lambda to check if side should be rendered
-                    auto shouldRenderSide = [&](int nx, int nz) -> bool {
-                        BlockType neighbor = getBlock(nx, y, nz);
-                        return neighbor != BlockType::WATER && neighbor != BlockType::LAVA;
-                    };
-
-                    glm::vec3 normal;
-
-                    // Small inward offset to prevent Z-fighting with adjacent solid blocks
-                    constexpr float eps = 0.005f;
-                    constexpr float e0 = eps;        // Offset from 0
-                    constexpr float e1 = 1.0f - eps; // Offset from 1
-
-                    if (waterAbove) {
-                        // Submerged - only render sides, full height
-                        float topY = 1.0f;
-
-                        // Front (+Z) - offset z inward from 1 to e1
-                        if (shouldRenderSide(wx, wz + 1)) {
-                            normal = glm::vec3(0, 0, 1);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        0,0,e1, 1,0,e1, 1,topY,e1, 0,topY,e1);
-                        }
-                        // Back (-Z) - offset z inward from 0 to e0
-                        if (shouldRenderSide(wx, wz - 1)) {
-                            normal = glm::vec3(0, 0, -1);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        1,0,e0, 0,0,e0, 0,topY,e0, 1,topY,e0);
-                        }
-                        // Left (-X) - offset x inward from 0 to e0
-                        if (shouldRenderSide(wx - 1, wz)) {
-                            normal = glm::vec3(-1, 0, 0);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        e0,0,0, e0,0,1, e0,topY,1, e0,topY,0);
-                        }
-                        // Right (+X) - offset x inward from 1 to e1
-                        if (shouldRenderSide(wx + 1, wz)) {
-                            normal = glm::vec3(1, 0, 0);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        e1,0,1, e1,0,0, e1,topY,0, e1,topY,1);
-                        }
-                    } else {
-                        // Surface water - render top with slight lowering + sides
-                        float h = 0.875f;  // Slightly below full block
-
-                        // Top face (no offset needed - not coplanar with solid blocks)
-                        normal = glm::vec3(0, 1, 0);
-                        addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                    0,h,1, 1,h,1, 1,h,0, 0,h,0);
-
-                        // Side faces with inward offset to prevent Z-fighting
-                        if (shouldRenderSide(wx, wz + 1)) {
-                            normal = glm::vec3(0, 0, 1);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        0,0,e1, 1,0,e1, 1,h,e1, 0,h,e1);
-                        }
-                        if (shouldRenderSide(wx, wz - 1)) {
-                            normal = glm::vec3(0, 0, -1);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        1,0,e0, 0,0,e0, 0,h,e0, 1,h,e0);
-                        }
-                        if (shouldRenderSide(wx - 1, wz)) {
-                            normal = glm::vec3(-1, 0, 0);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        e0,0,0, e0,0,1, e0,h,1, e0,h,0);
-                        }
-                        if (shouldRenderSide(wx + 1, wz)) {
-                            normal = glm::vec3(1, 0, 0);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        e1,0,1, e1,0,0, e1,h,0, e1,h,1);
-                        }
-
-                        // Bottom face (if no solid block below)
-                        BlockType below = (y > 0) ? chunk.getBlock(x, y - 1, z) : BlockType::STONE;
-                        if (!isBlockSolid(below) && below != BlockType::WATER && below != BlockType::LAVA) {
-                            normal = glm::vec3(0, -1, 0);
-                            addWaterQuad(vertices, pos, normal, ao, light, texSlotBase,
-                                        0,0,0, 1,0,0, 1,0,1, 0,0,1);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Helper to add a water quad with 4 corner positions (x,y,z offsets from pos)
-    void addWaterQuad(std::vector<ChunkVertex>& vertices,
-                      const glm::vec3& pos, const glm::vec3& normal,
-                      float ao, float light, const glm::vec2& texSlotBase,
-                      float x0, float y0, float z0,
-                      float x1, float y1, float z1,
-                      float x2, float y2, float z2,
-                      float x3, float y3, float z3) {
-        glm::vec3 corners[4] = {
-            pos + glm::vec3(x0, y0, z0),
-            pos + glm::vec3(x1, y1, z1),
-            pos + glm::vec3(x2, y2, z2),
-            pos + glm::vec3(x3, y3, z3)
-        };
-
-        // UVs
-        glm::vec2 uvs[4] = {
-            glm::vec2(0.0f, 1.0f), glm::vec2(1.0f, 1.0f),
-            glm::vec2(1.0f, 0.0f), glm::vec2(0.0f, 0.0f)
-        };
-
-        // Two triangles
-        vertices.push_back({ corners[0], uvs[0], normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[1], uvs[1], normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[2], uvs[2], normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[2], uvs[2], normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[3], uvs[3], normal, ao, light, texSlotBase });
-        vertices.push_back({ corners[0], uvs[0], normal, ao, light, texSlotBase });
+        thread_local WaterMesher waterMesher;
+        waterMesher.generateForYRange(chunk, getBlock, baseX, baseZ, yStart, yEnd, vertices);
     }
 };
@@ -9,16 +9,21 @@
 #include "../render/TextureAtlas.h"
 #include "../render/ItemAtlas.h"
 #include "Block.h"
+#include "Chunk.h"
+#include "ECS.h"
+#include "EntityComponents.h"
+#include "VoxelCollision.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <vector>
 #include <random>
 #include <cmath>
-
-// Forward declaration
-class World;
+#include <algorithm>
+#include <cstdint>
+#include <optional>
 
 // ==================== DROPPED ITEM ENTITY ====================
+// One item as spawned; DroppedItemManager turns it into an entity
 struct DroppedItem {
     // Position and physics
     glm::vec3 position;
@@ -69,7 +74,28 @@ struct DroppedItem {
     }
 };
 
+// ==================== DROPPED ITEM COMPONENTS ====================
+// Item entities carry Position, Velocity and Lifetime plus these two
+struct ItemDrop {
+    ItemStack stack;
+    float pickupDelay = 0.5f;       // Can't pickup immediately after spawn
+    float mergeDelay = 0.2f;        // Delay before merging with nearby items
+    bool removed = false;           // Picked up, merged or expired; destroyed at the end of update()
+};
+
+struct ItemAnimation {
+    float rotation = 0.0f;          // Y-axis rotation (spinning)
+    float bobOffset = 0.0f;         // Vertical bob animation
+    float bobPhase = 0.0f;          // Phase offset for bob animation
+};
+
 // ==================== DROPPED ITEM MANAGER ====================
+// OPTIMIZATION: Items are entities in the shared ECS registry, so each pass
+// streams only the component arrays it uses. Timers, physics and animation
+// run as parallel systems on the chunk threads; merge and pickup query the
+// spatial index instead of checking every pair. Physics sweeps each item
+// through VoxelCollision with one collider per job, so the chunk map lock is
+// taken per chunk, not per block.
 class DroppedItemManager {
 public:
     static constexpr float GRAVITY = -20.0f;
@@ -82,19 +108,19 @@ public:
     static constexpr float PLAYER_HEIGHT = 1.8f;  // Player is ~1.8 blocks tall
     static constexpr float MERGE_RADIUS = 0.5f;
     static constexpr int MAX_DROPPED_ITEMS = 500;
+    static constexpr size_t JOB_GRAIN = 256;      // Items per parallel job
 
-    std::vector<DroppedItem> items;
+    explicit DroppedItemManager(ECS::Registry& registry) : registry(registry) {}
 
     // Spawn a dropped item at position with random velocity
     void spawnDrop(const glm::vec3& position, const ItemStack& stack) {
-        if (items.size() >= MAX_DROPPED_ITEMS) {
-            // Remove oldest item to make room
-            items.erase(items.begin());
+        if (getItemCount() >= MAX_DROPPED_ITEMS) {
+            removeOldest();
         }
 
         // Offset slightly to center of block
         glm::vec3 spawnPos = position + glm::vec3(0.5f, 0.5f, 0.5f);
-        items.push_back(DroppedItem::spawnWithVelocity(spawnPos, stack));
+        add(DroppedItem::spawnWithVelocity(spawnPos, stack));
     }
 
     // Spawn from BlockDrop
@@ -111,143 +137,122 @@ public:
         spawnDrop(blockPos, stack);
     }
 
-    // Update all dropped items
-    void update(float deltaTime, World& world, glm::vec3 playerPos, Inventory& inventory) {
-        for (auto& item : items) {
-            if (item.markedForRemoval) continue;
-
-            // Update lifetime
-            item.lifetime -= deltaTime;
-            if (item.lifetime <= 0.0f) {
-                item.markedForRemoval = true;
-                continue;
-            }
-
-            // Update pickup delay
-            if (item.pickupDelay > 0.0f) {
-                item.pickupDelay -= deltaTime;
-            }
-
-            // Update merge delay
-            if (item.mergeDelay > 0.0f) {
-                item.mergeDelay -= deltaTime;
-            }
-
-            // Apply gravity
-            if (!item.onGround) {
-                item.velocity.y += GRAVITY * deltaTime;
-            }
-
-            // Apply velocity
-            glm::vec3 newPos = item.position + item.velocity * deltaTime;
-
-            // Collision detection with world
-            updateCollision(item, newPos, world);
-
-            // Apply drag
-            item.velocity *= DRAG;
-            if (item.onGround) {
-                item.velocity.x *= GROUND_FRICTION;
-                item.velocity.z *= GROUND_FRICTION;
-            }
-
-            // Update bob animation (only when on ground or slow)
-            if (item.onGround || glm::length(item.velocity) < 0.5f) {
-                item.bobOffset = std::sin(item.bobPhase) * BOB_AMPLITUDE;
-                item.bobPhase += BOB_SPEED * deltaTime;
-                if (item.bobPhase > 6.28318f) item.bobPhase -= 6.28318f;
-            }
-
-            // Update rotation (spinning)
-            item.rotation += SPIN_SPEED * deltaTime;
-            if (item.rotation > 6.28318f) item.rotation -= 6.28318f;
+    // Create the entity for an item
+    ECS::Entity add(const DroppedItem& item) {
+        ECS::Entity entity = registry.create();
+        registry.add(entity, Position{item.position});
+        registry.add(entity, Velocity{item.velocity, item.onGround});
+        registry.add(entity, Lifetime{item.lifetime});
+        registry.add(entity, ItemDrop{item.stack, item.pickupDelay, item.mergeDelay, item.markedForRemoval});
+        registry.add(entity, ItemAnimation{item.rotation, item.bobOffset, item.bobPhase});
+        return entity;
+    }
 
-            // Check for pickup - simple 3D distance from player center
-            if (item.pickupDelay <= 0.0f) {
-                glm::vec3 playerCenter = playerPos + glm::vec3(0.0f, PLAYER_HEIGHT * 0.5f, 0.0f);
-                float dist = glm::distance(item.position, playerCenter);
+    // Update all dropped items (main thread; systems fan out to the chunk threads)
+    void update(float deltaTime, World& world, glm::vec3 playerPos, Inventory& inventory);
+
+    // Call fn(stack, rotation, renderPosition) for every live item
+    template<typename Fn>
+    void forEachItem(Fn&& fn) const {
+        registry.each<ItemDrop, Position, ItemAnimation>(
+            [&](ECS::Entity, const ItemDrop& drop, const Position& position, const ItemAnimation& animation) {
+                if (drop.removed) return;
+                fn(drop.stack, animation.rotation, position.value + glm::vec3(0.0f, animation.bobOffset, 0.0f));
+            });
+    }
 
-                if (dist < PICKUP_RADIUS) {
-                    tryPickup(item, inventory);
-                }
-            }
-        }
+    size_t getItemCount() const { return registry.pool<ItemDrop>().size(); }
+    bool empty() const { return getItemCount() == 0; }
 
-        // Merge nearby items of same type
-        mergeNearbyItems();
+    // Positions of all entities as of the last update (for ranged queries)
+    const EntitySpatialIndex& getSpatialIndex() const { return spatialIndex; }
 
-        // Remove marked items
-        items.erase(
-            std::remove_if(items.begin(), items.end(),
-                [](const DroppedItem& i) { return i.markedForRemoval; }),
-            items.end()
-        );
+    // Destroy every item entity (world switch)
+    void clear() {
+        registry.each<ItemDrop>([&](ECS::Entity entity, ItemDrop&) { registry.destroyLater(entity); });
+        registry.flushDestroyed();
     }
 
-    // Get render position (with bob offset)
-    glm::vec3 getRenderPosition(const DroppedItem& item) const {
-        return item.position + glm::vec3(0.0f, item.bobOffset, 0.0f);
+private:
+    // Per-job physics state; the collider pins the chunks around the job's first item
+    struct PhysicsJob {
+        std::optional<VoxelCollider> collider;
+    };
+
+    ECS::Registry& registry;
+    EntitySpatialIndex spatialIndex{1.0f};
+
+    static void updateCollision(Position& position, Velocity& velocity, const glm::vec3& motion,
+                                VoxelCollider& collider);
+
+    // Remove the item with the least lifetime left to make room
+    void removeOldest() {
+        ECS::Entity oldest = ECS::NullEntity;
+        float least = 0.0f;
+        registry.each<Lifetime, ItemDrop>([&](ECS::Entity entity, Lifetime& lifetime, ItemDrop&) {
+            if (oldest == ECS::NullEntity || lifetime.seconds < least) {
+                oldest = entity;
+                least = lifetime.seconds;
+            }
+        });
+        registry.destroy(oldest);
     }
 
-    size_t getItemCount() const { return items.size(); }
-
-private:
-    void updateCollision(DroppedItem& item, glm::vec3& newPos, World& world);
+    void tryPickup(ItemDrop& drop, Inventory& inventory) {
+        ItemStack& stack = drop.stack;
 
-    void tryPickup(DroppedItem& item, Inventory& inventory) {
         // Try to add to inventory
-        int originalCount = item.stack.count;
+        int originalCount = stack.count;
 
-        if (item.stack.isBlock()) {
-            int remaining = inventory.addBlock(item.stack.blockType, item.stack.count);
+        if (stack.isBlock()) {
+            int remaining = inventory.addBlock(stack.blockType, stack.count);
             if (remaining < originalCount) {
-                item.stack.count = remaining;
+                stack.count = remaining;
             }
-        } else if (item.stack.isItem()) {
-            int remaining = inventory.addItem(item.stack.itemType, item.stack.count, item.stack.durability);
+        } else if (stack.isItem()) {
+            int remaining = inventory.addItem(stack.itemType, stack.count, stack.durability);
             if (remaining < originalCount) {
-                item.stack.count = remaining;
+                stack.count = remaining;
             }
         }
 
         // If fully picked up, remove
-        if (item.stack.count <= 0) {
-            item.markedForRemoval = true;
+        if (stack.count <= 0) {
+            drop.removed = true;
         }
     }
 
+    // Merge each item with same-type items of higher id in range (index must be current)
     void mergeNearbyItems() {
-        for (size_t i = 0; i < items.size(); i++) {
-            if (items[i].markedForRemoval || items[i].mergeDelay > 0.0f) continue;
+        registry.each<ItemDrop, Position>([&](ECS::Entity entity, ItemDrop& drop, Position& position) {
+            if (drop.removed || drop.mergeDelay > 0.0f) return;
 
-            for (size_t j = i + 1; j < items.size(); j++) {
-                if (items[j].markedForRemoval || items[j].mergeDelay > 0.0f) continue;
+            spatialIndex.forEachInRadius(position.value, MERGE_RADIUS, [&](ECS::Entity otherEntity) {
+                if (otherEntity <= entity) return;
+                ItemDrop* other = registry.get<ItemDrop>(otherEntity);
+                if (!other || other->removed || other->mergeDelay > 0.0f) return;
 
                 // Check if same type and can stack
-                if (!canMerge(items[i].stack, items[j].stack)) continue;
+                if (!canMerge(drop.stack, other->stack)) return;
 
-                // Check distance
-                float dist = glm::distance(items[i].position, items[j].position);
-                if (dist > MERGE_RADIUS) continue;
-
-                // Merge j into i
-                int maxStack = items[i].stack.getMaxStackSize();
-                int space = maxStack - items[i].stack.count;
+                // Merge other into this one
+                int maxStack = drop.stack.getMaxStackSize();
+                int space = maxStack - drop.stack.count;
 
                 if (space > 0) {
-                    int toTransfer = std::min(space, items[j].stack.count);
-                    items[i].stack.count += toTransfer;
-                    items[j].stack.count -= toTransfer;
+                    int toTransfer = std::min(space, other->stack.count);
+                    drop.stack.count += toTransfer;
+                    other->stack.count -= toTransfer;
 
-                    if (items[j].stack.count <= 0) {
-                        items[j].markedForRemoval = true;
+                    if (other->stack.count <= 0) {
+                        other->removed = true;
                     }
                 }
-            }
-        }
+            });
+        });
     }
 
-    bool canMerge(const ItemStack& a, const ItemStack& b) {
+    static bool canMerge(const ItemStack& a, const ItemStack& b) {
         if (a.stackType != b.stackType) return false;
         if (a.stackType == StackType::EMPTY || b.stackType == StackType::EMPTY) return false;
 
@@ -261,57 +266,112 @@ private:
     }
 };
 
-// Collision implementation (needs World access)
-inline void DroppedItemManager::updateCollision(DroppedItem& item, glm::vec3& newPos, World& world) {
-    // Simple AABB collision - item is ~0.25 units
-    const float ITEM_SIZE = 0.25f;
-    const float ITEM_HEIGHT = 0.25f;
+inline void DroppedItemManager::update(float deltaTime, World& world, glm::vec3 playerPos, Inventory& inventory) {
+    if (empty()) return;
 
-    // Check Y collision (ground)
-    int blockY = static_cast<int>(std::floor(newPos.y - ITEM_HEIGHT));
-    int blockX = static_cast<int>(std::floor(item.position.x));
-    int blockZ = static_cast<int>(std::floor(item.position.z));
-
-    BlockType belowBlock = world.getBlock(blockX, blockY, blockZ);
-    bool solidBelow = isBlockSolid(belowBlock);
-
-    if (item.velocity.y < 0 && solidBelow) {
-        // Land on block
-        newPos.y = static_cast<float>(blockY + 1) + ITEM_HEIGHT + 0.01f;
-        item.velocity.y = 0.0f;
-        item.onGround = true;
-    } else {
-        item.onGround = false;
-    }
+    ECS::JobRunner runner = [&world](std::function<void()> job) { world.runJob(std::move(job)); };
 
-    // Check X collision
-    int newBlockX = static_cast<int>(std::floor(newPos.x));
-    if (newBlockX != blockX) {
-        BlockType sideBlock = world.getBlock(newBlockX, static_cast<int>(item.position.y), blockZ);
-        if (isBlockSolid(sideBlock)) {
-            newPos.x = item.position.x;
-            item.velocity.x = -item.velocity.x * 0.3f;
-        }
-    }
+    // Timers
+    registry.parallelEach<ItemDrop, Lifetime>(runner, JOB_GRAIN,
+        [deltaTime](ECS::Entity, ItemDrop& drop, Lifetime& lifetime) {
+            lifetime.seconds -= deltaTime;
+            if (lifetime.seconds <= 0.0f) drop.removed = true;
+            if (drop.pickupDelay > 0.0f) drop.pickupDelay -= deltaTime;
+            if (drop.mergeDelay > 0.0f) drop.mergeDelay -= deltaTime;
+        });
+
+    // Physics (the main thread is inside this call, so chunks can't change under the jobs)
+    registry.parallelEachWith<PhysicsJob, Position, Velocity, ItemDrop>(runner, JOB_GRAIN,
+        [deltaTime, &world](PhysicsJob& job, ECS::Entity, Position& position, Velocity& velocity, ItemDrop& drop) {
+            if (drop.removed) return;
+            if (!job.collider) job.collider.emplace(world, position.value);
+
+            // Apply gravity
+            if (!velocity.onGround) {
+                velocity.value.y += GRAVITY * deltaTime;
+            }
+
+            // Apply velocity, then collide with the world
+            updateCollision(position, velocity, velocity.value * deltaTime, *job.collider);
+
+            // Apply drag
+            velocity.value *= DRAG;
+            if (velocity.onGround) {
+                velocity.value.x *= GROUND_FRICTION;
+                velocity.value.z *= GROUND_FRICTION;
+            }
+        });
+
+    // Animation
+    registry.parallelEach<ItemAnimation, Velocity>(runner, JOB_GRAIN,
+        [deltaTime](ECS::Entity, ItemAnimation& animation, Velocity& velocity) {
+            // Bob only when on ground or slow
+            if (velocity.onGround || glm::dot(velocity.value, velocity.value) < 0.25f) {
+                animation.bobOffset = std::sin(animation.bobPhase) * BOB_AMPLITUDE;
+                animation.bobPhase += BOB_SPEED * deltaTime;
+                if (animation.bobPhase > 6.28318f) animation.bobPhase -= 6.28318f;
+            }
+
+            animation.rotation += SPIN_SPEED * deltaTime;
+            if (animation.rotation > 6.28318f) animation.rotation -= 6.28318f;
+        });
 
-    // Check Z collision
-    int newBlockZ = static_cast<int>(std::floor(newPos.z));
-    if (newBlockZ != blockZ) {
-        BlockType sideBlock = world.getBlock(blockX, static_cast<int>(item.position.y), newBlockZ);
-        if (isBlockSolid(sideBlock)) {
-            newPos.z = item.position.z;
-            item.velocity.z = -item.velocity.z * 0.3f;
+    // Radius queries against the settled positions
+    spatialIndex.rebuild(registry);
+
+    // Pickup - items within range of the player's center
+    glm::vec3 playerCenter = playerPos + glm::vec3(0.0f, PLAYER_HEIGHT * 0.5f, 0.0f);
+    spatialIndex.forEachInRadius(playerCenter, PICKUP_RADIUS, [&](ECS::Entity entity) {
+        ItemDrop* drop = registry.get<ItemDrop>(entity);
+        if (drop && !drop->removed && drop->pickupDelay <= 0.0f) {
+            tryPickup(*drop, inventory);
         }
-    }
+    });
 
-    // Update position
-    item.position = newPos;
+    // Merge nearby items of same type
+    mergeNearbyItems();
+
+    // Destroy everything that went away this update
+    registry.each<ItemDrop>([&](ECS::Entity entity, ItemDrop& drop) {
+        if (drop.removed) registry.destroyLater(entity);
+    });
+    registry.flushDestroyed();
+}
+
+// Collision against the world
+inline void DroppedItemManager::updateCollision(Position& position, Velocity& velocity, const glm::vec3& motion,
+                                                VoxelCollider& collider) {
+    // Item is a ~0.25 unit box hanging below its position
+    const float ITEM_HALF_WIDTH = 0.125f;
+    const float ITEM_HEIGHT = 0.25f;
+
+    glm::vec3& pos = position.value;
+    glm::vec3& vel = velocity.value;
+
+    auto boxAt = [&](const glm::vec3& p) {
+        return VoxelAABB{p - glm::vec3(ITEM_HALF_WIDTH, ITEM_HEIGHT, ITEM_HALF_WIDTH),
+                         p + glm::vec3(ITEM_HALF_WIDTH, 0.0f, ITEM_HALF_WIDTH)};
+    };
+
+    VoxelCollider::SweepResult result = collider.sweep(boxAt(pos), motion);
+    pos += result.moved;
+
+    // Land on block / bump ceiling
+    if (result.hitY) vel.y = 0.0f;
+
+    // Bounce off walls
+    if (result.hitX) vel.x = -vel.x * 0.3f;
+    if (result.hitZ) vel.z = -vel.z * 0.3f;
+
+    // Resting on something solid (keeps gravity off while it stays there)
+    velocity.onGround = vel.y <= 0.0f &&
+        collider.overlapsSolid(boxAt(pos - glm::vec3(0.0f, 0.05f, 0.0f)));
 
     // Keep above bedrock
-    if (item.position.y < 1.0f) {
-        item.position.y = 1.0f;
-        item.velocity.y = 0.0f;
-        item.onGround = true;
+    if (pos.y < 1.0f) {
+        pos.y = 1.0f;
+        vel.y = 0.0f;
+        velocity.onGround = true;
     }
 }
 
@@ -410,7 +470,7 @@ public:
     }
 
     void render(const DroppedItemManager& manager, const glm::mat4& view, const glm::mat4& projection, const glm::vec3& cameraPos) {
-        if (!initialized || manager.items.empty()) return;
+        if (!initialized || manager.empty()) return;
 
         glUseProgram(shaderProgram);
         glBindVertexArray(vao);
@@ -419,11 +479,9 @@ public:
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         glDisable(GL_CULL_FACE);
 
-        for (const auto& item : manager.items) {
-            if (item.markedForRemoval) continue;
-
-            renderItem(item, manager.getRenderPosition(item), view, projection, cameraPos);
-        }
+        manager.forEachItem([&](const ItemStack& stack, float rotation, const glm::vec3& pos) {
+            renderItem(stack, rotation, pos, view, projection, cameraPos);
+        });
 
         glEnable(GL_CULL_FACE);
         glDisable(GL_BLEND);
@@ -431,7 +489,7 @@ public:
     }
 
 private:
-    void renderItem(const DroppedItem& item, const glm::vec3& pos,
+    void renderItem(const ItemStack& stack, float rotation, const glm::vec3& pos,
                     const glm::mat4& view, const glm::mat4& projection,
                     const glm::vec3& cameraPos) {
         const float SIZE = 0.35f;  // Item display size
@@ -440,13 +498,13 @@ private:
         GLuint texture;
         glm::vec4 uv;
 
-        if (item.stack.isBlock()) {
+        if (stack.isBlock()) {
             texture = blockAtlas;
-            BlockTextures tex = getBlockTextures(item.stack.blockType);
+            const BlockTextures& tex = getBlockTextures(stack.blockType);
             uv = TextureAtlas::getUV(tex.faceSlots[4]);  // Top face
         } else {
             texture = itemAtlas;
-            int slot = ItemAtlas::getTextureSlot(item.stack.itemType);
+            int slot = ItemAtlas::getTextureSlot(stack.itemType);
             uv = ItemAtlas::getUV(slot);
         }
 
@@ -456,7 +514,7 @@ private:
         float angle = std::atan2(toCamera.x, toCamera.z);
 
         // Add item's spin rotation
-        angle += item.rotation;
+        angle += rotation;
 
         // Create model matrix
         glm::mat4 model = glm::mat4(1.0f);
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+// ============================================
+// ENTITY COMPONENT STORAGE
+// ============================================
+// Minimal sparse-set ECS for dynamic objects (dropped items, later mobs and
+// projectiles). An entity is just an id; each component type lives in its
+// own pool with a dense array of values, so a system streams exactly the
+// components it touches. Removing a component swaps the last one into its
+// slot, keeping the arrays packed.
+//
+// Iteration walks the dense array of the first component type and looks
+// the others up through their sparse index. Entities must not be created
+// or destroyed while iterating; use destroyLater() + flushDestroyed().
+//
+// parallelEach() splits the dense range into jobs for the job runner.
+// The calling thread works through the same jobs and only waits for ones
+// a worker already started, so a busy pool never stalls it.
+// ============================================
+
+namespace ECS {
+
+// Index in the low 32 bits, generation in the high 32: a slot can be reused
+// billions of times before a stale id could alias a live one
+using Entity = uint64_t;
+constexpr Entity NullEntity = ~Entity(0);
+constexpr uint32_t ENTITY_INDEX_BITS = 32;
+constexpr Entity ENTITY_INDEX_MASK = (Entity(1) << ENTITY_INDEX_BITS) - 1;
+
+inline uint32_t entityIndex(Entity entity) { return static_cast<uint32_t>(entity & ENTITY_INDEX_MASK); }
+inline uint32_t entityGeneration(Entity entity) { return static_cast<uint32_t>(entity >> ENTITY_INDEX_BITS); }
+
+// Runs a job on another thread (or inline when there are none)
+using JobRunner = std::function<void(std::function<void()>)>;
+
+class ComponentPoolBase {
+public:
+    virtual ~ComponentPoolBase() = default;
+    virtual void remove(Entity entity) = 0;
+    virtual void clear() = 0;
+};
+
+template<typename T>
+class ComponentPool : public ComponentPoolBase {
+public:
+    T& add(Entity entity, T value) {
+        uint32_t index = entityIndex(entity);
+        if (index >= sparse.size()) sparse.resize(index + 1, INVALID);
+        if (sparse[index] != INVALID) {
+            data[sparse[index]] = std::move(value);
+            return data[sparse[index]];
+        }
+        sparse[index] = static_cast<uint32_t>(dense.size());
+        dense.push_back(entity);
+        data.push_back(std::move(value));
+        return data.back();
+    }
+
+    void remove(Entity entity) override {
+        if (!contains(entity)) return;
+        uint32_t slot = sparse[entityIndex(entity)];
+        uint32_t last = static_cast<uint32_t>(dense.size() - 1);
+        if (slot != last) {
+            dense[slot] = dense[last];
+            data[slot] = std::move(data[last]);
+            sparse[entityIndex(dense[slot])] = slot;
+        }
+        dense.pop_back();
+        data.pop_back();
+        sparse[entityIndex(entity)] = INVALID;
+    }
+
+    void clear() override {
+        sparse.clear();
+        dense.clear();
+        data.clear();
+    }
+
+    bool contains(Entity entity) const {
+        uint32_t index = entityIndex(entity);
+        return index < sparse.size() && sparse[index] != INVALID && dense[sparse[index]] == entity;
+    }
+
+    T* get(Entity entity) {
+        return contains(entity) ? &data[sparse[entityIndex(entity)]] : nullptr;
+    }
+    const T* get(Entity entity) const {
+        return contains(entity) ? &data[sparse[entityIndex(entity)]] : nullptr;
+    }
+
+    // Dense storage: entities()[i] owns values()[i]
+    const std::vector<Entity>& entities() const { return dense; }
+    std::vector<T>& values() { return data; }
+    const std::vector<T>& values() const { return data; }
+    size_t size() const { return dense.size(); }
+
+private:
+    static constexpr uint32_t INVALID = 0xFFFFFFFFu;
+
+    std::vector<uint32_t> sparse;  // Entity index -> dense slot
+    std::vector<Entity> dense;
+    std::vector<T> data;
+};
+
+class Registry {
+public:
+    Entity create() {
+        uint32_t index;
+        if (!freeIndices.empty()) {
+            index = freeIndices.back();
+            freeIndices.pop_back();
+        } else {
+            index = static_cast<uint32_t>(generations.size());
+            generations.push_back(0);
+        }
+        aliveCount++;
+        return (static_cast<Entity>(generations[index]) << ENTITY_INDEX_BITS) | index;
+    }
+
+    // Remove an entity and all its components (not while iterating)
+    void destroy(Entity entity) {
+        if (!isAlive(entity)) return;
+        for (auto& pool : pools) {
+            if (pool) pool->remove(entity);
+        }
+        uint32_t index = entityIndex(entity);
+        generations[index]++;
+        freeIndices.push_back(index);
+        aliveCount--;
+    }
+
+    // Safe during iteration; applied by flushDestroyed()
+    void destroyLater(Entity entity) { pendingDestroy.push_back(entity); }
+
+    void flushDestroyed() {
+        for (Entity entity : pendingDestroy) destroy(entity);
+        pendingDestroy.clear();
+    }
+
+    bool isAlive(Entity entity) const {
+        uint32_t index = entityIndex(entity);
+        return index < generations.size() && generations[index] == entityGeneration(entity);
+    }
+
+    size_t getAliveCount() const { return aliveCount; }
+
+    template<typename T>
+    T& add(Entity entity, T value) { return pool<T>().add(entity, std::move(value)); }
+
+    template<typename T>
+    void remove(Entity entity) { pool<T>().remove(entity); }
+
+    template<typename T>
+    T* get(Entity entity) { return pool<T>().get(entity); }
+
+    template<typename T>
+    bool has(Entity entity) { return pool<T>().contains(entity); }
+
+    template<typename T>
+    ComponentPool<T>& pool() {
+        size_t id = componentId<T>();
+        if (id >= pools.size()) pools.resize(id + 1);
+        if (!pools[id]) pools[id] = std::make_unique<ComponentPool<T>>();
+        return *static_cast<ComponentPool<T>*>(pools[id].get());
+    }
+
+    // Call fn(entity, First&, Rest&...) for every entity with all the components
+    template<typename First, typename... Rest, typename Fn>
+    void each(Fn&& fn) {
+        ComponentPool<First>& first = pool<First>();
+        auto others = std::make_tuple(&pool<Rest>()...);
+        eachInRange<First, Rest...>(first, others, 0, first.size(), fn);
+    }
+
+    // Like each(), split into jobs of `grain` entities run on the job runner.
+    // fn must only touch the entity it is given (and read shared state).
+    template<typename First, typename... Rest, typename Fn>
+    void parallelEach(const JobRunner& runner, size_t grain, Fn&& fn) {
+        parallelEachWith<NoJobState, First, Rest...>(runner, grain,
+            [&fn](NoJobState&, Entity entity, First& first, Rest&... rest) { fn(entity, first, rest...); });
+    }
+
+    // parallelEach() with a JobState default-constructed per job and passed
+    // first to fn (per-thread caches, counters...)
+    template<typename JobState, typename First, typename... Rest, typename Fn>
+    void parallelEachWith(const JobRunner& runner, size_t grain, Fn&& fn) {
+        ComponentPool<First>& first = pool<First>();
+        auto others = std::make_tuple(&pool<Rest>()...);
+        size_t count = first.size();
+        grain = std::max<size_t>(grain, 1);
+        size_t jobCount = (count + grain - 1) / grain;
+
+        auto runJob = [&](size_t job) {
+            size_t begin = job * grain;
+            JobState state;
+            auto withState = [&](Entity entity, First& value, Rest&... rest) { fn(state, entity, value, rest...); };
+            eachInRange<First, Rest...>(first, others, begin, std::min(begin + grain, count), withState);
+        };
+
+        if (jobCount <= 1 || !runner) {
+            for (size_t job = 0; job < jobCount; job++) runJob(job);
+            return;
+        }
+
+        // Shared with helpers that may start after this call returned; they
+        // only touch runJob while a job index is still unclaimed.
+        struct Batch {
+            std::atomic<size_t> next{0};
+            std::atomic<int> active{0};
+            std::mutex mutex;
+            std::condition_variable done;
+            size_t jobCount = 0;
+            std::function<void(size_t)> run;
+        };
+        auto batch = std::make_shared<Batch>();
+        batch->jobCount = jobCount;
+        batch->run = runJob;
+
+        auto work = [](Batch& b) {
+            size_t job;
+            while ((job = b.next.fetch_add(1)) < b.jobCount) b.run(job);
+        };
+
+        for (size_t helper = 1; helper < jobCount; helper++) {
+            runner([batch, work]() {
+                batch->active.fetch_add(1);
+                work(*batch);
+                if (batch->active.fetch_sub(1) == 1) {
+                    std::lock_guard<std::mutex> lock(batch->mutex);
+                    batch->done.notify_all();
+                }
+            });
+        }
+
+        work(*batch);
+
+        // Every job is claimed; wait for the ones helpers are still running
+        std::unique_lock<std::mutex> lock(batch->mutex);
+        batch->done.wait(lock, [&]() { return batch->active.load() == 0; });
+    }
+
+    void clear() {
+        for (auto& pool : pools) {
+            if (pool) pool->clear();
+        }
+        generations.clear();
+        freeIndices.clear();
+        pendingDestroy.clear();
+        aliveCount = 0;
+    }
+
+private:
+    struct NoJobState {};
+
+    static size_t nextComponentId() {
+        static size_t counter = 0;
+        return counter++;
+    }
+
+    template<typename T>
+    static size_t componentId() {
+        static const size_t id = nextComponentId();
+        return id;
+    }
+
+    template<typename First, typename... Rest, typename Tuple, typename Fn>
+    static void eachInRange(ComponentPool<First>& first, Tuple& others, size_t begin, size_t end, Fn& fn) {
+        const std::vector<Entity>& entities = first.entities();
+        std::vector<First>& values = first.values();
+        for (size_t i = begin; i < end; i++) {
+            Entity entity = entities[i];
+            if (!(std::get<ComponentPool<Rest>*>(others)->contains(entity) && ...)) continue;
+            fn(entity, values[i], *std::get<ComponentPool<Rest>*>(others)->get(entity)...);
+        }
+    }
+
+    std::vector<std::unique_ptr<ComponentPoolBase>> pools;  // Indexed by component id
+    std::vector<uint32_t> generations;                      // Per entity index
+    std::vector<uint32_t> freeIndices;
+    std::vector<Entity> pendingDestroy;
+    size_t aliveCount = 0;
+};
+
+} // namespace ECS
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "ECS.h"
+#include "SpatialHash.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+// ============================================
+// SHARED ENTITY COMPONENTS
+// ============================================
+// Components every kind of moving entity can use, plus a spatial index over
+// entity positions. Kind-specific components (dropped item stacks, mob AI...)
+// live next to the code that owns that kind.
+// ============================================
+
+struct Position {
+    glm::vec3 value{0.0f};
+};
+
+struct Velocity {
+    glm::vec3 value{0.0f};
+    bool onGround = false;
+};
+
+// Seconds until the entity despawns
+struct Lifetime {
+    float seconds = 0.0f;
+};
+
+// Radius queries over every entity with a Position, as of the last rebuild()
+class EntitySpatialIndex {
+public:
+    explicit EntitySpatialIndex(float cellSize = 1.0f) : grid(cellSize) {}
+
+    void rebuild(ECS::Registry& registry) {
+        ECS::ComponentPool<Position>& pool = registry.pool<Position>();
+        entities = pool.entities();
+        positions.resize(pool.size());
+        for (size_t i = 0; i < pool.size(); i++) {
+            positions[i] = pool.values()[i].value;
+        }
+        grid.build(positions);
+    }
+
+    // Call fn(entity) for every indexed entity within radius of center
+    template<typename Fn>
+    void forEachInRadius(const glm::vec3& center, float radius, Fn&& fn) const {
+        grid.forEachInRadius(center, radius, [&](uint32_t i) { fn(entities[i]); });
+    }
+
+    size_t size() const { return entities.size(); }
+
+private:
+    SpatialHashGrid grid;
+    std::vector<glm::vec3> positions;
+    std::vector<ECS::Entity> entities;
+};
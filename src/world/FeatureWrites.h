@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Chunk.h"
+#include "Block.h"
+#include <cstdint>
+#include <glm/glm.hpp>
+
+// ============================================================================
+// CROSS-CHUNK FEATURE WRITES
+// ============================================================================
+// The feature stage (ores, trees, structures) may reach past the chunk that
+// places a feature. Instead of handing those writes to the neighbour later,
+// every chunk re-evaluates the features of its 3x3 neighbourhood itself:
+// each origin chunk's features are seeded by the origin alone and written
+// through a FeatureWriter that clips them to the chunk being generated.
+//
+// A chunk's blocks therefore depend only on the seed and its position, never
+// on which neighbours happened to be loaded, in what order, or whether the
+// player edited them since. No state is shared between chunks, so every
+// generation stage keeps running in parallel on the workers.
+// ============================================================================
+
+// Condition checked against the target block when the write is applied
+enum class FeatureReplace : uint8_t {
+    ALWAYS,      // Trunks, cacti
+    AIR_ONLY,    // Leaves
+    STONE_ONLY   // Ore veins
+};
+
+inline bool canApplyFeatureWrite(BlockType current, FeatureReplace replace) {
+    switch (replace) {
+        case FeatureReplace::AIR_ONLY:   return current == BlockType::AIR;
+        case FeatureReplace::STONE_ONLY: return current == BlockType::STONE;
+        default:                         return true;
+    }
+}
+
+// Write helper for one origin chunk's features, clipped to the target chunk
+// Coordinates are local to the origin chunk and may fall outside
+// [0, CHUNK_SIZE); only writes that land in the target chunk are applied.
+class FeatureWriter {
+public:
+    FeatureWriter(Chunk& target, glm::ivec2 originChunk)
+        : chunk(target),
+          offsetX((originChunk.x - target.position.x) * CHUNK_SIZE_X),
+          offsetZ((originChunk.y - target.position.y) * CHUNK_SIZE_Z) {}
+
+    void set(int x, int y, int z, BlockType type, FeatureReplace replace = FeatureReplace::ALWAYS) {
+        if (y < 0 || y >= CHUNK_SIZE_Y) return;
+        int tx = x + offsetX;
+        int tz = z + offsetZ;
+        if (tx < 0 || tx >= CHUNK_SIZE_X || tz < 0 || tz >= CHUNK_SIZE_Z) return;
+
+        if (canApplyFeatureWrite(chunk.getBlock(tx, y, tz), replace)) {
+            chunk.setBlockDeferred(tx, y, tz, type);
+        }
+    }
+
+    // Vertical span [yMin, yMax]; spans in the target go through Chunk::fillColumn
+    void fillColumn(int x, int z, int yMin, int yMax, BlockType type) {
+        int tx = x + offsetX;
+        int tz = z + offsetZ;
+        if (tx < 0 || tx >= CHUNK_SIZE_X || tz < 0 || tz >= CHUNK_SIZE_Z) return;
+        chunk.fillColumn(tx, tz, yMin, yMax, type);
+    }
+
+    // Origin-local column (x, z) in target-local coordinates
+    int toTargetX(int x) const { return x + offsetX; }
+    int toTargetZ(int z) const { return z + offsetZ; }
+
+private:
+    Chunk& chunk;
+    int offsetX;
+    int offsetZ;
+};
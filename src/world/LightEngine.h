@@ -0,0 +1,486 @@
+#pragma once
+
+#include "Chunk.h"
+#include "Block.h"
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <glm/glm.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+// ============================================================================
+// LIGHT ENGINE (block light + sky light)
+// ============================================================================
+// Flood-fill light with an add queue and a removal queue per channel, both in
+// world coordinates so they cross chunk seams. Edits only touch the cells
+// whose light actually depends on the edited block:
+//   - removal BFS clears light that came from a removed/covered source and
+//     hands brighter cells it meets back to the add queue
+//   - add BFS re-floods from those cells and from new sources
+// Every changed cell marks its section (plus the section/chunk it borders),
+// so callers remesh only the sections whose light is now different.
+//
+// Both channels share the BFS and live as nibbles in Chunk::lightLevels:
+//   - BLOCK: sources are emissive blocks, -1 per step
+//   - SKY:   seeded from the column heightmaps; full sky light travels
+//            straight down without falloff, everything else is -1 per step
+//
+// Initial lighting of a new chunk (lightChunk) runs on the generation worker,
+// clipped to that chunk; seedChunkSeams() then lets light flow across the
+// borders once the chunk joins the world.
+// ============================================================================
+
+enum class LightChannel : uint8_t {
+    BLOCK = 0,
+    SKY = 1
+};
+
+class LightEngine {
+public:
+    // Returns the loaded chunk at a chunk position, or nullptr
+    using ChunkLookup = std::function<Chunk*(glm::ivec2)>;
+
+    // Per chunk: bit s set when section s needs a remesh
+    using SectionMap = std::unordered_map<glm::ivec2, uint16_t>;
+
+    static constexpr int CHANNEL_COUNT = 2;
+
+    explicit LightEngine(ChunkLookup lookup) : lookup(std::move(lookup)) {}
+
+    // Light level emitted by a block (15 for glowstone, 13 for lava)
+    static uint8_t getEmission(BlockType type) {
+        return getBlockLightEmission(type);
+    }
+
+    // Light passes through air and transparent blocks
+    static bool passesLight(BlockType type) {
+        return !isBlockSolid(type) || isBlockTransparent(type);
+    }
+
+    // Light a freshly generated or loaded chunk: block light from its own
+    // emitters, sky light from its heightmap
+    // Chunk-local and thread-safe per chunk (runs on the generation workers)
+    static void lightChunk(Chunk& chunk) {
+        LightEngine engine([&chunk](glm::ivec2 pos) -> Chunk* {
+            return pos == chunk.position ? &chunk : nullptr;
+        });
+        engine.trackSections = false;
+
+        engine.seedBlockLight(chunk);
+        engine.seedSkyLight(chunk);
+        engine.runAddQueue(LightChannel::BLOCK);
+        engine.runAddQueue(LightChannel::SKY);
+    }
+
+    // Queue the light update for a block that was just written at world coordinates
+    void onBlockChanged(int x, int y, int z) {
+        if (y < 0 || y >= CHUNK_SIZE_Y) return;
+        resetCache();
+
+        Cell cell = resolve(x, y, z);
+        if (!cell.chunk) return;
+
+        BlockType block = cell.chunk->blocks[cell.index];
+        bool opened = passesLight(block);
+
+        for (int c = 0; c < CHANNEL_COUNT; c++) {
+            LightChannel channel = static_cast<LightChannel>(c);
+            Queues& q = queues[c];
+
+            // Whatever light this cell held may have been feeding its neighbours
+            uint8_t oldLight = getLight(cell, channel);
+            if (oldLight > 0) {
+                setLight(cell, y, channel, 0);
+                q.remove.push_back({x, y, z, oldLight});
+            }
+
+            // The top layer sees the sky directly
+            uint8_t source = channel == LightChannel::BLOCK
+                ? getEmission(block)
+                : ((opened && y == CHUNK_SIZE_Y - 1) ? MAX_LIGHT_LEVEL : 0);
+            if (source > 0) q.sources.push_back({x, y, z, source});
+
+            // Opened up: let the lit neighbours flood back in
+            if (opened) {
+                for (const auto& dir : DIRECTIONS) {
+                    int nx = x + dir[0], ny = y + dir[1], nz = z + dir[2];
+                    if (ny < 0 || ny >= CHUNK_SIZE_Y) continue;
+                    Cell neighbor = resolve(nx, ny, nz);
+                    if (neighbor.chunk && getLight(neighbor, channel) > 1) {
+                        q.add.push_back({nx, ny, nz, 0});
+                    }
+                }
+            }
+        }
+    }
+
+    // Let light cross the borders between a chunk that just joined the world
+    // and its loaded neighbours, in both directions
+    void seedChunkSeams(glm::ivec2 pos) {
+        resetCache();
+        Chunk* chunk = lookup(pos);
+        if (!chunk) return;
+
+        const glm::ivec2 offsets[4] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+        for (const glm::ivec2& offset : offsets) {
+            glm::ivec2 npos = pos + offset;
+            Chunk* neighbor = lookup(npos);
+            if (!neighbor) continue;
+
+            // Above both chunks' highest block + MAX_LIGHT_LEVEL the two sides can't differ
+            // (full sky light, no block light reaches that high)
+            int topY = std::max(chunk->chunkMaxY, neighbor->chunkMaxY);
+            topY = std::min(topY + MAX_LIGHT_LEVEL, CHUNK_SIZE_Y - 1);
+
+            for (int y = 0; y <= topY; y++) {
+                for (int i = 0; i < CHUNK_SIZE_X; i++) {
+                    // Local coordinates of the facing cells on either side of the seam
+                    int x = offset.x < 0 ? 0 : (offset.x > 0 ? CHUNK_SIZE_X - 1 : i);
+                    int z = offset.y < 0 ? 0 : (offset.y > 0 ? CHUNK_SIZE_Z - 1 : i);
+                    int nx = offset.x == 0 ? x : CHUNK_SIZE_X - 1 - x;
+                    int nz = offset.y == 0 ? z : CHUNK_SIZE_Z - 1 - z;
+
+                    uint8_t here = chunk->getPackedLight(x, y, z);
+                    uint8_t there = neighbor->getPackedLight(nx, y, nz);
+                    if (here == there) continue;
+
+                    // OPTIMIZATION: Only the brighter side of a pair that differs by
+                    // more than one step can change anything
+                    for (int c = 0; c < CHANNEL_COUNT; c++) {
+                        int shift = c * SKY_LIGHT_SHIFT;
+                        int a = (here >> shift) & BLOCK_LIGHT_MASK;
+                        int b = (there >> shift) & BLOCK_LIGHT_MASK;
+                        if (a > b + 1) {
+                            queues[c].add.push_back({pos.x * CHUNK_SIZE_X + x, y, pos.y * CHUNK_SIZE_Z + z, 0});
+                        } else if (b > a + 1) {
+                            queues[c].add.push_back({npos.x * CHUNK_SIZE_X + nx, y, npos.y * CHUNK_SIZE_Z + nz, 0});
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    bool hasPendingWork() const {
+        for (const Queues& q : queues) {
+            if (!q.remove.empty() || !q.sources.empty() || !q.add.empty()) return true;
+        }
+        return false;
+    }
+
+    // Drain the queues (removal first, then re-add) and return the sections
+    // whose light changed since the last call
+    SectionMap propagate() {
+        resetCache();
+        for (int c = 0; c < CHANNEL_COUNT; c++) {
+            LightChannel channel = static_cast<LightChannel>(c);
+            Queues& q = queues[c];
+
+            runRemoveQueue(channel);
+
+            for (const LightNode& source : q.sources) {
+                Cell cell = resolve(source.x, source.y, source.z);
+                if (!cell.chunk || getLight(cell, channel) >= source.level) continue;
+                setLight(cell, source.y, channel, source.level);
+                q.add.push_back(source);
+            }
+            q.sources.clear();
+
+            runAddQueue(channel);
+        }
+
+        SectionMap result = std::move(changedSections);
+        changedSections.clear();
+        return result;
+    }
+
+    // Light the edit at world (x, y, z) on its own: only the BFS seeded by this
+    // block runs, while work queued by other edits and chunk seams waits for
+    // the next propagate(). Used for player edits that need an immediate remesh.
+    SectionMap propagateEdit(int x, int y, int z) {
+        return propagateIsolated([&] { onBlockChanged(x, y, z); });
+    }
+
+    // Same for a batch of edits (WorldEditBatch): one BFS seeded by exactly
+    // these blocks, with the rest of the queued work left for propagate()
+    SectionMap propagateEdits(const std::vector<glm::ivec3>& positions) {
+        return propagateIsolated([&] {
+            for (const glm::ivec3& p : positions) onBlockChanged(p.x, p.y, p.z);
+        });
+    }
+
+    // Drop all queued work (world reset)
+    void clear() {
+        for (Queues& q : queues) {
+            q.remove.clear();
+            q.add.clear();
+            q.sources.clear();
+        }
+        changedSections.clear();
+        resetCache();
+    }
+
+    // Sections (as a mask) that a change at height y can affect: its own, plus the
+    // neighbouring section when y sits on a section boundary (smooth lighting and
+    // face shading sample one block across)
+    static uint16_t sectionMaskForY(int y) {
+        int section = y / CHUNK_SECTION_HEIGHT;
+        uint16_t mask = static_cast<uint16_t>(1u << section);
+        int inSection = y % CHUNK_SECTION_HEIGHT;
+        if (inSection == 0 && section > 0) mask |= static_cast<uint16_t>(1u << (section - 1));
+        if (inSection == CHUNK_SECTION_HEIGHT - 1 && section < CHUNK_SECTION_COUNT - 1) {
+            mask |= static_cast<uint16_t>(1u << (section + 1));
+        }
+        return mask;
+    }
+
+    // Mark the sections a change at local (x, y, z) of chunkPos affects, including
+    // the neighbouring chunk when the cell is on a chunk border
+    static void markSections(SectionMap& map, glm::ivec2 chunkPos, int x, int y, int z) {
+        uint16_t mask = sectionMaskForY(y);
+        map[chunkPos] |= mask;
+        if (x == 0) map[chunkPos + glm::ivec2(-1, 0)] |= mask;
+        if (x == CHUNK_SIZE_X - 1) map[chunkPos + glm::ivec2(1, 0)] |= mask;
+        if (z == 0) map[chunkPos + glm::ivec2(0, -1)] |= mask;
+        if (z == CHUNK_SIZE_Z - 1) map[chunkPos + glm::ivec2(0, 1)] |= mask;
+    }
+
+private:
+    // Run propagate() on queues holding only what seed() enqueues, then put
+    // the previously queued work back untouched
+    template <typename Seed>
+    SectionMap propagateIsolated(Seed&& seed) {
+        std::array<Queues, CHANNEL_COUNT> queued;
+        SectionMap queuedSections;
+        std::swap(queues, queued);
+        std::swap(changedSections, queuedSections);
+
+        seed();
+        SectionMap result = propagate();
+
+        std::swap(queues, queued);
+        std::swap(changedSections, queuedSections);
+        return result;
+    }
+
+    struct LightNode {
+        int x, y, z;     // World coordinates
+        uint8_t level;   // Removal: light the cell had; sources: source level
+    };
+
+    struct Queues {
+        std::vector<LightNode> remove;
+        std::vector<LightNode> add;
+        std::vector<LightNode> sources;
+    };
+
+    struct Cell {
+        Chunk* chunk = nullptr;
+        int index = 0;
+        int localX = 0;
+        int localZ = 0;
+    };
+
+    // Index 3 is straight down (sky light keeps full strength along it)
+    static constexpr int DIRECTIONS[6][3] = {
+        {1, 0, 0}, {-1, 0, 0},
+        {0, 1, 0}, {0, -1, 0},
+        {0, 0, 1}, {0, 0, -1}
+    };
+    static constexpr int DIRECTION_DOWN = 3;
+
+    static int floorDiv(int value, int size) {
+        return value >= 0 ? value / size : (value - size + 1) / size;
+    }
+
+    // Light a cell receives from a neighbour at `level` through direction d
+    static uint8_t spreadLevel(LightChannel channel, int d, uint8_t level) {
+        if (channel == LightChannel::SKY && d == DIRECTION_DOWN && level == MAX_LIGHT_LEVEL) {
+            return MAX_LIGHT_LEVEL;
+        }
+        return static_cast<uint8_t>(level - 1);
+    }
+
+    // Block emitters: one shared BFS for all of them
+    void seedBlockLight(Chunk& chunk) {
+        if (chunk.chunkMinY > chunk.chunkMaxY) return;
+        int baseX = chunk.position.x * CHUNK_SIZE_X;
+        int baseZ = chunk.position.y * CHUNK_SIZE_Z;
+        std::vector<LightNode>& add = queues[static_cast<int>(LightChannel::BLOCK)].add;
+
+        // OPTIMIZATION: Emitters are non-air, so all-air sections and the rows outside
+        // the chunk's height range are never scanned
+        for (int section = 0; section < CHUNK_SECTION_COUNT; section++) {
+            if (chunk.sections[section].isAllAir()) continue;
+
+            int yStart = std::max(section * CHUNK_SECTION_HEIGHT, static_cast<int>(chunk.chunkMinY));
+            int yEnd = std::min(section * CHUNK_SECTION_HEIGHT + CHUNK_SECTION_HEIGHT - 1,
+                                static_cast<int>(chunk.chunkMaxY));
+            for (int y = yStart; y <= yEnd; y++) {
+                for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+                    for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                        uint8_t emission = getEmission(chunk.getBlock(x, y, z));
+                        if (emission == 0) continue;
+                        chunk.setLightLevel(x, y, z, emission);
+                        add.push_back({baseX + x, y, baseZ + z, emission});
+                    }
+                }
+            }
+        }
+    }
+
+    // Sky light: every column is fully lit down to its first light-blocking block,
+    // then only the cells that can spill sideways under a neighbour's overhang are
+    // queued for the BFS
+    void seedSkyLight(Chunk& chunk) {
+        int baseX = chunk.position.x * CHUNK_SIZE_X;
+        int baseZ = chunk.position.y * CHUNK_SIZE_Z;
+        std::vector<LightNode>& add = queues[static_cast<int>(LightChannel::SKY)].add;
+
+        // Lowest directly lit y per column (CHUNK_SIZE_Y when the top cell is blocked)
+        std::array<int, CHUNK_SIZE_X * CHUNK_SIZE_Z> skyTop;
+        for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+            for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                int col = x + z * CHUNK_SIZE_X;
+                // OPTIMIZATION: Everything above the heightmap is air
+                int y = CHUNK_SIZE_Y - 1;
+                int highest = chunk.minY[col] > chunk.maxY[col] ? -1 : chunk.maxY[col];
+                for (; y > highest; y--) chunk.setSkyLight(x, y, z, MAX_LIGHT_LEVEL);
+                for (; y >= 0 && passesLight(chunk.getBlock(x, y, z)); y--) {
+                    chunk.setSkyLight(x, y, z, MAX_LIGHT_LEVEL);
+                }
+                skyTop[col] = y + 1;
+            }
+        }
+
+        for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+            for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                int top = skyTop[x + z * CHUNK_SIZE_X];
+                int spillTop = top;
+                if (x > 0) spillTop = std::max(spillTop, skyTop[(x - 1) + z * CHUNK_SIZE_X]);
+                if (x < CHUNK_SIZE_X - 1) spillTop = std::max(spillTop, skyTop[(x + 1) + z * CHUNK_SIZE_X]);
+                if (z > 0) spillTop = std::max(spillTop, skyTop[x + (z - 1) * CHUNK_SIZE_X]);
+                if (z < CHUNK_SIZE_Z - 1) spillTop = std::max(spillTop, skyTop[x + (z + 1) * CHUNK_SIZE_X]);
+                for (int y = top; y < spillTop; y++) {
+                    add.push_back({baseX + x, y, baseZ + z, 0});
+                }
+            }
+        }
+    }
+
+    // Chunks can unload between calls, so the lookup cache lives for one call only
+    void resetCache() {
+        cachedPos = glm::ivec2(std::numeric_limits<int>::min());
+        cachedChunk = nullptr;
+    }
+
+    Cell resolve(int x, int y, int z) {
+        Cell cell;
+        glm::ivec2 chunkPos(floorDiv(x, CHUNK_SIZE_X), floorDiv(z, CHUNK_SIZE_Z));
+        if (chunkPos != cachedPos) {
+            cachedPos = chunkPos;
+            cachedChunk = lookup(chunkPos);
+        }
+        if (!cachedChunk) return cell;
+
+        cell.chunk = cachedChunk;
+        cell.localX = x - chunkPos.x * CHUNK_SIZE_X;
+        cell.localZ = z - chunkPos.y * CHUNK_SIZE_Z;
+        cell.index = cell.localX + cell.localZ * CHUNK_SIZE_X + y * CHUNK_SIZE_X * CHUNK_SIZE_Z;
+        return cell;
+    }
+
+    static uint8_t getLight(const Cell& cell, LightChannel channel) {
+        uint8_t packed = cell.chunk->lightLevels[cell.index];
+        return channel == LightChannel::SKY ? (packed >> SKY_LIGHT_SHIFT) : (packed & BLOCK_LIGHT_MASK);
+    }
+
+    void setLight(const Cell& cell, int y, LightChannel channel, uint8_t level) {
+        uint8_t& packed = cell.chunk->lightLevels[cell.index];
+        packed = channel == LightChannel::SKY
+            ? packLight(packed & BLOCK_LIGHT_MASK, level)
+            : packLight(level, packed >> SKY_LIGHT_SHIFT);
+        if (trackSections) {
+            markSections(changedSections, cell.chunk->position, cell.localX, y, cell.localZ);
+        }
+    }
+
+    // Clear light that depended on removed cells; brighter cells found on the
+    // way are lit independently and go back on the add queue
+    void runRemoveQueue(LightChannel channel) {
+        Queues& q = queues[static_cast<int>(channel)];
+        size_t head = 0;
+        while (head < q.remove.size()) {
+            LightNode node = q.remove[head++];
+
+            for (int d = 0; d < 6; d++) {
+                int nx = node.x + DIRECTIONS[d][0], ny = node.y + DIRECTIONS[d][1], nz = node.z + DIRECTIONS[d][2];
+                if (ny < 0 || ny >= CHUNK_SIZE_Y) continue;
+
+                Cell neighbor = resolve(nx, ny, nz);
+                if (!neighbor.chunk) continue;
+
+                uint8_t light = getLight(neighbor, channel);
+                if (light == 0) continue;
+
+                // Dependent when it got its light from this cell (full sky light
+                // below a fully lit cell came straight down)
+                if (light < node.level || spreadLevel(channel, d, node.level) == light) {
+                    setLight(neighbor, ny, channel, 0);
+                    q.remove.push_back({nx, ny, nz, light});
+                    // A source inside the cleared region relights itself
+                    uint8_t source = channel == LightChannel::BLOCK
+                        ? getEmission(neighbor.chunk->blocks[neighbor.index])
+                        : (ny == CHUNK_SIZE_Y - 1 ? MAX_LIGHT_LEVEL : 0);
+                    if (source > 0) q.sources.push_back({nx, ny, nz, source});
+                } else {
+                    q.add.push_back({nx, ny, nz, 0});
+                }
+            }
+        }
+        q.remove.clear();
+    }
+
+    // Flood outward; each node spreads the light its cell currently holds
+    void runAddQueue(LightChannel channel) {
+        std::vector<LightNode>& add = queues[static_cast<int>(channel)].add;
+        size_t head = 0;
+        while (head < add.size()) {
+            LightNode node = add[head++];
+
+            Cell cell = resolve(node.x, node.y, node.z);
+            if (!cell.chunk) continue;
+            uint8_t level = getLight(cell, channel);
+            if (level <= 1) continue;
+
+            for (int d = 0; d < 6; d++) {
+                int nx = node.x + DIRECTIONS[d][0], ny = node.y + DIRECTIONS[d][1], nz = node.z + DIRECTIONS[d][2];
+                if (ny < 0 || ny >= CHUNK_SIZE_Y) continue;
+
+                Cell neighbor = resolve(nx, ny, nz);
+                if (!neighbor.chunk) continue;
+                if (!passesLight(neighbor.chunk->blocks[neighbor.index])) continue;
+
+                uint8_t newLevel = spreadLevel(channel, d, level);
+                if (getLight(neighbor, channel) < newLevel) {
+                    setLight(neighbor, ny, channel, newLevel);
+                    add.push_back({nx, ny, nz, 0});
+                }
+            }
+        }
+        add.clear();
+    }
+
+    ChunkLookup lookup;
+    glm::ivec2 cachedPos = glm::ivec2(std::numeric_limits<int>::min());
+    Chunk* cachedChunk = nullptr;
+    bool trackSections = true;
+
+    std::array<Queues, CHANNEL_COUNT> queues;
+    SectionMap changedSections;
+};
@@ -0,0 +1,516 @@
+#pragma once
+
+#include <FastNoiseLite.h>
+#include <array>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define NOISE_BATCH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define NOISE_BATCH_X86 0
+#endif
+
+// MSVC accepts any intrinsic in any function; GCC/Clang need the ISA per function
+#if NOISE_BATCH_X86 && (defined(__GNUC__) || defined(__clang__))
+#define NOISE_BATCH_TARGET(isa) __attribute__((target(isa)))
+#else
+#define NOISE_BATCH_TARGET(isa)
+#endif
+
+// ============================================================================
+// BATCH NOISE EVALUATION
+// ============================================================================
+// Fills whole grids/columns/point lists of noise per call instead of one
+// GetNoise() per voxel inside the generation loops. Generation passes sample
+// their noise up front into flat float buffers, then run their (branchy)
+// classification over the buffers.
+//
+// Every sample uses the same float expression (float(worldCoord) * scale +
+// offset) that the per-voxel code used.
+//
+// Backends:
+// - Simplex2D (2D OpenSimplex2, no fractal / FBm / Ridged) has an SSE4.1 and
+//   an AVX2 kernel, picked at runtime from cpuid. They repeat FastNoiseLite's
+//   float operations in the same order (no FMA), so they give the same bits.
+//   configure() checks that against FastNoiseLite on a fixed probe set and
+//   drops to the scalar path if any sample differs, so a world can never
+//   generate differently depending on the CPU.
+// - Everything else (3D noise, plain FastNoiseLite overloads) evaluates
+//   point by point.
+// ============================================================================
+
+namespace NoiseBatch {
+
+enum class Backend { Scalar, SSE41, AVX2 };
+
+inline const char* backendName(Backend backend) {
+    switch (backend) {
+        case Backend::AVX2: return "AVX2";
+        case Backend::SSE41: return "SSE4.1";
+        default: return "scalar";
+    }
+}
+
+// Widest SIMD backend this CPU and OS support
+inline Backend detectBackend() {
+#if NOISE_BATCH_X86
+    static const Backend detected = [] {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool sse41 = (info[2] & (1 << 19)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        bool avx2 = false;
+        if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+#else
+        __builtin_cpu_init();
+        bool sse41 = __builtin_cpu_supports("sse4.1");
+        bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+        if (avx2) return Backend::AVX2;
+        if (sse41) return Backend::SSE41;
+        return Backend::Scalar;
+    }();
+    return detected;
+#else
+    return Backend::Scalar;
+#endif
+}
+
+// FastNoiseLite's 2D gradient table: 24 directions 15 degrees apart
+// (starting at 82.5), repeated 5 times, then 8 diagonals
+inline const float* simplexGradients2D() {
+    static const std::array<float, 256> table = [] {
+        const float ring[48] = {
+             0.130526192220052f,  0.99144486137381f,   0.38268343236509f,   0.923879532511287f,
+             0.608761429008721f,  0.793353340291235f,  0.793353340291235f,  0.608761429008721f,
+             0.923879532511287f,  0.38268343236509f,   0.99144486137381f,   0.130526192220051f,
+             0.99144486137381f,  -0.130526192220051f,  0.923879532511287f, -0.38268343236509f,
+             0.793353340291235f, -0.60876142900872f,   0.608761429008721f, -0.793353340291235f,
+             0.38268343236509f,  -0.923879532511287f,  0.130526192220052f, -0.99144486137381f,
+            -0.130526192220052f, -0.99144486137381f,  -0.38268343236509f,  -0.923879532511287f,
+            -0.60876142900872f,  -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+            -0.923879532511287f, -0.38268343236509f,  -0.99144486137381f,  -0.130526192220052f,
+            -0.99144486137381f,   0.130526192220051f, -0.923879532511287f,  0.38268343236509f,
+            -0.793353340291235f,  0.608761429008721f, -0.608761429008721f,  0.793353340291235f,
+            -0.38268343236509f,   0.923879532511287f, -0.130526192220052f,  0.99144486137381f
+        };
+        const float diagonals[16] = {
+             0.38268343236509f,   0.923879532511287f,  0.923879532511287f,  0.38268343236509f,
+             0.923879532511287f, -0.38268343236509f,   0.38268343236509f,  -0.923879532511287f,
+            -0.38268343236509f,  -0.923879532511287f, -0.923879532511287f, -0.38268343236509f,
+            -0.923879532511287f,  0.38268343236509f,  -0.38268343236509f,   0.923879532511287f
+        };
+        std::array<float, 256> values{};
+        for (int i = 0; i < 240; i++) values[i] = ring[i % 48];
+        for (int i = 0; i < 16; i++) values[240 + i] = diagonals[i];
+        return values;
+    }();
+    return table.data();
+}
+
+// Constants of FastNoiseLite's 2D OpenSimplex2, written with the same float
+// expressions so they round the same way
+struct SimplexConstants {
+    static constexpr float SQRT3 = 1.7320508075688772935274463415059f;
+    static constexpr float F2 = 0.5f * (SQRT3 - 1);
+    static constexpr float G2 = (3 - SQRT3) / 6;
+    static constexpr float C_T = (float)(2 * (1 - 2 * G2) * (1 / G2 - 2));
+    static constexpr float C_A = (float)(-2 * (1 - 2 * G2) * (1 - 2 * G2));
+    static constexpr float X2 = 2 * (float)G2 - 1;
+    static constexpr float G2_MINUS_1 = (float)G2 - 1;
+    static constexpr float SCALE = 99.83685446303647f;
+    static constexpr int PRIME_X = 501125321;
+    static constexpr int PRIME_Y = 1136930381;
+    static constexpr int HASH_MUL = 0x27d4eb2d;
+};
+
+// Fractal settings the kernels understand
+enum class Fractal { None, FBm, Ridged };
+
+struct FractalParams {
+    int seed;
+    float frequency;
+    Fractal fractal;
+    int octaves;
+    float lacunarity;
+    float gain;
+    float bounding;
+};
+
+#if NOISE_BATCH_X86
+
+// ---- SSE4.1: 4 points per iteration ----
+
+NOISE_BATCH_TARGET("sse4.1")
+inline __m128 simplexGradSSE(__m128i seed, __m128i xPrimed, __m128i yPrimed, __m128 xd, __m128 yd) {
+    __m128i hash = _mm_xor_si128(seed, _mm_xor_si128(xPrimed, yPrimed));
+    hash = _mm_mullo_epi32(hash, _mm_set1_epi32(SimplexConstants::HASH_MUL));
+    hash = _mm_xor_si128(hash, _mm_srai_epi32(hash, 15));
+    hash = _mm_and_si128(hash, _mm_set1_epi32(127 << 1));
+
+    alignas(16) int32_t index[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(index), hash);
+    const float* gradients = simplexGradients2D();
+    __m128 xg = _mm_setr_ps(gradients[index[0]], gradients[index[1]], gradients[index[2]], gradients[index[3]]);
+    __m128 yg = _mm_setr_ps(gradients[index[0] | 1], gradients[index[1] | 1], gradients[index[2] | 1], gradients[index[3] | 1]);
+    return _mm_add_ps(_mm_mul_ps(xd, xg), _mm_mul_ps(yd, yg));
+}
+
+NOISE_BATCH_TARGET("sse4.1")
+inline __m128 simplexSingleSSE(__m128i seed, __m128 x, __m128 y) {
+    using K = SimplexConstants;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    // FastFloor: (int)f, minus one where f < 0
+    __m128i i = _mm_add_epi32(_mm_cvttps_epi32(x), _mm_castps_si128(_mm_cmplt_ps(x, zero)));
+    __m128i j = _mm_add_epi32(_mm_cvttps_epi32(y), _mm_castps_si128(_mm_cmplt_ps(y, zero)));
+    __m128 xi = _mm_sub_ps(x, _mm_cvtepi32_ps(i));
+    __m128 yi = _mm_sub_ps(y, _mm_cvtepi32_ps(j));
+
+    __m128 t = _mm_mul_ps(_mm_add_ps(xi, yi), _mm_set1_ps(K::G2));
+    __m128 x0 = _mm_sub_ps(xi, t);
+    __m128 y0 = _mm_sub_ps(yi, t);
+
+    i = _mm_mullo_epi32(i, _mm_set1_epi32(K::PRIME_X));
+    j = _mm_mullo_epi32(j, _mm_set1_epi32(K::PRIME_Y));
+    __m128i iNext = _mm_add_epi32(i, _mm_set1_epi32(K::PRIME_X));
+    __m128i jNext = _mm_add_epi32(j, _mm_set1_epi32(K::PRIME_Y));
+
+    __m128 a = _mm_sub_ps(_mm_sub_ps(half, _mm_mul_ps(x0, x0)), _mm_mul_ps(y0, y0));
+    __m128 aa = _mm_mul_ps(a, a);
+    __m128 n0 = _mm_mul_ps(_mm_mul_ps(aa, aa), simplexGradSSE(seed, i, j, x0, y0));
+    n0 = _mm_andnot_ps(_mm_cmple_ps(a, zero), n0);
+
+    __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(K::C_T), t), _mm_add_ps(_mm_set1_ps(K::C_A), a));
+    __m128 x2 = _mm_add_ps(x0, _mm_set1_ps(K::X2));
+    __m128 y2 = _mm_add_ps(y0, _mm_set1_ps(K::X2));
+    __m128 cc = _mm_mul_ps(c, c);
+    __m128 n2 = _mm_mul_ps(_mm_mul_ps(cc, cc), simplexGradSSE(seed, iNext, jNext, x2, y2));
+    n2 = _mm_andnot_ps(_mm_cmple_ps(c, zero), n2);
+
+    // Middle corner: (0, 1) above the diagonal, (1, 0) below it
+    __m128 upper = _mm_cmpgt_ps(y0, x0);
+    __m128 x1 = _mm_add_ps(x0, _mm_blendv_ps(_mm_set1_ps(K::G2_MINUS_1), _mm_set1_ps(K::G2), upper));
+    __m128 y1 = _mm_add_ps(y0, _mm_blendv_ps(_mm_set1_ps(K::G2), _mm_set1_ps(K::G2_MINUS_1), upper));
+    __m128i i1 = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(iNext), _mm_castsi128_ps(i), upper));
+    __m128i j1 = _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(j), _mm_castsi128_ps(jNext), upper));
+    __m128 b = _mm_sub_ps(_mm_sub_ps(half, _mm_mul_ps(x1, x1)), _mm_mul_ps(y1, y1));
+    __m128 bb = _mm_mul_ps(b, b);
+    __m128 n1 = _mm_mul_ps(_mm_mul_ps(bb, bb), simplexGradSSE(seed, i1, j1, x1, y1));
+    n1 = _mm_andnot_ps(_mm_cmple_ps(b, zero), n1);
+
+    return _mm_mul_ps(_mm_add_ps(_mm_add_ps(n0, n1), n2), _mm_set1_ps(K::SCALE));
+}
+
+NOISE_BATCH_TARGET("sse4.1")
+inline void simplexFillSSE(const FractalParams& p, const float* xs, const float* zs, int count, float* out) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    for (int n = 0; n < count; n += 4) {
+        // Pad the tail by repeating the last point
+        alignas(16) float px[4], pz[4], result[4];
+        for (int k = 0; k < 4; k++) {
+            int src = (n + k < count) ? n + k : count - 1;
+            px[k] = xs[src];
+            pz[k] = zs[src];
+        }
+
+        // Frequency and the OpenSimplex2 skew
+        __m128 x = _mm_mul_ps(_mm_load_ps(px), _mm_set1_ps(p.frequency));
+        __m128 y = _mm_mul_ps(_mm_load_ps(pz), _mm_set1_ps(p.frequency));
+        __m128 t = _mm_mul_ps(_mm_add_ps(x, y), _mm_set1_ps(SimplexConstants::F2));
+        x = _mm_add_ps(x, t);
+        y = _mm_add_ps(y, t);
+
+        __m128 value;
+        if (p.fractal == Fractal::None) {
+            value = simplexSingleSSE(_mm_set1_epi32(p.seed), x, y);
+        } else {
+            __m128 sum = _mm_setzero_ps();
+            float amp = p.bounding;
+            for (int octave = 0; octave < p.octaves; octave++) {
+                __m128 noise = simplexSingleSSE(_mm_set1_epi32(p.seed + octave), x, y);
+                if (p.fractal == Fractal::FBm) {
+                    sum = _mm_add_ps(sum, _mm_mul_ps(noise, _mm_set1_ps(amp)));
+                } else {
+                    noise = _mm_andnot_ps(signMask, noise);
+                    __m128 ridge = _mm_add_ps(_mm_mul_ps(noise, _mm_set1_ps(-2.0f)), _mm_set1_ps(1.0f));
+                    sum = _mm_add_ps(sum, _mm_mul_ps(ridge, _mm_set1_ps(amp)));
+                }
+                x = _mm_mul_ps(x, _mm_set1_ps(p.lacunarity));
+                y = _mm_mul_ps(y, _mm_set1_ps(p.lacunarity));
+                amp *= p.gain;
+            }
+            value = sum;
+        }
+
+        _mm_store_ps(result, value);
+        for (int k = 0; k < 4 && n + k < count; k++) out[n + k] = result[k];
+    }
+}
+
+// ---- AVX2: 8 points per iteration ----
+
+NOISE_BATCH_TARGET("avx2")
+inline __m256 simplexGradAVX2(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256 xd, __m256 yd) {
+    __m256i hash = _mm256_xor_si256(seed, _mm256_xor_si256(xPrimed, yPrimed));
+    hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32(SimplexConstants::HASH_MUL));
+    hash = _mm256_xor_si256(hash, _mm256_srai_epi32(hash, 15));
+    hash = _mm256_and_si256(hash, _mm256_set1_epi32(127 << 1));
+
+    const float* gradients = simplexGradients2D();
+    __m256 xg = _mm256_i32gather_ps(gradients, hash, 4);
+    __m256 yg = _mm256_i32gather_ps(gradients, _mm256_or_si256(hash, _mm256_set1_epi32(1)), 4);
+    return _mm256_add_ps(_mm256_mul_ps(xd, xg), _mm256_mul_ps(yd, yg));
+}
+
+NOISE_BATCH_TARGET("avx2")
+inline __m256 simplexSingleAVX2(__m256i seed, __m256 x, __m256 y) {
+    using K = SimplexConstants;
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 half = _mm256_set1_ps(0.5f);
+
+    // FastFloor: (int)f, minus one where f < 0
+    __m256i i = _mm256_add_epi32(_mm256_cvttps_epi32(x), _mm256_castps_si256(_mm256_cmp_ps(x, zero, _CMP_LT_OQ)));
+    __m256i j = _mm256_add_epi32(_mm256_cvttps_epi32(y), _mm256_castps_si256(_mm256_cmp_ps(y, zero, _CMP_LT_OQ)));
+    __m256 xi = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i));
+    __m256 yi = _mm256_sub_ps(y, _mm256_cvtepi32_ps(j));
+
+    __m256 t = _mm256_mul_ps(_mm256_add_ps(xi, yi), _mm256_set1_ps(K::G2));
+    __m256 x0 = _mm256_sub_ps(xi, t);
+    __m256 y0 = _mm256_sub_ps(yi, t);
+
+    i = _mm256_mullo_epi32(i, _mm256_set1_epi32(K::PRIME_X));
+    j = _mm256_mullo_epi32(j, _mm256_set1_epi32(K::PRIME_Y));
+    __m256i iNext = _mm256_add_epi32(i, _mm256_set1_epi32(K::PRIME_X));
+    __m256i jNext = _mm256_add_epi32(j, _mm256_set1_epi32(K::PRIME_Y));
+
+    __m256 a = _mm256_sub_ps(_mm256_sub_ps(half, _mm256_mul_ps(x0, x0)), _mm256_mul_ps(y0, y0));
+    __m256 aa = _mm256_mul_ps(a, a);
+    __m256 n0 = _mm256_mul_ps(_mm256_mul_ps(aa, aa), simplexGradAVX2(seed, i, j, x0, y0));
+    n0 = _mm256_andnot_ps(_mm256_cmp_ps(a, zero, _CMP_LE_OQ), n0);
+
+    __m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(K::C_T), t), _mm256_add_ps(_mm256_set1_ps(K::C_A), a));
+    __m256 x2 = _mm256_add_ps(x0, _mm256_set1_ps(K::X2));
+    __m256 y2 = _mm256_add_ps(y0, _mm256_set1_ps(K::X2));
+    __m256 cc = _mm256_mul_ps(c, c);
+    __m256 n2 = _mm256_mul_ps(_mm256_mul_ps(cc, cc), simplexGradAVX2(seed, iNext, jNext, x2, y2));
+    n2 = _mm256_andnot_ps(_mm256_cmp_ps(c, zero, _CMP_LE_OQ), n2);
+
+    // Middle corner: (0, 1) above the diagonal, (1, 0) below it
+    __m256 upper = _mm256_cmp_ps(y0, x0, _CMP_GT_OQ);
+    __m256 x1 = _mm256_add_ps(x0, _mm256_blendv_ps(_mm256_set1_ps(K::G2_MINUS_1), _mm256_set1_ps(K::G2), upper));
+    __m256 y1 = _mm256_add_ps(y0, _mm256_blendv_ps(_mm256_set1_ps(K::G2), _mm256_set1_ps(K::G2_MINUS_1), upper));
+    __m256i i1 = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(iNext), _mm256_castsi256_ps(i), upper));
+    __m256i j1 = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(j), _mm256_castsi256_ps(jNext), upper));
+    __m256 b = _mm256_sub_ps(_mm256_sub_ps(half, _mm256_mul_ps(x1, x1)), _mm256_mul_ps(y1, y1));
+    __m256 bb = _mm256_mul_ps(b, b);
+    __m256 n1 = _mm256_mul_ps(_mm256_mul_ps(bb, bb), simplexGradAVX2(seed, i1, j1, x1, y1));
+    n1 = _mm256_andnot_ps(_mm256_cmp_ps(b, zero, _CMP_LE_OQ), n1);
+
+    return _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(n0, n1), n2), _mm256_set1_ps(K::SCALE));
+}
+
+NOISE_BATCH_TARGET("avx2")
+inline void simplexFillAVX2(const FractalParams& p, const float* xs, const float* zs, int count, float* out) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    for (int n = 0; n < count; n += 8) {
+        // Pad the tail by repeating the last point
+        alignas(32) float px[8], pz[8], result[8];
+        for (int k = 0; k < 8; k++) {
+            int src = (n + k < count) ? n + k : count - 1;
+            px[k] = xs[src];
+            pz[k] = zs[src];
+        }
+
+        // Frequency and the OpenSimplex2 skew
+        __m256 x = _mm256_mul_ps(_mm256_load_ps(px), _mm256_set1_ps(p.frequency));
+        __m256 y = _mm256_mul_ps(_mm256_load_ps(pz), _mm256_set1_ps(p.frequency));
+        __m256 t = _mm256_mul_ps(_mm256_add_ps(x, y), _mm256_set1_ps(SimplexConstants::F2));
+        x = _mm256_add_ps(x, t);
+        y = _mm256_add_ps(y, t);
+
+        __m256 value;
+        if (p.fractal == Fractal::None) {
+            value = simplexSingleAVX2(_mm256_set1_epi32(p.seed), x, y);
+        } else {
+            __m256 sum = _mm256_setzero_ps();
+            float amp = p.bounding;
+            for (int octave = 0; octave < p.octaves; octave++) {
+                __m256 noise = simplexSingleAVX2(_mm256_set1_epi32(p.seed + octave), x, y);
+                if (p.fractal == Fractal::FBm) {
+                    sum = _mm256_add_ps(sum, _mm256_mul_ps(noise, _mm256_set1_ps(amp)));
+                } else {
+                    noise = _mm256_andnot_ps(signMask, noise);
+                    __m256 ridge = _mm256_add_ps(_mm256_mul_ps(noise, _mm256_set1_ps(-2.0f)), _mm256_set1_ps(1.0f));
+                    sum = _mm256_add_ps(sum, _mm256_mul_ps(ridge, _mm256_set1_ps(amp)));
+                }
+                x = _mm256_mul_ps(x, _mm256_set1_ps(p.lacunarity));
+                y = _mm256_mul_ps(y, _mm256_set1_ps(p.lacunarity));
+                amp *= p.gain;
+            }
+            value = sum;
+        }
+
+        _mm256_store_ps(result, value);
+        for (int k = 0; k < 8 && n + k < count; k++) out[n + k] = result[k];
+    }
+}
+
+#endif // NOISE_BATCH_X86
+
+// 2D OpenSimplex2 noise with a batch path. Owns its FastNoiseLite (the
+// scalar reference and the single-point path) and mirrors its settings,
+// which FastNoiseLite keeps private, for the SIMD kernels.
+class Simplex2D {
+public:
+    struct Settings {
+        int seed = 1337;
+        float frequency = 0.01f;
+        Fractal fractal = Fractal::None;
+        int octaves = 3;
+        float lacunarity = 2.0f;
+        float gain = 0.5f;
+    };
+
+    // Apply settings to the FastNoiseLite and pick the fastest backend that
+    // reproduces it exactly
+    void configure(const Settings& settings) {
+        noise = FastNoiseLite();
+        noise.SetSeed(settings.seed);
+        noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+        noise.SetFrequency(settings.frequency);
+        if (settings.fractal != Fractal::None) {
+            noise.SetFractalType(settings.fractal == Fractal::FBm ? FastNoiseLite::FractalType_FBm
+                                                                  : FastNoiseLite::FractalType_Ridged);
+            noise.SetFractalOctaves(settings.octaves);
+            noise.SetFractalLacunarity(settings.lacunarity);
+            noise.SetFractalGain(settings.gain);
+        }
+
+        // FastNoiseLite's fractal bounding: 1 / sum of octave amplitudes
+        float gain = settings.gain < 0 ? -settings.gain : settings.gain;
+        float amp = gain;
+        float ampFractal = 1.0f;
+        for (int i = 1; i < settings.octaves; i++) {
+            ampFractal += amp;
+            amp *= gain;
+        }
+        params = {settings.seed, settings.frequency, settings.fractal, settings.octaves,
+                  settings.lacunarity, settings.gain, 1 / ampFractal};
+
+        backend = detectBackend();
+        if (backend != Backend::Scalar && !matchesScalar()) backend = Backend::Scalar;
+    }
+
+    // Single sample (scalar FastNoiseLite)
+    float GetNoise(float x, float y) const { return noise.GetNoise(x, y); }
+
+    // out[i] = GetNoise(xs[i], zs[i])
+    void fill(const float* xs, const float* zs, int count, float* out) const {
+        if (count <= 0) return;
+        fillWith(backend, xs, zs, count, out);
+    }
+
+    Backend getBackend() const { return backend; }
+
+private:
+    FastNoiseLite noise;
+    FractalParams params{};
+    Backend backend = Backend::Scalar;
+
+    void fillWith(Backend with, const float* xs, const float* zs, int count, float* out) const {
+#if NOISE_BATCH_X86
+        if (with == Backend::AVX2) { simplexFillAVX2(params, xs, zs, count, out); return; }
+        if (with == Backend::SSE41) { simplexFillSSE(params, xs, zs, count, out); return; }
+#endif
+        for (int i = 0; i < count; i++) out[i] = noise.GetNoise(xs[i], zs[i]);
+    }
+
+    // Compare the SIMD backend with FastNoiseLite on probe points that cover
+    // negative coordinates, lattice edges and the far-lands float range
+    bool matchesScalar() const {
+        constexpr int PROBES = 512;
+        float xs[PROBES], zs[PROBES], simd[PROBES];
+        uint32_t state = 0x9E3779B9u;
+        for (int i = 0; i < PROBES; i++) {
+            state = state * 1664525u + 1013904223u;
+            float range = (i < PROBES / 2) ? 4096.0f : 1048576.0f;
+            xs[i] = (static_cast<float>(state >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+            state = state * 1664525u + 1013904223u;
+            zs[i] = (static_cast<float>(state >> 8) / 16777216.0f * 2.0f - 1.0f) * range;
+            if (i % 8 == 0) {
+                xs[i] = static_cast<float>(static_cast<int>(xs[i]));
+                zs[i] = static_cast<float>(static_cast<int>(zs[i]));
+            }
+        }
+        fillWith(backend, xs, zs, PROBES, simd);
+        for (int i = 0; i < PROBES; i++) {
+            if (simd[i] != noise.GetNoise(xs[i], zs[i])) return false;
+        }
+        return true;
+    }
+};
+
+// 2D grid: out[x + z * sizeX] = noise(float(originX + x) * scale + offset,
+//                                     float(originZ + z) * scale + offset)
+inline void fillGrid2D(const FastNoiseLite& noise, int originX, int originZ,
+                       int sizeX, int sizeZ, float* out,
+                       float scale = 1.0f, float offset = 0.0f) {
+    for (int z = 0; z < sizeZ; z++) {
+        float fz = static_cast<float>(originZ + z) * scale + offset;
+        float* row = out + z * sizeX;
+        for (int x = 0; x < sizeX; x++) {
+            row[x] = noise.GetNoise(static_cast<float>(originX + x) * scale + offset, fz);
+        }
+    }
+}
+
+inline void fillGrid2D(const Simplex2D& noise, int originX, int originZ,
+                       int sizeX, int sizeZ, float* out,
+                       float scale = 1.0f, float offset = 0.0f) {
+    constexpr int MAX_ROW = 64;
+    float xs[MAX_ROW], zs[MAX_ROW];
+    for (int z = 0; z < sizeZ; z++) {
+        float fz = static_cast<float>(originZ + z) * scale + offset;
+        for (int x0 = 0; x0 < sizeX; x0 += MAX_ROW) {
+            int span = (sizeX - x0 < MAX_ROW) ? sizeX - x0 : MAX_ROW;
+            for (int x = 0; x < span; x++) {
+                xs[x] = static_cast<float>(originX + x0 + x) * scale + offset;
+                zs[x] = fz;
+            }
+            noise.fill(xs, zs, span, out + z * sizeX + x0);
+        }
+    }
+}
+
+// Arbitrary points: out[i] = noise(xs[i], zs[i])
+inline void fillPoints2D(const Simplex2D& noise, const float* xs, const float* zs, int count, float* out) {
+    noise.fill(xs, zs, count, out);
+}
+
+// Vertical 3D column: out[i] = noise(float(worldX) * scaleX,
+//                                    float(yStart + i * yStep) * scaleY,
+//                                    float(worldZ) * scaleZ)
+inline void fillColumn3D(const FastNoiseLite& noise, int worldX, int worldZ,
+                         int yStart, int count, float* out,
+                         float scaleX, float scaleY, float scaleZ, int yStep = 1) {
+    float fx = static_cast<float>(worldX) * scaleX;
+    float fz = static_cast<float>(worldZ) * scaleZ;
+    for (int i = 0; i < count; i++) {
+        out[i] = noise.GetNoise(fx, static_cast<float>(yStart + i * yStep) * scaleY, fz);
+    }
+}
+
+} // namespace NoiseBatch
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "WorldView.h"
+#include "Chunk.h"
+#include "Block.h"
+#include "../core/Raycast.h"
+#include <glm/glm.hpp>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// ============================================
+// BATCHED VOXEL RAYCASTS
+// ============================================
+// Casts many rays (lighting probes, line-of-sight checks, highlight
+// prediction) in one call. All rays share one WorldView pinned over the
+// area they can reach, so the batch takes the chunk map lock once instead
+// of once per voxel. Each ray runs the same DDA as Raycast::cast and gives
+// the same hit.
+//
+// OPTIMIZATION: A ray looks up its chunk and section only when it crosses
+// into a new 16^3 section. Inside sections the occupancy summary says are
+// empty (or in unloaded chunks) it steps without reading blocks. A ray that
+// is above or below the world and moving away from it stops at once.
+//
+// Inputs and results are kept as parallel arrays (index = ray).
+// ============================================
+
+class RaycastBatch {
+public:
+    // Results of the last cast(), one entry per ray
+    struct Hits {
+        std::vector<uint8_t> hit;               // 1 if the ray hit a block
+        std::vector<glm::ivec3> blockPos;       // Block that was hit
+        std::vector<glm::ivec3> normal;         // Face normal (where a placed block would go)
+        std::vector<float> distance;            // Distance from the ray origin
+        std::vector<BlockType> block;           // Type of the block that was hit
+    };
+
+    // Widest square of chunk columns cast(World&) pins (radius in chunks)
+    static constexpr int MAX_PIN_RADIUS = 4;
+
+    // Queue a ray; returns its index in the results
+    size_t add(const glm::vec3& origin, const glm::vec3& direction, float maxDistance) {
+        float length = glm::length(direction);
+        origins.push_back(origin);
+        directions.push_back(length > 0.0f ? direction / length : glm::vec3(0.0f, 1.0f, 0.0f));
+        maxDistances.push_back(length > 0.0f ? maxDistance : 0.0f);
+        return origins.size() - 1;
+    }
+
+    size_t size() const { return origins.size(); }
+    bool empty() const { return origins.empty(); }
+
+    void clear() {
+        origins.clear();
+        directions.clear();
+        maxDistances.clear();
+    }
+
+    // Cast every ray against solid blocks, pinning the chunks the rays can reach
+    void cast(World& world) {
+        cast(world, [](BlockType type) { return isBlockSolid(type); });
+    }
+
+    template<typename BlockTest>
+    void cast(World& world, BlockTest stopsRay) {
+        if (origins.empty()) {
+            resizeHits();
+            return;
+        }
+
+        // Chunk bounds of everything the rays can reach
+        glm::vec2 lo(std::numeric_limits<float>::max());
+        glm::vec2 hi(std::numeric_limits<float>::lowest());
+        for (size_t i = 0; i < origins.size(); i++) {
+            glm::vec2 start(origins[i].x, origins[i].z);
+            glm::vec2 end = start + glm::vec2(directions[i].x, directions[i].z) * maxDistances[i];
+            lo = glm::min(lo, glm::min(start, end));
+            hi = glm::max(hi, glm::max(start, end));
+        }
+        glm::ivec2 chunkLo(static_cast<int>(std::floor(lo.x)) >> WorldView::CHUNK_SHIFT,
+                           static_cast<int>(std::floor(lo.y)) >> WorldView::CHUNK_SHIFT);
+        glm::ivec2 chunkHi(static_cast<int>(std::floor(hi.x)) >> WorldView::CHUNK_SHIFT,
+                           static_cast<int>(std::floor(hi.y)) >> WorldView::CHUNK_SHIFT);
+
+        // Rays that leave the pinned square still work, through World's locked lookup
+        glm::ivec2 center = (chunkLo + chunkHi) / 2;
+        int radius = std::max(std::max(center.x - chunkLo.x, chunkHi.x - center.x),
+                              std::max(center.y - chunkLo.y, chunkHi.y - center.y));
+        WorldView view(world, center, std::min(radius, MAX_PIN_RADIUS));
+        cast(view, stopsRay);
+    }
+
+    // Cast every ray through an existing view. stopsRay(BlockType) picks the
+    // blocks that end a ray; it must be false for AIR (empty sections are skipped).
+    template<typename BlockTest>
+    void cast(const WorldView& view, BlockTest stopsRay) {
+        resizeHits();
+        for (size_t i = 0; i < origins.size(); i++) {
+            castOne(view, i, stopsRay);
+        }
+    }
+
+    const Hits& getHits() const { return hits; }
+
+    // The whole hit for one ray as a RaycastHit (nullopt on a miss)
+    std::optional<RaycastHit> getHit(size_t ray) const {
+        if (!hits.hit[ray]) return std::nullopt;
+        RaycastHit result;
+        result.blockPos = hits.blockPos[ray];
+        result.normal = hits.normal[ray];
+        result.distance = hits.distance[ray];
+        result.hitPoint = origins[ray] + directions[ray] * hits.distance[ray];
+        return result;
+    }
+
+    // Voxels the last cast() stepped through, and how many of them needed a block read
+    size_t getVoxelsVisited() const { return voxelsVisited; }
+    size_t getBlocksRead() const { return blocksRead; }
+
+private:
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;     // Normalized
+    std::vector<float> maxDistances;
+    Hits hits;
+
+    size_t voxelsVisited = 0;
+    size_t blocksRead = 0;
+
+    void resizeHits() {
+        size_t count = origins.size();
+        hits.hit.assign(count, 0);
+        hits.blockPos.assign(count, glm::ivec3(0));
+        hits.normal.assign(count, glm::ivec3(0));
+        hits.distance.assign(count, 0.0f);
+        hits.block.assign(count, BlockType::AIR);
+        voxelsVisited = 0;
+        blocksRead = 0;
+    }
+
+    // DDA for one ray (same stepping as Raycast::cast)
+    template<typename BlockTest>
+    void castOne(const WorldView& view, size_t ray, BlockTest& stopsRay) {
+        const glm::vec3& origin = origins[ray];
+        const glm::vec3& dir = directions[ray];
+        float maxDistance = maxDistances[ray];
+
+        glm::ivec3 voxel(
+            static_cast<int>(floor(origin.x)),
+            static_cast<int>(floor(origin.y)),
+            static_cast<int>(floor(origin.z))
+        );
+        glm::ivec3 step(
+            (dir.x >= 0) ? 1 : -1,
+            (dir.y >= 0) ? 1 : -1,
+            (dir.z >= 0) ? 1 : -1
+        );
+
+        glm::vec3 tMax;
+        glm::vec3 tDelta;
+        for (int i = 0; i < 3; i++) {
+            if (std::abs(dir[i]) < 0.0001f) {
+                tMax[i] = std::numeric_limits<float>::infinity();
+                tDelta[i] = std::numeric_limits<float>::infinity();
+            } else {
+                float boundary = (step[i] > 0)
+                    ? static_cast<float>(voxel[i] + 1)
+                    : static_cast<float>(voxel[i]);
+                tMax[i] = (boundary - origin[i]) / dir[i];
+                tDelta[i] = static_cast<float>(step[i]) / dir[i];
+            }
+        }
+
+        // Section the ray is in (x/z chunk, y section) and what it holds
+        glm::ivec3 section(std::numeric_limits<int>::min());
+        const Chunk* chunk = nullptr;
+        bool sectionEmpty = true;
+
+        glm::ivec3 normal(0);
+        float distance = 0.0f;
+
+        while (distance < maxDistance) {
+            voxelsVisited++;
+
+            // Above and below the world get their own keys (-1 / CHUNK_SECTION_COUNT)
+            int sectionY = voxel.y < 0 ? -1
+                         : voxel.y >= CHUNK_SIZE_Y ? CHUNK_SECTION_COUNT
+                         : voxel.y / CHUNK_SECTION_HEIGHT;
+            glm::ivec3 current(voxel.x >> WorldView::CHUNK_SHIFT,
+                               sectionY,
+                               voxel.z >> WorldView::CHUNK_SHIFT);
+            if (current != section) {
+                section = current;
+                bool inWorld = voxel.y >= 0 && voxel.y < CHUNK_SIZE_Y;
+                if (!inWorld) {
+                    // Outside the world's height: nothing to hit unless the ray turns back in
+                    bool leaving = std::isinf(tMax.y) || (voxel.y < 0) == (step.y < 0);
+                    if (leaving) break;
+                    chunk = nullptr;
+                } else {
+                    chunk = view.chunkAt(voxel.x, voxel.z);
+                }
+                sectionEmpty = !chunk || chunk->sections[voxel.y / CHUNK_SECTION_HEIGHT].isAllAir();
+            }
+
+            if (!sectionEmpty) {
+                blocksRead++;
+                BlockType block = chunk->blocks[Chunk::toIndex(voxel.x & WorldView::CHUNK_MASK, voxel.y,
+                                                               voxel.z & WorldView::CHUNK_MASK)];
+                if (stopsRay(block)) {
+                    hits.hit[ray] = 1;
+                    hits.blockPos[ray] = voxel;
+                    hits.normal[ray] = normal;
+                    hits.distance[ray] = distance;
+                    hits.block[ray] = block;
+                    return;
+                }
+            }
+
+            if (tMax.x < tMax.y && tMax.x < tMax.z) {
+                distance = tMax.x;
+                tMax.x += tDelta.x;
+                voxel.x += step.x;
+                normal = glm::ivec3(-step.x, 0, 0);
+            } else if (tMax.y < tMax.z) {
+                distance = tMax.y;
+                tMax.y += tDelta.y;
+                voxel.y += step.y;
+                normal = glm::ivec3(0, -step.y, 0);
+            } else {
+                distance = tMax.z;
+                tMax.z += tDelta.z;
+                voxel.z += step.z;
+                normal = glm::ivec3(0, 0, -step.z);
+            }
+        }
+    }
+};
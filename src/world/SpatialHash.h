@@ -0,0 +1,125 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+// ============================================
+// SPATIAL HASH GRID
+// ============================================
+// Uniform grid over point positions for radius queries (item merging,
+// pickup). Rebuilt from scratch whenever the points move: cells are hashed
+// into a power-of-two bucket table and the points are counting-sorted by
+// bucket, so a rebuild is O(n) with no allocation once the buffers have
+// grown, and a query only touches the buckets of the cells it overlaps.
+//
+// Buckets are shared by colliding cells, so queries test real distance;
+// points that are close in space are also close in memory, which
+// forEachInBucketOrder() uses to walk points cluster by cluster.
+// ============================================
+
+class SpatialHashGrid {
+public:
+    explicit SpatialHashGrid(float cellSize = 1.0f)
+        : cellSize(cellSize), inverseCellSize(1.0f / cellSize) {}
+
+    // Rebuild over a set of positions (indices refer to this array)
+    void build(const std::vector<glm::vec3>& positions) {
+        size_t count = positions.size();
+
+        // ~2 buckets per point keeps collisions rare
+        size_t tableSize = 16;
+        while (tableSize < count * 2) tableSize <<= 1;
+        bucketMask = static_cast<uint32_t>(tableSize - 1);
+
+        bucketStart.assign(tableSize + 1, 0);
+        pointBuckets.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            uint32_t bucket = bucketOf(cellOf(positions[i]));
+            pointBuckets[i] = bucket;
+            bucketStart[bucket + 1]++;
+        }
+        for (size_t b = 0; b < tableSize; b++) {
+            bucketStart[b + 1] += bucketStart[b];
+        }
+
+        // Scatter into bucket order (bucketFill walks each bucket's range)
+        bucketFill.assign(bucketStart.begin(), bucketStart.end() - 1);
+        entries.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            Entry& entry = entries[bucketFill[pointBuckets[i]]++];
+            entry.position = positions[i];
+            entry.index = static_cast<uint32_t>(i);
+        }
+    }
+
+    // Call fn(index) for every point within radius of center
+    template<typename Fn>
+    void forEachInRadius(const glm::vec3& center, float radius, Fn&& fn) const {
+        if (entries.empty()) return;
+
+        glm::ivec3 minCell = cellOf(center - glm::vec3(radius));
+        glm::ivec3 maxCell = cellOf(center + glm::vec3(radius));
+        float radiusSq = radius * radius;
+
+        // Several cells can share a bucket; visit each bucket once
+        queryBuckets.clear();
+        for (int y = minCell.y; y <= maxCell.y; y++) {
+            for (int z = minCell.z; z <= maxCell.z; z++) {
+                for (int x = minCell.x; x <= maxCell.x; x++) {
+                    queryBuckets.push_back(bucketOf(glm::ivec3(x, y, z)));
+                }
+            }
+        }
+        std::sort(queryBuckets.begin(), queryBuckets.end());
+        queryBuckets.erase(std::unique(queryBuckets.begin(), queryBuckets.end()), queryBuckets.end());
+
+        for (uint32_t bucket : queryBuckets) {
+            for (uint32_t e = bucketStart[bucket]; e < bucketStart[bucket + 1]; e++) {
+                glm::vec3 offset = entries[e].position - center;
+                if (glm::dot(offset, offset) <= radiusSq) {
+                    fn(entries[e].index);
+                }
+            }
+        }
+    }
+
+    // Call fn(index) for every point, grouped by cell (as of the last build)
+    template<typename Fn>
+    void forEachInBucketOrder(Fn&& fn) const {
+        for (const Entry& entry : entries) fn(entry.index);
+    }
+
+    size_t size() const { return entries.size(); }
+    float getCellSize() const { return cellSize; }
+
+private:
+    struct Entry {
+        glm::vec3 position;
+        uint32_t index;
+    };
+
+    glm::ivec3 cellOf(const glm::vec3& position) const {
+        return glm::ivec3(glm::floor(position * inverseCellSize));
+    }
+
+    uint32_t bucketOf(const glm::ivec3& cell) const {
+        // Large primes (Teschner et al.) spread neighbouring cells across the table
+        uint32_t h = (static_cast<uint32_t>(cell.x) * 73856093u) ^
+                     (static_cast<uint32_t>(cell.y) * 19349663u) ^
+                     (static_cast<uint32_t>(cell.z) * 83492791u);
+        return h & bucketMask;
+    }
+
+    float cellSize;
+    float inverseCellSize;
+    uint32_t bucketMask = 0;
+
+    std::vector<uint32_t> bucketStart;   // Bucket b's entries are [bucketStart[b], bucketStart[b+1])
+    std::vector<uint32_t> bucketFill;
+    std::vector<uint32_t> pointBuckets;
+    std::vector<Entry> entries;          // Points in bucket order
+    mutable std::vector<uint32_t> queryBuckets;
+};
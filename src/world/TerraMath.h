@@ -12,6 +12,7 @@
 #include <sstream>
 #include <cctype>
 #include <algorithm>
+#include <cstdint>
 
 #include "FastNoiseLite.h"
 
@@ -495,6 +496,351 @@ private:
     }
 };
 
+// ============================================
+// BYTECODE COMPILER
+// Flattens the AST into register bytecode so the hot path does no
+// allocation, no map lookups and no string compares:
+// - variables live in fixed slots (see Variable)
+// - constant subtrees are folded at compile time
+// - builtins are resolved to opcodes once
+// Each register holds one value per lane, so a whole grid of columns
+// runs through every instruction in one tight loop.
+// ============================================
+enum Variable : uint16_t {
+    VAR_X, VAR_Z, VAR_SEED, VAR_BASE_HEIGHT, VAR_SEA_LEVEL,
+    VAR_CONTINENT, VAR_MOUNTAIN, VAR_DETAIL,
+    VAR_COUNT
+};
+
+inline int findVariable(const std::string& name) {
+    static const char* names[VAR_COUNT] = {
+        "x", "z", "seed", "baseHeight", "seaLevel", "continent", "mountain", "detail"
+    };
+    for (int i = 0; i < VAR_COUNT; i++) {
+        if (name == names[i]) return i;
+    }
+    return -1;
+}
+
+enum class OpCode : uint8_t {
+    ADD, SUB, MUL, DIV, POW, NEG,
+    SIN, COS, TAN, ABS, SQRT, FLOOR, CEIL, ROUND, EXP, LOG,
+    MIN, MAX, MOD, CLAMP, LERP, SMOOTHSTEP, TERRACE,
+    // Noise reads TerrainFunctions (seeded at runtime), so it is never folded
+    NOISE, RIDGE, FBM, VORONOI
+};
+
+struct Instruction {
+    OpCode op;
+    uint16_t dst;
+    uint16_t a, b, c;  // Source registers (unused operands point at register 0)
+};
+
+// Operation semantics, shared by constant folding and the lane loops
+namespace Ops {
+    inline double add(double a, double b, double) { return a + b; }
+    inline double sub(double a, double b, double) { return a - b; }
+    inline double mul(double a, double b, double) { return a * b; }
+    inline double div(double a, double b, double) { return b != 0 ? a / b : 0; }
+    inline double pow(double a, double b, double) { return std::pow(a, b); }
+    inline double neg(double a, double, double) { return -a; }
+    inline double sin(double a, double, double) { return std::sin(a); }
+    inline double cos(double a, double, double) { return std::cos(a); }
+    inline double tan(double a, double, double) { return std::tan(a); }
+    inline double abs(double a, double, double) { return std::abs(a); }
+    inline double sqrt(double a, double, double) { return std::sqrt(std::max(0.0, a)); }
+    inline double floor(double a, double, double) { return std::floor(a); }
+    inline double ceil(double a, double, double) { return std::ceil(a); }
+    inline double round(double a, double, double) { return std::round(a); }
+    inline double exp(double a, double, double) { return std::exp(a); }
+    inline double log(double a, double, double) { return a > 0 ? std::log(a) : 0; }
+    inline double min(double a, double b, double) { return std::min(a, b); }
+    inline double max(double a, double b, double) { return std::max(a, b); }
+    inline double mod(double a, double b, double) { return b != 0 ? std::fmod(a, b) : 0; }
+    inline double clamp(double a, double b, double c) { return std::clamp(a, b, c); }
+    inline double lerp(double a, double b, double c) { return a + (b - a) * c; }
+    inline double smoothstep(double edge0, double edge1, double x) {
+        double t = std::clamp((x - edge0) / (edge1 - edge0), 0.0, 1.0);
+        return t * t * (3 - 2 * t);
+    }
+    inline double terrace(double value, double steps, double) {
+        int n = static_cast<int>(steps);
+        if (n <= 1) return value;
+        return std::floor(value * n) / (n - 1);
+    }
+} // namespace Ops
+
+class CompiledExpression {
+public:
+    // Compile an AST; on failure returns false and sets error (same messages as evaluation)
+    bool compile(const ASTNodePtr& ast, std::string& error) {
+        code.clear();
+        constants.clear();
+        tempCount = 0;
+        try {
+            Operand result = compileNode(ast);
+            finalizeRegisters(result);
+        } catch (const std::exception& e) {
+            error = e.what();
+            code.clear();
+            return false;
+        }
+        error.clear();
+        return true;
+    }
+
+    size_t getInstructionCount() const { return code.size(); }
+
+    // Evaluate `lanes` independent inputs at once
+    // variableLanes[v] points to `lanes` values of variable v; results go to out[lanes]
+    void run(int lanes, const double* const* variableLanes, double* out, TerrainFunctions& funcs) {
+        int registerCount = VAR_COUNT + static_cast<int>(constants.size()) + tempCount;
+        registers.resize(static_cast<size_t>(registerCount) * lanes);
+
+        for (int v = 0; v < VAR_COUNT; v++) {
+            std::copy(variableLanes[v], variableLanes[v] + lanes, lane(v, lanes));
+        }
+        for (size_t k = 0; k < constants.size(); k++) {
+            double* dst = lane(VAR_COUNT + static_cast<int>(k), lanes);
+            std::fill(dst, dst + lanes, constants[k]);
+        }
+
+        for (const Instruction& ins : code) {
+            execute(ins, lanes, funcs);
+        }
+
+        const double* result = lane(resultRegister, lanes);
+        std::copy(result, result + lanes, out);
+    }
+
+private:
+    struct Operand {
+        uint16_t reg = 0;
+        bool isConstant = false;
+        double value = 0;
+    };
+
+    std::vector<Instruction> code;
+    std::vector<double> constants;   // Registers VAR_COUNT .. VAR_COUNT + constants.size() - 1
+    int tempCount = 0;               // Registers after the constants
+    uint16_t resultRegister = 0;
+    std::vector<double> registers;   // Scratch: register r, lane i at [r * lanes + i]
+
+    // Temps are numbered after the constants, which are only known once compilation
+    // ends, so they are encoded with this bias and rebased in finalizeRegisters()
+    static constexpr uint16_t TEMP_BIAS = 0x8000;
+
+    double* lane(int reg, int lanes) {
+        return registers.data() + static_cast<size_t>(reg) * lanes;
+    }
+
+    Operand constant(double value) {
+        if (constants.size() + VAR_COUNT >= TEMP_BIAS) throw std::runtime_error("Expression too complex");
+        constants.push_back(value);
+        return {static_cast<uint16_t>(VAR_COUNT + constants.size() - 1), true, value};
+    }
+
+    Operand emit(OpCode op, Operand a, Operand b, Operand c) {
+        if (tempCount + 1 >= TEMP_BIAS) throw std::runtime_error("Expression too complex");
+        uint16_t dst = static_cast<uint16_t>(TEMP_BIAS + tempCount++);
+        code.push_back({op, dst, a.reg, b.reg, c.reg});
+        return {dst, false, 0};
+    }
+
+    // Fold when every operand is constant and the op is pure, otherwise emit an instruction
+    Operand apply(OpCode op, Operand a, Operand b = Operand{0, true, 0}, Operand c = Operand{0, true, 0}) {
+        bool foldable = op != OpCode::NOISE && op != OpCode::RIDGE &&
+                        op != OpCode::FBM && op != OpCode::VORONOI;
+        if (foldable && a.isConstant && b.isConstant && c.isConstant) {
+            return constant(applyScalar(op, a.value, b.value, c.value));
+        }
+        return emit(op, a, b, c);
+    }
+
+    Operand compileNode(const ASTNodePtr& node) {
+        if (!node) return constant(0);
+
+        switch (node->type) {
+            case NodeType::NUMBER:
+                return constant(node->value);
+
+            case NodeType::VARIABLE: {
+                int slot = findVariable(node->name);
+                if (slot < 0) throw std::runtime_error("Unknown variable: " + node->name);
+                return {static_cast<uint16_t>(slot), false, 0};
+            }
+
+            case NodeType::BINARY_OP: {
+                Operand left = compileNode(node->children[0]);
+                Operand right = compileNode(node->children[1]);
+                switch (node->op) {
+                    case '+': return apply(OpCode::ADD, left, right);
+                    case '-': return apply(OpCode::SUB, left, right);
+                    case '*': return apply(OpCode::MUL, left, right);
+                    case '/': return apply(OpCode::DIV, left, right);
+                    case '^': return apply(OpCode::POW, left, right);
+                    default: return constant(0);
+                }
+            }
+
+            case NodeType::UNARY_OP: {
+                Operand val = compileNode(node->children[0]);
+                if (node->op == '-') return apply(OpCode::NEG, val);
+                return val;
+            }
+
+            case NodeType::FUNCTION_CALL:
+                return compileFunction(node);
+        }
+
+        return constant(0);
+    }
+
+    Operand compileFunction(const ASTNodePtr& node) {
+        struct Builtin { const char* name; OpCode op; int arity; };
+        static const Builtin builtins[] = {
+            {"sin", OpCode::SIN, 1}, {"cos", OpCode::COS, 1}, {"tan", OpCode::TAN, 1},
+            {"abs", OpCode::ABS, 1}, {"sqrt", OpCode::SQRT, 1}, {"floor", OpCode::FLOOR, 1},
+            {"ceil", OpCode::CEIL, 1}, {"round", OpCode::ROUND, 1}, {"exp", OpCode::EXP, 1},
+            {"log", OpCode::LOG, 1},
+            {"pow", OpCode::POW, 2}, {"min", OpCode::MIN, 2}, {"max", OpCode::MAX, 2},
+            {"mod", OpCode::MOD, 2},
+            {"clamp", OpCode::CLAMP, 3}, {"lerp", OpCode::LERP, 3}, {"smoothstep", OpCode::SMOOTHSTEP, 3},
+            {"noise", OpCode::NOISE, 2}, {"ridge", OpCode::RIDGE, 2}, {"fbm", OpCode::FBM, 2},
+            {"voronoi", OpCode::VORONOI, 2}, {"terrace", OpCode::TERRACE, 2}
+        };
+
+        const Builtin* builtin = nullptr;
+        for (const Builtin& candidate : builtins) {
+            if (node->name == candidate.name) builtin = &candidate;
+        }
+        int argCount = static_cast<int>(node->children.size());
+        if (!builtin || argCount < builtin->arity) {
+            throw std::runtime_error("Unknown function: " + node->name);
+        }
+
+        // fbm reads an optional third argument (octaves, default 4)
+        int used = builtin->op == OpCode::FBM ? std::min(argCount, 3) : builtin->arity;
+
+        // Every argument is compiled so unknown names still report, but the
+        // code for arguments the builtin never reads is dropped again
+        Operand args[3] = {{0, true, 0}, {0, true, 0}, {0, true, 0}};
+        size_t usedCodeSize = code.size();
+        for (int i = 0; i < argCount; i++) {
+            Operand arg = compileNode(node->children[i]);
+            if (i < used) {
+                args[i] = arg;
+                usedCodeSize = code.size();
+            }
+        }
+        code.resize(usedCodeSize);
+
+        if (builtin->op == OpCode::FBM && argCount < 3) {
+            args[2] = constant(4);
+        }
+        return apply(builtin->op, args[0], args[1], args[2]);
+    }
+
+    // Rebase temps to sit after the constants and record the result register
+    void finalizeRegisters(Operand result) {
+        if (VAR_COUNT + constants.size() + tempCount > UINT16_MAX) {
+            throw std::runtime_error("Expression too complex");
+        }
+        uint16_t tempBase = static_cast<uint16_t>(VAR_COUNT + constants.size());
+        auto rebase = [tempBase](uint16_t reg) -> uint16_t {
+            return reg >= TEMP_BIAS ? static_cast<uint16_t>(tempBase + (reg - TEMP_BIAS)) : reg;
+        };
+        for (Instruction& ins : code) {
+            ins.dst = rebase(ins.dst);
+            ins.a = rebase(ins.a);
+            ins.b = rebase(ins.b);
+            ins.c = rebase(ins.c);
+        }
+        resultRegister = rebase(result.reg);
+    }
+
+    static double applyScalar(OpCode op, double a, double b, double c) {
+        switch (op) {
+            case OpCode::ADD: return Ops::add(a, b, c);
+            case OpCode::SUB: return Ops::sub(a, b, c);
+            case OpCode::MUL: return Ops::mul(a, b, c);
+            case OpCode::DIV: return Ops::div(a, b, c);
+            case OpCode::POW: return Ops::pow(a, b, c);
+            case OpCode::NEG: return Ops::neg(a, b, c);
+            case OpCode::SIN: return Ops::sin(a, b, c);
+            case OpCode::COS: return Ops::cos(a, b, c);
+            case OpCode::TAN: return Ops::tan(a, b, c);
+            case OpCode::ABS: return Ops::abs(a, b, c);
+            case OpCode::SQRT: return Ops::sqrt(a, b, c);
+            case OpCode::FLOOR: return Ops::floor(a, b, c);
+            case OpCode::CEIL: return Ops::ceil(a, b, c);
+            case OpCode::ROUND: return Ops::round(a, b, c);
+            case OpCode::EXP: return Ops::exp(a, b, c);
+            case OpCode::LOG: return Ops::log(a, b, c);
+            case OpCode::MIN: return Ops::min(a, b, c);
+            case OpCode::MAX: return Ops::max(a, b, c);
+            case OpCode::MOD: return Ops::mod(a, b, c);
+            case OpCode::CLAMP: return Ops::clamp(a, b, c);
+            case OpCode::LERP: return Ops::lerp(a, b, c);
+            case OpCode::SMOOTHSTEP: return Ops::smoothstep(a, b, c);
+            case OpCode::TERRACE: return Ops::terrace(a, b, c);
+            default: return 0;
+        }
+    }
+
+    template<typename F>
+    static void forLanes(double* d, const double* a, const double* b, const double* c, int lanes, F f) {
+        for (int i = 0; i < lanes; i++) {
+            d[i] = f(a[i], b[i], c[i]);
+        }
+    }
+
+    void execute(const Instruction& ins, int lanes, TerrainFunctions& funcs) {
+        double* d = lane(ins.dst, lanes);
+        const double* a = lane(ins.a, lanes);
+        const double* b = lane(ins.b, lanes);
+        const double* c = lane(ins.c, lanes);
+
+        switch (ins.op) {
+            case OpCode::ADD: forLanes(d, a, b, c, lanes, Ops::add); break;
+            case OpCode::SUB: forLanes(d, a, b, c, lanes, Ops::sub); break;
+            case OpCode::MUL: forLanes(d, a, b, c, lanes, Ops::mul); break;
+            case OpCode::DIV: forLanes(d, a, b, c, lanes, Ops::div); break;
+            case OpCode::POW: forLanes(d, a, b, c, lanes, Ops::pow); break;
+            case OpCode::NEG: forLanes(d, a, b, c, lanes, Ops::neg); break;
+            case OpCode::SIN: forLanes(d, a, b, c, lanes, Ops::sin); break;
+            case OpCode::COS: forLanes(d, a, b, c, lanes, Ops::cos); break;
+            case OpCode::TAN: forLanes(d, a, b, c, lanes, Ops::tan); break;
+            case OpCode::ABS: forLanes(d, a, b, c, lanes, Ops::abs); break;
+            case OpCode::SQRT: forLanes(d, a, b, c, lanes, Ops::sqrt); break;
+            case OpCode::FLOOR: forLanes(d, a, b, c, lanes, Ops::floor); break;
+            case OpCode::CEIL: forLanes(d, a, b, c, lanes, Ops::ceil); break;
+            case OpCode::ROUND: forLanes(d, a, b, c, lanes, Ops::round); break;
+            case OpCode::EXP: forLanes(d, a, b, c, lanes, Ops::exp); break;
+            case OpCode::LOG: forLanes(d, a, b, c, lanes, Ops::log); break;
+            case OpCode::MIN: forLanes(d, a, b, c, lanes, Ops::min); break;
+            case OpCode::MAX: forLanes(d, a, b, c, lanes, Ops::max); break;
+            case OpCode::MOD: forLanes(d, a, b, c, lanes, Ops::mod); break;
+            case OpCode::CLAMP: forLanes(d, a, b, c, lanes, Ops::clamp); break;
+            case OpCode::LERP: forLanes(d, a, b, c, lanes, Ops::lerp); break;
+            case OpCode::SMOOTHSTEP: forLanes(d, a, b, c, lanes, Ops::smoothstep); break;
+            case OpCode::TERRACE: forLanes(d, a, b, c, lanes, Ops::terrace); break;
+            case OpCode::NOISE:
+                for (int i = 0; i < lanes; i++) d[i] = funcs.noise(a[i], b[i]);
+                break;
+            case OpCode::RIDGE:
+                for (int i = 0; i < lanes; i++) d[i] = funcs.ridge(a[i], b[i]);
+                break;
+            case OpCode::FBM:
+                for (int i = 0; i < lanes; i++) d[i] = funcs.fbm(a[i], b[i], static_cast<int>(c[i]));
+                break;
+            case OpCode::VORONOI:
+                for (int i = 0; i < lanes; i++) d[i] = funcs.voronoi(a[i], b[i]);
+                break;
+        }
+    }
+};
+
 // ============================================
 // TERRAIN EQUATION EVALUATOR
 // ============================================
@@ -514,11 +860,11 @@ public:
         errorMessage = parser.validate(expr);
         if (errorMessage.empty()) {
             ast = parser.parse(expr);
-            valid = true;
+            valid = program.compile(ast, errorMessage);
         } else {
             valid = false;
-            ast = nullptr;
         }
+        if (!valid) ast = nullptr;
         return valid;
     }
 
@@ -529,24 +875,63 @@ public:
     double evaluate(double x, double z,
                     double baseHeight, double seaLevel,
                     double continent, double mountain, double detail) {
-        if (!valid || !ast) return baseHeight;
-
-        std::unordered_map<std::string, double> vars;
-        vars["x"] = x;
-        vars["z"] = z;
-        vars["seed"] = static_cast<double>(functions.seed);
-        vars["baseHeight"] = baseHeight;
-        vars["seaLevel"] = seaLevel;
-        vars["continent"] = continent;
-        vars["mountain"] = mountain;
-        vars["detail"] = detail;
+        if (!valid) return baseHeight;
+
+        double values[VAR_COUNT];
+        values[VAR_X] = x;
+        values[VAR_Z] = z;
+        values[VAR_SEED] = static_cast<double>(functions.seed);
+        values[VAR_BASE_HEIGHT] = baseHeight;
+        values[VAR_SEA_LEVEL] = seaLevel;
+        values[VAR_CONTINENT] = continent;
+        values[VAR_MOUNTAIN] = mountain;
+        values[VAR_DETAIL] = detail;
+
+        const double* lanes[VAR_COUNT];
+        for (int v = 0; v < VAR_COUNT; v++) lanes[v] = &values[v];
+
+        double result;
+        program.run(1, lanes, &result, functions);
+        return result;
+    }
 
-        try {
-            return parser.evaluate(ast, vars, functions);
-        } catch (...) {
-            return baseHeight;
+    // OPTIMIZATION: Evaluate a whole grid of columns (e.g. 16x16 per chunk) in one call.
+    // Per-column inputs are indexed [x + z * sizeX]; out receives sizeX * sizeZ heights.
+    void evaluateGrid(int originX, int originZ, int sizeX, int sizeZ,
+                      double baseHeight, double seaLevel,
+                      const double* continent, const double* mountain, const double* detail,
+                      double* out) {
+        int count = sizeX * sizeZ;
+        if (!valid) {
+            std::fill(out, out + count, baseHeight);
+            return;
+        }
+
+        gridInputs.resize(static_cast<size_t>(count) * VAR_COUNT);
+        auto input = [&](int v) { return gridInputs.data() + static_cast<size_t>(v) * count; };
+
+        for (int z = 0; z < sizeZ; z++) {
+            for (int x = 0; x < sizeX; x++) {
+                input(VAR_X)[x + z * sizeX] = static_cast<double>(originX + x);
+                input(VAR_Z)[x + z * sizeX] = static_cast<double>(originZ + z);
+            }
         }
+        std::fill(input(VAR_SEED), input(VAR_SEED) + count, static_cast<double>(functions.seed));
+        std::fill(input(VAR_BASE_HEIGHT), input(VAR_BASE_HEIGHT) + count, baseHeight);
+        std::fill(input(VAR_SEA_LEVEL), input(VAR_SEA_LEVEL) + count, seaLevel);
+        std::copy(continent, continent + count, input(VAR_CONTINENT));
+        std::copy(mountain, mountain + count, input(VAR_MOUNTAIN));
+        std::copy(detail, detail + count, input(VAR_DETAIL));
+
+        const double* lanes[VAR_COUNT];
+        for (int v = 0; v < VAR_COUNT; v++) lanes[v] = input(v);
+
+        program.run(count, lanes, out, functions);
     }
+
+private:
+    CompiledExpression program;
+    std::vector<double> gridInputs;  // Scratch: VAR_COUNT lanes of sizeX * sizeZ
 };
 
 } // namespace TerraMath
@@ -2,6 +2,9 @@
 
 #include "Chunk.h"
 #include "Block.h"
+#include "NoiseBatch.h"
+#include "WorldPresets.h"
+#include "FeatureWrites.h"
 #include <FastNoiseLite.h>
 #include <random>
 #include <cmath>
@@ -38,13 +41,13 @@ public:
     // World seed
     int seed;
 
-    // Noise generators - Core terrain
-    FastNoiseLite continentNoise;    // Large scale continent/ocean distribution
-    FastNoiseLite erosionNoise;      // Terrain sharpness (high = flat, low = steep)
-    FastNoiseLite peaksValleysNoise; // Peaks and valleys (PV) - ridgeline features
-    FastNoiseLite mountainNoise;     // Mountain peaks (ridged fractal)
-    FastNoiseLite detailNoise;       // Small terrain details
-    FastNoiseLite riverNoise;        // River carving noise
+    // Noise generators - Core terrain (2D, batch-evaluated)
+    NoiseBatch::Simplex2D continentNoise;    // Large scale continent/ocean distribution
+    NoiseBatch::Simplex2D erosionNoise;      // Terrain sharpness (high = flat, low = steep)
+    NoiseBatch::Simplex2D peaksValleysNoise; // Peaks and valleys (PV) - ridgeline features
+    NoiseBatch::Simplex2D mountainNoise;     // Mountain peaks (ridged fractal)
+    NoiseBatch::Simplex2D detailNoise;       // Small terrain details
+    NoiseBatch::Simplex2D riverNoise;        // River carving noise
 
     // Noise generators - Caves
     FastNoiseLite caveNoise;         // 3D cave carving
@@ -52,11 +55,11 @@ public:
     FastNoiseLite oreNoise;          // Ore distribution
     FastNoiseLite aquiferNoise;      // Aquifer zones (where water spawns in caves)
 
-    // Noise generators - Biomes
-    FastNoiseLite temperatureNoise;  // Biome temperature
-    FastNoiseLite humidityNoise;     // Biome humidity
-    FastNoiseLite weirdnessNoise;    // Biome weirdness (rare biome variants)
-    FastNoiseLite blendNoise;        // Noise for biome blend randomization
+    // Noise generators - Biomes (2D, batch-evaluated)
+    NoiseBatch::Simplex2D temperatureNoise;  // Biome temperature
+    NoiseBatch::Simplex2D humidityNoise;     // Biome humidity
+    NoiseBatch::Simplex2D weirdnessNoise;    // Biome weirdness (rare biome variants)
+    NoiseBatch::Simplex2D blendNoise;        // Noise for biome blend randomization
 
     // Biome blending parameters
     static constexpr int BLEND_RADIUS = 4;        // Blend radius in blocks
@@ -68,6 +71,9 @@ public:
     int maxHeight = 128;
     int bedrockHeight = 5;
 
+    // Cave noise evaluation mode (per world; PER_VOXEL keeps older worlds' exact caves)
+    CaveSampling caveSampling = CaveSampling::PER_VOXEL;
+
     TerrainGenerator(int worldSeed = 12345) : seed(worldSeed) {
         setupNoiseGenerators();
     }
@@ -77,44 +83,79 @@ public:
         setupNoiseGenerators();
     }
 
-    // Generate terrain for a chunk
+    // Generate a chunk by running every stage in order
     void generateChunk(Chunk& chunk) {
+        generateTerrainStage(chunk);
+        generateCarvingStage(chunk);
+        generateFeatureStage(chunk);
+    }
+
+    // ============================================
+    // GENERATION STAGES
+    // Each stage only touches its own chunk (features that reach in from
+    // neighbours are re-evaluated here, see FeatureWrites.h), so no stage
+    // waits on a neighbour and chunks move through the stages in parallel on
+    // the worker threads. The stages share the column cache, so run them on
+    // one generator.
+    // ============================================
+
+    // Stage 1: noise - column cache, biome data and base terrain
+    void generateTerrainStage(Chunk& chunk) {
         glm::ivec2 chunkPos = chunk.position;
 
-        // First pass: Generate base terrain with height map and biome data
+        // Sample every column's noise once; all later stages read from the cache
+        buildColumnCache(chunkPos);
+
+        // Generate base terrain with height map and biome data
         for (int x = 0; x < CHUNK_SIZE_X; x++) {
             for (int z = 0; z < CHUNK_SIZE_Z; z++) {
                 // World coordinates
                 int worldX = chunkPos.x * CHUNK_SIZE_X + x;
                 int worldZ = chunkPos.y * CHUNK_SIZE_Z + z;
+                const ColumnData& column = getColumn(x, z);
 
-                // Sample biome temperature and humidity for this column
+                // Store biome temperature and humidity for this column
                 // Map from noise range (-1 to +1) to uint8_t range (0 to 255)
-                float temp = temperatureNoise.GetNoise(static_cast<float>(worldX), static_cast<float>(worldZ));
-                float humid = humidityNoise.GetNoise(static_cast<float>(worldX), static_cast<float>(worldZ));
                 int colIdx = x + z * CHUNK_SIZE_X;
-                chunk.biomeTemperature[colIdx] = static_cast<uint8_t>((temp + 1.0f) * 0.5f * 255.0f);
-                chunk.biomeHumidity[colIdx] = static_cast<uint8_t>((humid + 1.0f) * 0.5f * 255.0f);
-
-                // Calculate terrain height at this position
-                int terrainHeight = getTerrainHeight(worldX, worldZ);
+                chunk.biomeTemperature[colIdx] = static_cast<uint8_t>((column.terrain.temperature + 1.0f) * 0.5f * 255.0f);
+                chunk.biomeHumidity[colIdx] = static_cast<uint8_t>((column.terrain.humidity + 1.0f) * 0.5f * 255.0f);
 
-                // Fill column with blocks
+                // Fill column with blocks (built in a buffer, written in one pass)
                 for (int y = 0; y < CHUNK_SIZE_Y; y++) {
-                    BlockType block = getBlockAt(worldX, y, worldZ, terrainHeight);
-                    chunk.setBlock(x, y, z, block);
+                    columnBlocks[y] = getBlockAt(worldX, y, worldZ, column);
                 }
+                chunk.writeColumn(x, z, columnBlocks.data());
             }
         }
+    }
 
-        // Second pass: Carve caves
+    // Stage 2: carving - caves and aquifers
+    void generateCarvingStage(Chunk& chunk) {
         carveCaves(chunk);
+    }
 
-        // Third pass: Add ores
-        generateOres(chunk);
+    // Stage 3: features - ores, trees and decorations of this chunk and its 8
+    // neighbours, clipped to this chunk. Origins run in a fixed order (all
+    // ores, then all decorations) so overlapping features resolve the same
+    // way whichever chunk is generated first.
+    void generateFeatureStage(Chunk& chunk) {
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                glm::ivec2 origin = chunk.position + glm::ivec2(dx, dz);
+                FeatureWriter features(chunk, origin);
+                generateOres(origin, features);
+            }
+        }
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                glm::ivec2 origin = chunk.position + glm::ivec2(dx, dz);
+                FeatureWriter features(chunk, origin);
+                generateDecorations(origin, features);
+            }
+        }
 
-        // Fourth pass: Add trees and decorations
-        generateDecorations(chunk);
+        // All stages use deferred bulk writes - build heightmaps/section summaries once
+        chunk.finalizeBulkWrites();
     }
 
 private:
@@ -123,54 +164,29 @@ private:
         // CONTINENTALNESS - Very large scale, determines ocean vs land
         // Range: -1 (deep ocean) to +1 (inland)
         // ============================================
-        continentNoise.SetSeed(seed);
-        continentNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        continentNoise.SetFrequency(0.0008f);  // Very low frequency for large continents
-        continentNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
-        continentNoise.SetFractalOctaves(5);
-        continentNoise.SetFractalLacunarity(2.0f);
-        continentNoise.SetFractalGain(0.5f);
+        // Very low frequency for large continents
+        continentNoise.configure({seed, 0.0008f, NoiseBatch::Fractal::FBm, 5, 2.0f, 0.5f});
 
         // ============================================
         // EROSION - Controls terrain sharpness
         // Range: -1 (very steep/sharp) to +1 (flat/eroded)
         // ============================================
-        erosionNoise.SetSeed(seed + 1);
-        erosionNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        erosionNoise.SetFrequency(0.002f);
-        erosionNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
-        erosionNoise.SetFractalOctaves(3);
+        erosionNoise.configure({seed + 1, 0.002f, NoiseBatch::Fractal::FBm, 3});
 
         // ============================================
         // PEAKS & VALLEYS (PV) - Creates ridgelines and valleys
         // Range: -1 (deep valley) to +1 (sharp peak)
         // ============================================
-        peaksValleysNoise.SetSeed(seed + 2);
-        peaksValleysNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        peaksValleysNoise.SetFrequency(0.004f);
-        peaksValleysNoise.SetFractalType(FastNoiseLite::FractalType_Ridged);
-        peaksValleysNoise.SetFractalOctaves(4);
+        peaksValleysNoise.configure({seed + 2, 0.004f, NoiseBatch::Fractal::Ridged, 4});
 
         // Mountain noise - ridged fractal for sharp peaks
-        mountainNoise.SetSeed(seed + 3);
-        mountainNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        mountainNoise.SetFrequency(0.006f);
-        mountainNoise.SetFractalType(FastNoiseLite::FractalType_Ridged);
-        mountainNoise.SetFractalOctaves(4);
+        mountainNoise.configure({seed + 3, 0.006f, NoiseBatch::Fractal::Ridged, 4});
 
         // Detail noise - small bumps and variation
-        detailNoise.SetSeed(seed + 4);
-        detailNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        detailNoise.SetFrequency(0.02f);
-        detailNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
-        detailNoise.SetFractalOctaves(3);
+        detailNoise.configure({seed + 4, 0.02f, NoiseBatch::Fractal::FBm, 3});
 
         // River noise - winding river paths
-        riverNoise.SetSeed(seed + 5);
-        riverNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        riverNoise.SetFrequency(0.003f);
-        riverNoise.SetFractalType(FastNoiseLite::FractalType_Ridged);
-        riverNoise.SetFractalOctaves(2);
+        riverNoise.configure({seed + 5, 0.003f, NoiseBatch::Fractal::Ridged, 2});
 
         // ============================================
         // CAVE NOISE GENERATORS
@@ -197,32 +213,16 @@ private:
         // BIOME NOISE GENERATORS
         // ============================================
         // Temperature - affects hot/cold biomes
-        temperatureNoise.SetSeed(seed + 20);
-        temperatureNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        temperatureNoise.SetFrequency(0.0012f);
-        temperatureNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
-        temperatureNoise.SetFractalOctaves(3);
+        temperatureNoise.configure({seed + 20, 0.0012f, NoiseBatch::Fractal::FBm, 3});
 
         // Humidity - affects wet/dry biomes
-        humidityNoise.SetSeed(seed + 21);
-        humidityNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        humidityNoise.SetFrequency(0.0015f);
-        humidityNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
-        humidityNoise.SetFractalOctaves(3);
+        humidityNoise.configure({seed + 21, 0.0015f, NoiseBatch::Fractal::FBm, 3});
 
         // Weirdness - determines rare/unusual biome variants
-        weirdnessNoise.SetSeed(seed + 22);
-        weirdnessNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        weirdnessNoise.SetFrequency(0.002f);
-        weirdnessNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
-        weirdnessNoise.SetFractalOctaves(2);
+        weirdnessNoise.configure({seed + 22, 0.002f, NoiseBatch::Fractal::FBm, 2});
 
         // Blend noise - adds natural variation to biome boundaries
-        blendNoise.SetSeed(seed + 30);
-        blendNoise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-        blendNoise.SetFrequency(0.05f);
-        blendNoise.SetFractalType(FastNoiseLite::FractalType_FBm);
-        blendNoise.SetFractalOctaves(2);
+        blendNoise.configure({seed + 30, 0.05f, NoiseBatch::Fractal::FBm, 2});
     }
 
     // ============================================
@@ -243,23 +243,33 @@ private:
 
     // Get all terrain data for a position (used for blending)
     TerrainData getTerrainData(int worldX, int worldZ) {
-        float x = static_cast<float>(worldX);
-        float z = static_cast<float>(worldZ);
-
-        TerrainData data;
+        return getTerrainData(static_cast<float>(worldX), static_cast<float>(worldZ));
+    }
 
+    TerrainData getTerrainData(float x, float z) {
         // Sample all noise values
-        data.continentalness = continentNoise.GetNoise(x, z);
-        data.erosion = erosionNoise.GetNoise(x, z);
-        data.peaksValleys = peaksValleysNoise.GetNoise(x, z);
-        data.temperature = temperatureNoise.GetNoise(x, z);
-        data.humidity = humidityNoise.GetNoise(x, z);
-        data.weirdness = weirdnessNoise.GetNoise(x, z);
-        data.river = riverNoise.GetNoise(x, z);
+        return makeTerrainData(continentNoise.GetNoise(x, z), erosionNoise.GetNoise(x, z),
+                               peaksValleysNoise.GetNoise(x, z), temperatureNoise.GetNoise(x, z),
+                               humidityNoise.GetNoise(x, z), weirdnessNoise.GetNoise(x, z),
+                               riverNoise.GetNoise(x, z), mountainNoise.GetNoise(x, z),
+                               detailNoise.GetNoise(x, z));
+    }
+
+    // Build terrain data from already-sampled noise values
+    TerrainData makeTerrainData(float continentalness, float erosion, float pv,
+                                float temperature, float humidity, float weirdness,
+                                float river, float mountain, float detail) {
+        TerrainData data;
+        data.continentalness = continentalness;
+        data.erosion = erosion;
+        data.peaksValleys = pv;
+        data.temperature = temperature;
+        data.humidity = humidity;
+        data.weirdness = weirdness;
+        data.river = river;
 
         // Calculate height based on terrain parameters
-        data.height = calculateHeight(data.continentalness, data.erosion,
-                                      data.peaksValleys, x, z);
+        data.height = calculateHeight(continentalness, erosion, pv, mountain, detail);
 
         // Determine biome
         data.biome = selectBiome(data);
@@ -268,8 +278,9 @@ private:
     }
 
     // Calculate terrain height using continentalness, erosion, and PV
+    // mountain/detail are mountainNoise/detailNoise sampled at the same position
     int calculateHeight(float continentalness, float erosion, float pv,
-                        float x, float z) {
+                        float mountain, float detail) {
         // ============================================
         // CONTINENTALNESS HEIGHT MAPPING
         // Maps continentalness to base terrain height
@@ -327,7 +338,7 @@ private:
         // ============================================
         // MOUNTAIN PEAKS (additional ridged noise)
         // ============================================
-        float mountainValue = (mountainNoise.GetNoise(x, z) + 1.0f) * 0.5f;
+        float mountainValue = (mountain + 1.0f) * 0.5f;
         mountainValue = mountainValue * mountainValue * mountainValue;  // Cube for sharper peaks
 
         float mountainContribution = 0.0f;
@@ -342,7 +353,6 @@ private:
         // DETAIL NOISE
         // Small-scale terrain variation
         // ============================================
-        float detail = detailNoise.GetNoise(x, z);
         float detailContribution = detail * 3.0f * erosionFactor;
 
         // ============================================
@@ -449,10 +459,114 @@ private:
         return Biome::PLAINS;
     }
 
-    // Legacy getBiome function - now uses TerrainData internally
-    Biome getBiome(int worldX, int worldZ) {
-        TerrainData data = getTerrainData(worldX, worldZ);
-        return data.biome;
+    // ============================================
+    // PER-CHUNK COLUMN CACHE
+    // Noise is sampled once per column and every generation pass reads
+    // from here instead of re-sampling. The cache also covers a halo as wide
+    // as the furthest feature reach, so the feature stage can place the
+    // neighbours' trees that overhang this chunk.
+    // ============================================
+
+    // Furthest a decoration reaches from its column (dark oak / acacia canopy)
+    static constexpr int FEATURE_REACH = 4;
+    static constexpr int COLUMN_HALO = FEATURE_REACH;
+    static constexpr int COLUMN_GRID_SIZE = CHUNK_SIZE_X + 2 * COLUMN_HALO;
+    static_assert(CHUNK_SIZE_X == CHUNK_SIZE_Z, "column halo grid assumes square chunks");
+
+    struct ColumnData {
+        TerrainData terrain;  // Climate/river noise, unblended height and biome
+        int height;           // Blended terrain height
+    };
+
+    // Final per-column data for the chunk being generated and its halo
+    std::array<ColumnData, COLUMN_GRID_SIZE * COLUMN_GRID_SIZE> columns;
+
+    // Blend sample pattern around each column (before jitter)
+    static constexpr int BLEND_SAMPLES = 8;
+    static constexpr int BLEND_OFFSETS[BLEND_SAMPLES][2] = {
+        {-BLEND_RADIUS, 0}, {BLEND_RADIUS, 0},
+        {0, -BLEND_RADIUS}, {0, BLEND_RADIUS},
+        {-BLEND_RADIUS, -BLEND_RADIUS}, {BLEND_RADIUS, -BLEND_RADIUS},
+        {-BLEND_RADIUS, BLEND_RADIUS}, {BLEND_RADIUS, BLEND_RADIUS}
+    };
+
+    // Batch-sampled terrain noise. Points 0..COLUMN_COUNT-1 are the cached
+    // columns, followed by BLEND_SAMPLES jittered blend samples per column.
+    static constexpr int COLUMN_COUNT = COLUMN_GRID_SIZE * COLUMN_GRID_SIZE;
+    static constexpr int TERRAIN_POINTS = COLUMN_COUNT * (1 + BLEND_SAMPLES);
+    enum TerrainNoise { NOISE_CONTINENT, NOISE_EROSION, NOISE_PV, NOISE_TEMPERATURE, NOISE_HUMIDITY,
+                        NOISE_WEIRDNESS, NOISE_RIVER, NOISE_MOUNTAIN, NOISE_DETAIL, TERRAIN_NOISE_COUNT };
+    std::array<float, TERRAIN_POINTS> pointX;
+    std::array<float, TERRAIN_POINTS> pointZ;
+    std::array<std::array<float, TERRAIN_POINTS>, TERRAIN_NOISE_COUNT> pointNoise;
+
+    // Blend jitter planes for the cached columns
+    std::array<float, COLUMN_COUNT> blendJitterX;
+    std::array<float, COLUMN_COUNT> blendJitterZ;
+
+    // Scratch column for bulk block writes (base fill, cave carving)
+    std::array<BlockType, CHUNK_SIZE_Y> columnBlocks;
+
+    // Chunk-local lookup (-COLUMN_HALO .. CHUNK_SIZE_X + COLUMN_HALO - 1)
+    const ColumnData& getColumn(int x, int z) const {
+        return columns[(x + COLUMN_HALO) + (z + COLUMN_HALO) * COLUMN_GRID_SIZE];
+    }
+
+    TerrainData getPointData(int point) {
+        return makeTerrainData(pointNoise[NOISE_CONTINENT][point], pointNoise[NOISE_EROSION][point],
+                               pointNoise[NOISE_PV][point], pointNoise[NOISE_TEMPERATURE][point],
+                               pointNoise[NOISE_HUMIDITY][point], pointNoise[NOISE_WEIRDNESS][point],
+                               pointNoise[NOISE_RIVER][point], pointNoise[NOISE_MOUNTAIN][point],
+                               pointNoise[NOISE_DETAIL][point]);
+    }
+
+    // Fill the column cache for a chunk (call before any generation pass)
+    void buildColumnCache(glm::ivec2 chunkPos) {
+        int originX = chunkPos.x * CHUNK_SIZE_X - COLUMN_HALO;
+        int originZ = chunkPos.y * CHUNK_SIZE_Z - COLUMN_HALO;
+
+        // Blend jitter (same sample positions as the per-column blendNoise calls)
+        NoiseBatch::fillGrid2D(blendNoise, originX, originZ, COLUMN_GRID_SIZE, COLUMN_GRID_SIZE,
+                               blendJitterX.data(), 0.5f);
+        NoiseBatch::fillGrid2D(blendNoise, originX, originZ, COLUMN_GRID_SIZE, COLUMN_GRID_SIZE,
+                               blendJitterZ.data(), 0.5f, 100.0f);
+
+        // Columns, then their blend samples at the same float positions the
+        // per-column code used (the jitter is fractional, so they are off-grid)
+        for (int z = 0; z < COLUMN_GRID_SIZE; z++) {
+            for (int x = 0; x < COLUMN_GRID_SIZE; x++) {
+                int colIdx = x + z * COLUMN_GRID_SIZE;
+                float fx = static_cast<float>(originX + x);
+                float fz = static_cast<float>(originZ + z);
+                pointX[colIdx] = fx;
+                pointZ[colIdx] = fz;
+
+                float noiseOffsetX = blendJitterX[colIdx] * 2.0f;
+                float noiseOffsetZ = blendJitterZ[colIdx] * 2.0f;
+                for (int s = 0; s < BLEND_SAMPLES; s++) {
+                    int point = COLUMN_COUNT + colIdx * BLEND_SAMPLES + s;
+                    pointX[point] = fx + BLEND_OFFSETS[s][0] + noiseOffsetX;
+                    pointZ[point] = fz + BLEND_OFFSETS[s][1] + noiseOffsetZ;
+                }
+            }
+        }
+
+        // Batch-sample each terrain noise over every point
+        const NoiseBatch::Simplex2D* sources[TERRAIN_NOISE_COUNT] = {
+            &continentNoise, &erosionNoise, &peaksValleysNoise, &temperatureNoise, &humidityNoise,
+            &weirdnessNoise, &riverNoise, &mountainNoise, &detailNoise
+        };
+        for (int n = 0; n < TERRAIN_NOISE_COUNT; n++) {
+            NoiseBatch::fillPoints2D(*sources[n], pointX.data(), pointZ.data(), TERRAIN_POINTS,
+                                     pointNoise[n].data());
+        }
+
+        for (int colIdx = 0; colIdx < COLUMN_COUNT; colIdx++) {
+            columns[colIdx].terrain = getPointData(colIdx);
+        }
+        for (int colIdx = 0; colIdx < COLUMN_COUNT; colIdx++) {
+            columns[colIdx].height = getBlendedTerrainHeight(colIdx);
+        }
     }
 
     // ============================================
@@ -465,7 +579,8 @@ private:
         float continentalness = continentNoise.GetNoise(x, z);
         float erosion = erosionNoise.GetNoise(x, z);
         float pv = peaksValleysNoise.GetNoise(x, z);
-        return calculateHeight(continentalness, erosion, pv, x, z);
+        return calculateHeight(continentalness, erosion, pv,
+                               mountainNoise.GetNoise(x, z), detailNoise.GetNoise(x, z));
     }
 
     // Check if two biomes should blend (same category)
@@ -534,56 +649,22 @@ private:
         return t * t * (3.0f - 2.0f * t);  // Smoothstep
     }
 
-    // Get terrain height with biome blending
-    int getBlendedTerrainHeight(int worldX, int worldZ) {
-        float x = static_cast<float>(worldX);
-        float z = static_cast<float>(worldZ);
-
+    // Get terrain height with biome blending (reads the batched blend samples)
+    int getBlendedTerrainHeight(int colIdx) {
         // Get center point data
-        TerrainData centerData = getTerrainData(worldX, worldZ);
+        const TerrainData& centerData = columns[colIdx].terrain;
         Biome centerBiome = centerData.biome;
         int centerHeight = centerData.height;
 
-        // Add noise-based offset to break up grid patterns
-        float noiseOffsetX = blendNoise.GetNoise(x * 0.5f, z * 0.5f) * 2.0f;
-        float noiseOffsetZ = blendNoise.GetNoise(x * 0.5f + 100.0f, z * 0.5f + 100.0f) * 2.0f;
-
         // Sample surrounding points for blending
         float totalWeight = 1.0f;  // Center point weight
         float weightedHeight = static_cast<float>(centerHeight);
 
-        // Sample in a pattern around the center
-        const int sampleOffsets[][2] = {
-            {-BLEND_RADIUS, 0}, {BLEND_RADIUS, 0},
-            {0, -BLEND_RADIUS}, {0, BLEND_RADIUS},
-            {-BLEND_RADIUS, -BLEND_RADIUS}, {BLEND_RADIUS, -BLEND_RADIUS},
-            {-BLEND_RADIUS, BLEND_RADIUS}, {BLEND_RADIUS, BLEND_RADIUS}
-        };
+        for (int s = 0; s < BLEND_SAMPLES; s++) {
+            const int* offset = BLEND_OFFSETS[s];
 
-        for (const auto& offset : sampleOffsets) {
-            float sampleX = x + offset[0] + noiseOffsetX;
-            float sampleZ = z + offset[1] + noiseOffsetZ;
-
-            // Get biome at sample point
-            float sampleCont = continentNoise.GetNoise(sampleX, sampleZ);
-            float sampleEros = erosionNoise.GetNoise(sampleX, sampleZ);
-            float samplePV = peaksValleysNoise.GetNoise(sampleX, sampleZ);
-            float sampleTemp = temperatureNoise.GetNoise(sampleX, sampleZ);
-            float sampleHum = humidityNoise.GetNoise(sampleX, sampleZ);
-            float sampleWeird = weirdnessNoise.GetNoise(sampleX, sampleZ);
-            float sampleRiver = riverNoise.GetNoise(sampleX, sampleZ);
-
-            // Build temporary TerrainData for biome selection
-            TerrainData sampleData;
-            sampleData.continentalness = sampleCont;
-            sampleData.erosion = sampleEros;
-            sampleData.peaksValleys = samplePV;
-            sampleData.temperature = sampleTemp;
-            sampleData.humidity = sampleHum;
-            sampleData.weirdness = sampleWeird;
-            sampleData.river = sampleRiver;
-            sampleData.height = calculateHeight(sampleCont, sampleEros, samplePV, sampleX, sampleZ);
-            sampleData.biome = selectBiome(sampleData);
+            // Get biome at the (jittered) sample point
+            TerrainData sampleData = getPointData(COLUMN_COUNT + colIdx * BLEND_SAMPLES + s);
 
             // Check if this sample should contribute to blending
             if (sampleData.biome != centerBiome && shouldBlendBiomes(centerBiome, sampleData.biome)) {
@@ -600,13 +681,10 @@ private:
         return static_cast<int>(weightedHeight / totalWeight);
     }
 
-    // Get terrain height using the new blended system
-    int getTerrainHeight(int worldX, int worldZ) {
-        return getBlendedTerrainHeight(worldX, worldZ);
-    }
-
     // Determine block type at position
-    BlockType getBlockAt(int worldX, int y, int worldZ, int terrainHeight) {
+    BlockType getBlockAt(int worldX, int y, int worldZ, const ColumnData& column) {
+        int terrainHeight = column.height;
+
         // Bedrock layer (with some variation)
         if (y == 0) {
             return BlockType::BEDROCK;
@@ -632,7 +710,7 @@ private:
         }
 
         // Get biome for surface block decisions
-        Biome biome = getBiome(worldX, worldZ);
+        Biome biome = column.terrain.biome;
 
         // Surface block
         if (y == terrainHeight) {
@@ -755,22 +833,165 @@ private:
         return BlockType::STONE;
     }
 
+    // ============================================
+    // BATCHED CAVE NOISE
+    // ============================================
+
+    // 3D cave noise channels sampled per column (index = y - 1)
+    enum CaveChannel { CAVE_CHEESE, CAVE_CHEESE2, CAVE_SPAGHETTI1, CAVE_SPAGHETTI2,
+                       CAVE_WIDE1, CAVE_WIDE2, CAVE_SMALL1, CAVE_SMALL2, CAVE_CHANNEL_COUNT };
+    std::array<std::array<float, CHUNK_SIZE_Y>, CAVE_CHANNEL_COUNT> caveColumn;
+
+    // Per-chunk 2D cave planes (index = x + z * CHUNK_SIZE_X)
+    std::array<float, CHUNK_SIZE_X * CHUNK_SIZE_Z> caveEntranceNoise;
+    std::array<float, CHUNK_SIZE_X * CHUNK_SIZE_Z> caveEntranceNoise2;
+    std::array<float, CHUNK_SIZE_X * CHUNK_SIZE_Z> caveUnderwaterNoise;
+
+    // Noise source and coordinate scales of each channel
+    struct CaveChannelDesc { bool secondary; float sx, sy, sz; };
+    static constexpr CaveChannelDesc CAVE_CHANNELS[CAVE_CHANNEL_COUNT] = {
+        {false, 0.4f, 0.25f, 0.4f},   // Cheese
+        {true,  0.3f, 0.2f,  0.3f},   // Cheese (secondary)
+        {false, 0.7f, 0.7f,  0.7f},   // Spaghetti
+        {true,  0.7f, 1.2f,  0.7f},
+        {false, 0.5f, 0.4f,  0.5f},   // Wide tunnels
+        {true,  0.4f, 0.5f,  0.4f},
+        {false, 1.2f, 1.0f,  1.2f},   // Small connecting tunnels
+        {true,  1.1f, 1.5f,  1.1f},
+    };
+
+    const FastNoiseLite& caveChannelNoise(int channel) const {
+        return CAVE_CHANNELS[channel].secondary ? caveNoise2 : caveNoise;
+    }
+
+    // Fill caveColumn for y = 1..yTop at one column (exact, one sample per block)
+    void sampleCaveColumn(int worldX, int worldZ, int yTop) {
+        if (yTop < 1) return;
+        for (int c = 0; c < CAVE_CHANNEL_COUNT; c++) {
+            const CaveChannelDesc& ch = CAVE_CHANNELS[c];
+            NoiseBatch::fillColumn3D(caveChannelNoise(c), worldX, worldZ, 1, yTop, caveColumn[c].data(),
+                                     ch.sx, ch.sy, ch.sz);
+        }
+    }
+
+    // ============================================
+    // COARSE CAVE LATTICE (CaveSampling::COARSE_LATTICE)
+    // Cave noise is sampled every 4x8x4 blocks and trilinearly interpolated.
+    // Lattice points sit on world-aligned multiples of the cell size, so
+    // neighbouring chunks share their border samples and caves stay seamless
+    // ============================================
+    static constexpr int CAVE_CELL_XZ = 4;
+    static constexpr int CAVE_CELL_Y = 8;
+    static constexpr int CAVE_LATTICE_XZ = CHUNK_SIZE_X / CAVE_CELL_XZ + 1;
+    static constexpr int CAVE_LATTICE_Y = CHUNK_SIZE_Y / CAVE_CELL_Y + 1;
+
+    // [channel][(lx + lz * CAVE_LATTICE_XZ) * CAVE_LATTICE_Y + ly]
+    std::array<std::array<float, CAVE_LATTICE_XZ * CAVE_LATTICE_XZ * CAVE_LATTICE_Y>, CAVE_CHANNEL_COUNT> caveLattice;
+    int caveLatticeLayers = 0;  // Lattice layers actually sampled this chunk
+
+    // Sample the lattice up to yTop (highest block any column can carve)
+    void sampleCaveLattice(int originX, int originZ, int yTop) {
+        // Layers 0..yTop / CAVE_CELL_Y + 1 bracket every y up to yTop, including
+        // y on a layer boundary (which still reads the layer above it)
+        caveLatticeLayers = std::min(CAVE_LATTICE_Y, yTop / CAVE_CELL_Y + 2);
+        for (int c = 0; c < CAVE_CHANNEL_COUNT; c++) {
+            const CaveChannelDesc& ch = CAVE_CHANNELS[c];
+            for (int lz = 0; lz < CAVE_LATTICE_XZ; lz++) {
+                for (int lx = 0; lx < CAVE_LATTICE_XZ; lx++) {
+                    float* column = &caveLattice[c][(lx + lz * CAVE_LATTICE_XZ) * CAVE_LATTICE_Y];
+                    NoiseBatch::fillColumn3D(caveChannelNoise(c), originX + lx * CAVE_CELL_XZ,
+                                             originZ + lz * CAVE_CELL_XZ, 0, caveLatticeLayers, column,
+                                             ch.sx, ch.sy, ch.sz, CAVE_CELL_Y);
+                }
+            }
+        }
+    }
+
+    // Fill caveColumn for y = 1..yTop at local column (x, z) by interpolating the lattice
+    void interpolateCaveColumn(int x, int z, int yTop) {
+        if (yTop < 1) return;
+        int lx = x / CAVE_CELL_XZ;
+        int lz = z / CAVE_CELL_XZ;
+        float tx = static_cast<float>(x % CAVE_CELL_XZ) / CAVE_CELL_XZ;
+        float tz = static_cast<float>(z % CAVE_CELL_XZ) / CAVE_CELL_XZ;
+        float w00 = (1.0f - tx) * (1.0f - tz);
+        float w10 = tx * (1.0f - tz);
+        float w01 = (1.0f - tx) * tz;
+        float w11 = tx * tz;
+
+        for (int c = 0; c < CAVE_CHANNEL_COUNT; c++) {
+            const float* c00 = &caveLattice[c][(lx + lz * CAVE_LATTICE_XZ) * CAVE_LATTICE_Y];
+            const float* c10 = c00 + CAVE_LATTICE_Y;
+            const float* c01 = c00 + CAVE_LATTICE_XZ * CAVE_LATTICE_Y;
+            const float* c11 = c01 + CAVE_LATTICE_Y;
+
+            // Bilinear in XZ at each lattice layer, then linear in Y
+            float layer[CAVE_LATTICE_Y];
+            for (int ly = 0; ly < caveLatticeLayers; ly++) {
+                layer[ly] = c00[ly] * w00 + c10[ly] * w10 + c01[ly] * w01 + c11[ly] * w11;
+            }
+            float* out = caveColumn[c].data();
+            for (int y = 1; y <= yTop; y++) {
+                int ly = y / CAVE_CELL_Y;
+                int lyNext = std::min(ly + 1, caveLatticeLayers - 1);
+                float ty = static_cast<float>(y % CAVE_CELL_Y) / CAVE_CELL_Y;
+                out[y - 1] = layer[ly] + (layer[lyNext] - layer[ly]) * ty;
+            }
+        }
+    }
+
     // Carve cave systems - Minecraft Caves & Cliffs style
     // Creates massive "cheese caves", spaghetti tunnels, and surface openings
     void carveCaves(Chunk& chunk) {
         glm::ivec2 chunkPos = chunk.position;
+        int originX = chunkPos.x * CHUNK_SIZE_X;
+        int originZ = chunkPos.y * CHUNK_SIZE_Z;
+
+        // OPTIMIZATION: 2D noise only depends on the column - batch it once per chunk
+        // instead of re-sampling it for every voxel of the column
+        NoiseBatch::fillGrid2D(caveNoise, originX, originZ, CHUNK_SIZE_X, CHUNK_SIZE_Z,
+                               caveEntranceNoise.data(), 0.8f);
+        NoiseBatch::fillGrid2D(caveNoise2, originX, originZ, CHUNK_SIZE_X, CHUNK_SIZE_Z,
+                               caveEntranceNoise2.data(), 0.5f);
+        NoiseBatch::fillGrid2D(aquiferNoise, originX, originZ, CHUNK_SIZE_X, CHUNK_SIZE_Z,
+                               caveUnderwaterNoise.data(), 0.02f);
+
+        // Coarse mode: sample the lattice once for the chunk, up to its highest carvable block
+        bool coarseCaves = (caveSampling == CaveSampling::COARSE_LATTICE);
+        if (coarseCaves) {
+            int chunkTop = 0;
+            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+                for (int x = 0; x < CHUNK_SIZE_X; x++) {
+                    chunkTop = std::max(chunkTop, std::min(getColumn(x, z).height, CHUNK_SIZE_Y - 2));
+                }
+            }
+            sampleCaveLattice(originX, originZ, chunkTop);
+        }
 
         for (int x = 0; x < CHUNK_SIZE_X; x++) {
             for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                int worldX = chunkPos.x * CHUNK_SIZE_X + x;
-                int worldZ = chunkPos.y * CHUNK_SIZE_Z + z;
+                int worldX = originX + x;
+                int worldZ = originZ + z;
+                int colIdx = x + z * CHUNK_SIZE_X;
+
+                // Terrain height from the column cache
+                int terrainHeight = getColumn(x, z).height;
+
+                // Batch-sample the 3D cave noise for every y this column can carve (1..terrainHeight)
+                int carveTop = std::min(terrainHeight, CHUNK_SIZE_Y - 2);
+                if (coarseCaves) {
+                    interpolateCaveColumn(x, z, carveTop);
+                } else {
+                    sampleCaveColumn(worldX, worldZ, carveTop);
+                }
 
-                // Get terrain height ONCE per column
-                int terrainHeight = getTerrainHeight(worldX, worldZ);
+                // Carve in a column buffer and write it back once
+                chunk.readColumn(x, z, columnBlocks.data());
+                bool columnChanged = false;
 
                 for (int y = 1; y < CHUNK_SIZE_Y - 1; y++) {
                     // Don't carve through bedrock
-                    BlockType current = chunk.getBlock(x, y, z);
+                    BlockType current = columnBlocks[y];
                     if (current == BlockType::BEDROCK || current == BlockType::AIR ||
                         current == BlockType::WATER) {
                         continue;
@@ -782,15 +1003,16 @@ private:
                     float fx = static_cast<float>(worldX);
                     float fy = static_cast<float>(y);
                     float fz = static_cast<float>(worldZ);
+                    int ci = y - 1;  // Index into the batched cave column
 
                     // ============================================
                     // CHEESE CAVES - Large open caverns (like Swiss cheese holes)
                     // Use very low frequency noise for massive blobs
                     // ============================================
-                    float cheeseNoise = caveNoise.GetNoise(fx * 0.4f, fy * 0.25f, fz * 0.4f);
+                    float cheeseNoise = caveColumn[CAVE_CHEESE][ci];
 
                     // Secondary cheese layer for variety
-                    float cheese2 = caveNoise2.GetNoise(fx * 0.3f, fy * 0.2f, fz * 0.3f);
+                    float cheese2 = caveColumn[CAVE_CHEESE2][ci];
 
                     // Combine for more interesting shapes
                     float cheeseValue = (cheeseNoise + cheese2 * 0.5f) / 1.5f;
@@ -813,24 +1035,24 @@ private:
                     // ============================================
 
                     // Main spaghetti tunnel - lower frequency = wider
-                    float spaghetti1 = caveNoise.GetNoise(fx * 0.7f, fy * 0.7f, fz * 0.7f);
-                    float spaghetti2 = caveNoise2.GetNoise(fx * 0.7f, fy * 1.2f, fz * 0.7f);
+                    float spaghetti1 = caveColumn[CAVE_SPAGHETTI1][ci];
+                    float spaghetti2 = caveColumn[CAVE_SPAGHETTI2][ci];
                     float spaghettiValue = std::abs(spaghetti1) + std::abs(spaghetti2);
 
                     // Large walkable tunnels (3x3+) - very generous threshold
                     float spaghettiThreshold = 0.28f;
 
                     // Secondary layer for even wider sections
-                    float wide1 = caveNoise.GetNoise(fx * 0.5f, fy * 0.4f, fz * 0.5f);
-                    float wide2 = caveNoise2.GetNoise(fx * 0.4f, fy * 0.5f, fz * 0.4f);
+                    float wide1 = caveColumn[CAVE_WIDE1][ci];
+                    float wide2 = caveColumn[CAVE_WIDE2][ci];
                     float wideValue = std::abs(wide1) + std::abs(wide2);
 
                     // Extra wide tunnel sections (4-5 blocks wide)
                     bool isWideTunnel = wideValue < 0.22f;
 
                     // Smaller connecting tunnels (still 2-3 blocks)
-                    float small1 = caveNoise.GetNoise(fx * 1.2f, fy * 1.0f, fz * 1.2f);
-                    float small2 = caveNoise2.GetNoise(fx * 1.1f, fy * 1.5f, fz * 1.1f);
+                    float small1 = caveColumn[CAVE_SMALL1][ci];
+                    float small2 = caveColumn[CAVE_SMALL2][ci];
                     float smallValue = std::abs(small1) + std::abs(small2);
                     bool isSmallTunnel = smallValue < 0.12f;
 
@@ -848,8 +1070,8 @@ private:
                     // This prevents cave entrances from spawning in or near water bodies
                     if (depth >= 0 && depth < 20 && terrainHeight > seaLevel + 3) {
                         // Use a separate noise for surface openings
-                        float entranceNoise = caveNoise.GetNoise(fx * 0.8f, fz * 0.8f);
-                        float entranceNoise2 = caveNoise2.GetNoise(fx * 0.5f, fz * 0.5f);
+                        float entranceNoise = caveEntranceNoise[colIdx];
+                        float entranceNoise2 = caveEntranceNoise2[colIdx];
 
                         // Create circular/oval openings that lead down
                         if (entranceNoise > 0.6f && entranceNoise2 > 0.3f) {
@@ -884,7 +1106,7 @@ private:
 
                         // First check: Is this an UNDERWATER CAVE BIOME (~5% of caves)?
                         // Uses large-scale 2D noise so entire cave sections are underwater
-                        float underwaterBiomeNoise = aquiferNoise.GetNoise(fx * 0.02f, fz * 0.02f);
+                        float underwaterBiomeNoise = caveUnderwaterNoise[colIdx];
                         bool isUnderwaterCaveBiome = underwaterBiomeNoise > 0.92f;  // ~3-4% of areas (very rare)
 
                         if (isUnderwaterCaveBiome && y < 40 && y > 10 && distanceToSurface > 25) {
@@ -902,7 +1124,7 @@ private:
 
                             if (isPoolLocation) {
                                 // Only place water/lava on the FLOOR of the cave
-                                BlockType below = chunk.getBlock(x, y - 1, z);
+                                BlockType below = columnBlocks[y - 1];
                                 bool hasFloor = (below == BlockType::STONE || below == BlockType::DIRT ||
                                                 below == BlockType::SAND || below == BlockType::GRAVEL);
 
@@ -917,7 +1139,8 @@ private:
                             }
                         }
 
-                        chunk.setBlock(x, y, z, caveBlock);
+                        columnBlocks[y] = caveBlock;
+                        columnChanged = true;
 
                         // Add features to caves
                         std::hash<int> hasher;
@@ -926,23 +1149,26 @@ private:
                         // Glowstone clusters on ceilings (only in air caves)
                         if (caveBlock == BlockType::AIR && y < 50 && y > 5) {
                             if (y + 1 < CHUNK_SIZE_Y) {
-                                BlockType above = chunk.getBlock(x, y + 1, z);
+                                BlockType above = columnBlocks[y + 1];
                                 if (above == BlockType::STONE) {
                                     if ((h % 150) < 4) {  // ~2.5% chance
-                                        chunk.setBlock(x, y + 1, z, BlockType::GLOWSTONE);
+                                        columnBlocks[y + 1] = BlockType::GLOWSTONE;
                                     }
                                 }
                             }
                         }
                     }
                 }
+
+                if (columnChanged) {
+                    chunk.writeColumn(x, z, columnBlocks.data());
+                }
             }
         }
     }
 
-    // Generate ore deposits
-    void generateOres(Chunk& chunk) {
-        glm::ivec2 chunkPos = chunk.position;
+    // Generate the ore deposits of origin chunk chunkPos
+    void generateOres(glm::ivec2 chunkPos, FeatureWriter& features) {
         std::mt19937 rng(seed + chunkPos.x * 31337 + chunkPos.y * 7919);
 
         // Ore definitions: type, minY, maxY, veinsPerChunk, veinSize
@@ -972,12 +1198,12 @@ private:
                 int startZ = zDist(rng);
 
                 // Simple blob ore vein
-                generateOreVein(chunk, startX, startY, startZ, ore.type, ore.veinSize, rng);
+                generateOreVein(features, startX, startY, startZ, ore.type, ore.veinSize, rng);
             }
         }
     }
 
-    void generateOreVein(Chunk& chunk, int startX, int startY, int startZ,
+    void generateOreVein(FeatureWriter& features, int startX, int startY, int startZ,
                          BlockType oreType, int size, std::mt19937& rng) {
         std::uniform_real_distribution<float> dist(-1.5f, 1.5f);
 
@@ -986,19 +1212,13 @@ private:
         float z = static_cast<float>(startZ);
 
         for (int i = 0; i < size; i++) {
-            int ix = static_cast<int>(x);
+            int ix = static_cast<int>(std::floor(x));
             int iy = static_cast<int>(y);
-            int iz = static_cast<int>(z);
-
-            // Place ore if within chunk and currently stone
-            if (ix >= 0 && ix < CHUNK_SIZE_X &&
-                iy >= 1 && iy < CHUNK_SIZE_Y - 1 &&
-                iz >= 0 && iz < CHUNK_SIZE_Z) {
+            int iz = static_cast<int>(std::floor(z));
 
-                BlockType current = chunk.getBlock(ix, iy, iz);
-                if (current == BlockType::STONE) {
-                    chunk.setBlock(ix, iy, iz, oreType);
-                }
+            // Place ore if currently stone (veins may continue into neighbouring chunks)
+            if (iy >= 1 && iy < CHUNK_SIZE_Y - 1) {
+                features.set(ix, iy, iz, oreType, FeatureReplace::STONE_ONLY);
             }
 
             // Random walk
@@ -1008,21 +1228,50 @@ private:
         }
     }
 
-    // Generate trees and other decorations based on biome
-    void generateDecorations(Chunk& chunk) {
-        glm::ivec2 chunkPos = chunk.position;
-        std::mt19937 rng(seed + chunkPos.x * 73856093 + chunkPos.y * 19349663);
+    // Per-column generator for decorations: seeded by the column alone, so a
+    // tree comes out the same from whichever chunk evaluates it
+    using DecorationRng = std::minstd_rand;
+
+    DecorationRng makeColumnRng(int worldX, int worldZ) const {
+        uint32_t h = static_cast<uint32_t>(seed);
+        h ^= static_cast<uint32_t>(worldX) * 0x9E3779B1u;
+        h ^= static_cast<uint32_t>(worldZ) * 0x85EBCA77u;
+        h ^= h >> 15;
+        h *= 0x2C1B3C6Du;
+        h ^= h >> 12;
+        return DecorationRng(h);
+    }
+
+    // Generate the trees and other decorations of origin chunk chunkPos
+    // Columns are decided from the column cache alone (never from blocks that
+    // other features may have touched), so only origin columns within
+    // FEATURE_REACH of the chunk being generated are evaluated.
+    void generateDecorations(glm::ivec2 chunkPos, FeatureWriter& features) {
         std::uniform_int_distribution<int> chanceDist(0, 100);
 
-        for (int x = 2; x < CHUNK_SIZE_X - 2; x++) {
-            for (int z = 2; z < CHUNK_SIZE_Z - 2; z++) {
+        for (int x = 0; x < CHUNK_SIZE_X; x++) {
+            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
+                int tx = features.toTargetX(x);
+                int tz = features.toTargetZ(z);
+                if (tx < -FEATURE_REACH || tx >= CHUNK_SIZE_X + FEATURE_REACH ||
+                    tz < -FEATURE_REACH || tz >= CHUNK_SIZE_Z + FEATURE_REACH) {
+                    continue;
+                }
+
+                const ColumnData& column = getColumn(tx, tz);
+                Biome biome = column.terrain.biome;
                 int worldX = chunkPos.x * CHUNK_SIZE_X + x;
                 int worldZ = chunkPos.y * CHUNK_SIZE_Z + z;
-                Biome biome = getBiome(worldX, worldZ);
 
-                // Find surface
-                for (int y = CHUNK_SIZE_Y - 10; y > seaLevel; y--) {
-                    BlockType surfaceBlock = chunk.getBlock(x, y, z);
+                // Surface from the cached height (same range the old top-down scan covered)
+                int y = column.height;
+                if (y <= seaLevel || y > CHUNK_SIZE_Y - 10) continue;
+                if (isCaveEntranceSurface(worldX, worldZ, y)) continue;
+
+                DecorationRng rng = makeColumnRng(worldX, worldZ);
+
+                {
+                    BlockType surfaceBlock = getBlockAt(worldX, y, worldZ, column);
 
                     // Check for valid surface based on biome
                     bool isSurface = (surfaceBlock == BlockType::GRASS) ||
@@ -1041,28 +1290,28 @@ private:
                             case Biome::FOREST:
                                 // Dense oak trees (8% chance)
                                 if (chance < 8) {
-                                    generateTree(chunk, x, y + 1, z, rng);
+                                    generateTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::DARK_FOREST:
                                 // Very dense dark oak trees (12% chance)
                                 if (chance < 12) {
-                                    generateDarkOakTree(chunk, x, y + 1, z, rng);
+                                    generateDarkOakTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::BIRCH_FOREST:
                                 // Dense birch trees (8% chance)
                                 if (chance < 8) {
-                                    generateBirchTree(chunk, x, y + 1, z, rng);
+                                    generateBirchTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::TAIGA:
                                 // Dense spruce trees (10% chance)
                                 if (chance < 10) {
-                                    generateSpruceTree(chunk, x, y + 1, z, rng);
+                                    generateSpruceTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
@@ -1072,21 +1321,21 @@ private:
                             case Biome::SNOW:
                                 // Sparse snowy trees (1% chance)
                                 if (chance < 1) {
-                                    generateSpruceTree(chunk, x, y + 1, z, rng);
+                                    generateSpruceTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::SNOW_TAIGA:
                                 // Moderate snowy spruce trees (6% chance)
                                 if (chance < 6) {
-                                    generateSpruceTree(chunk, x, y + 1, z, rng);
+                                    generateSpruceTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::FROZEN_PEAKS:
                                 // Very sparse, only at lower elevations
                                 if (chance < 1 && y < 90) {
-                                    generateSpruceTree(chunk, x, y + 1, z, rng);
+                                    generateSpruceTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
@@ -1096,14 +1345,14 @@ private:
                             case Biome::PLAINS:
                                 // Sparse trees in plains (1% chance)
                                 if (chance < 1) {
-                                    generateTree(chunk, x, y + 1, z, rng);
+                                    generateTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::SAVANNA:
                                 // Acacia-style trees (sparse, 2% chance)
                                 if (chance < 2) {
-                                    generateAcaciaTree(chunk, x, y + 1, z, rng);
+                                    generateAcaciaTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
@@ -1113,14 +1362,14 @@ private:
                             case Biome::SWAMP:
                                 // Swamp trees with vines (5% chance)
                                 if (chance < 5) {
-                                    generateSwampTree(chunk, x, y + 1, z, rng);
+                                    generateSwampTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::RIVER:
                                 // Occasional trees along riverbanks (1% chance)
                                 if (chance < 1) {
-                                    generateTree(chunk, x, y + 1, z, rng);
+                                    generateTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
@@ -1130,14 +1379,14 @@ private:
                             case Biome::DESERT:
                                 // Cacti in desert (2% chance)
                                 if (chance < 2) {
-                                    generateCactus(chunk, x, y + 1, z, rng);
+                                    generateCactus(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::BADLANDS:
                                 // Dead bushes only, no trees (rare cactus 1%)
                                 if (chance < 1) {
-                                    generateCactus(chunk, x, y + 1, z, rng);
+                                    generateCactus(features, x, y + 1, z, rng);
                                 }
                                 break;
 
@@ -1149,14 +1398,14 @@ private:
                             case Biome::STONY_PEAKS:
                                 // Very sparse trees on lower mountains
                                 if (chance < 1 && y < 85) {
-                                    generateSpruceTree(chunk, x, y + 1, z, rng);
+                                    generateSpruceTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
                             case Biome::MOUNTAIN_MEADOW:
                                 // Moderate trees in mountain meadows (3% chance)
                                 if (chance < 3) {
-                                    generateTree(chunk, x, y + 1, z, rng);
+                                    generateTree(features, x, y + 1, z, rng);
                                 }
                                 break;
 
@@ -1172,24 +1421,33 @@ private:
                             default:
                                 break;
                         }
-                        break;
                     }
                 }
             }
         }
     }
 
+    // Does carveCaves open the surface block of this column? (depth 0 of the
+    // surface opening test - the only carve that removes grass/snow)
+    bool isCaveEntranceSurface(int worldX, int worldZ, int terrainHeight) const {
+        if (terrainHeight <= seaLevel + 3) return false;
+        float fx = static_cast<float>(worldX);
+        float fz = static_cast<float>(worldZ);
+        float entranceNoise = caveNoise.GetNoise(fx * 0.8f, fz * 0.8f);
+        if (entranceNoise <= 0.6f) return false;
+        float entranceNoise2 = caveNoise2.GetNoise(fx * 0.5f, fz * 0.5f);
+        return entranceNoise2 > 0.3f && (entranceNoise - 0.6f) * 3.0f > 0.5f;
+    }
+
     // Generate a spruce tree (tall, narrow, triangular)
-    void generateSpruceTree(Chunk& chunk, int x, int baseY, int z, std::mt19937& rng) {
+    void generateSpruceTree(FeatureWriter& features, int x, int baseY, int z, DecorationRng& rng) {
         std::uniform_int_distribution<int> heightDist(6, 10);
         int trunkHeight = heightDist(rng);
 
         if (baseY + trunkHeight + 2 >= CHUNK_SIZE_Y) return;
 
         // Trunk
-        for (int y = 0; y < trunkHeight; y++) {
-            chunk.setBlock(x, baseY + y, z, BlockType::WOOD_LOG);
-        }
+        features.fillColumn(x, z, baseY, baseY + trunkHeight - 1, BlockType::WOOD_LOG);
 
         // Leaves - triangular shape
         int leafStart = baseY + 2;
@@ -1209,33 +1467,26 @@ private:
                     int px = x + lx;
                     int pz = z + lz;
 
-                    if (px >= 0 && px < CHUNK_SIZE_X && pz >= 0 && pz < CHUNK_SIZE_Z) {
-                        BlockType current = chunk.getBlock(px, ly, pz);
-                        if (current == BlockType::AIR) {
-                            chunk.setBlock(px, ly, pz, BlockType::LEAVES);
-                        }
-                    }
+                    features.set(px, ly, pz, BlockType::LEAVES, FeatureReplace::AIR_ONLY);
                 }
             }
         }
 
         // Top leaf
         if (baseY + trunkHeight + 1 < CHUNK_SIZE_Y) {
-            chunk.setBlock(x, baseY + trunkHeight + 1, z, BlockType::LEAVES);
+            features.set(x, baseY + trunkHeight + 1, z, BlockType::LEAVES);
         }
     }
 
     // Generate a birch tree (tall, thin, white bark)
-    void generateBirchTree(Chunk& chunk, int x, int baseY, int z, std::mt19937& rng) {
+    void generateBirchTree(FeatureWriter& features, int x, int baseY, int z, DecorationRng& rng) {
         std::uniform_int_distribution<int> heightDist(5, 7);
         int trunkHeight = heightDist(rng);
 
         if (baseY + trunkHeight + 3 >= CHUNK_SIZE_Y) return;
 
         // Trunk (birch uses regular log, could add birch log type later)
-        for (int y = 0; y < trunkHeight; y++) {
-            chunk.setBlock(x, baseY + y, z, BlockType::WOOD_LOG);
-        }
+        features.fillColumn(x, z, baseY, baseY + trunkHeight - 1, BlockType::WOOD_LOG);
 
         // Leaves - small, round canopy
         int leafStart = baseY + trunkHeight - 2;
@@ -1252,34 +1503,25 @@ private:
                     int px = x + lx;
                     int pz = z + lz;
 
-                    if (px >= 0 && px < CHUNK_SIZE_X && pz >= 0 && pz < CHUNK_SIZE_Z) {
-                        BlockType current = chunk.getBlock(px, ly, pz);
-                        if (current == BlockType::AIR) {
-                            chunk.setBlock(px, ly, pz, BlockType::LEAVES);
-                        }
-                    }
+                    features.set(px, ly, pz, BlockType::LEAVES, FeatureReplace::AIR_ONLY);
                 }
             }
         }
     }
 
     // Generate a dark oak tree (short, thick, wide canopy)
-    void generateDarkOakTree(Chunk& chunk, int x, int baseY, int z, std::mt19937& rng) {
+    void generateDarkOakTree(FeatureWriter& features, int x, int baseY, int z, DecorationRng& rng) {
         std::uniform_int_distribution<int> heightDist(4, 6);
         int trunkHeight = heightDist(rng);
 
         if (baseY + trunkHeight + 3 >= CHUNK_SIZE_Y) return;
 
         // 2x2 thick trunk for dark oak
-        for (int y = 0; y < trunkHeight; y++) {
-            chunk.setBlock(x, baseY + y, z, BlockType::WOOD_LOG);
-            if (x + 1 < CHUNK_SIZE_X)
-                chunk.setBlock(x + 1, baseY + y, z, BlockType::WOOD_LOG);
-            if (z + 1 < CHUNK_SIZE_Z)
-                chunk.setBlock(x, baseY + y, z + 1, BlockType::WOOD_LOG);
-            if (x + 1 < CHUNK_SIZE_X && z + 1 < CHUNK_SIZE_Z)
-                chunk.setBlock(x + 1, baseY + y, z + 1, BlockType::WOOD_LOG);
-        }
+        int trunkTop = baseY + trunkHeight - 1;
+        features.fillColumn(x, z, baseY, trunkTop, BlockType::WOOD_LOG);
+        features.fillColumn(x + 1, z, baseY, trunkTop, BlockType::WOOD_LOG);
+        features.fillColumn(x, z + 1, baseY, trunkTop, BlockType::WOOD_LOG);
+        features.fillColumn(x + 1, z + 1, baseY, trunkTop, BlockType::WOOD_LOG);
 
         // Wide canopy
         int leafStart = baseY + trunkHeight - 1;
@@ -1297,19 +1539,14 @@ private:
                     int px = x + lx;
                     int pz = z + lz;
 
-                    if (px >= 0 && px < CHUNK_SIZE_X && pz >= 0 && pz < CHUNK_SIZE_Z) {
-                        BlockType current = chunk.getBlock(px, ly, pz);
-                        if (current == BlockType::AIR) {
-                            chunk.setBlock(px, ly, pz, BlockType::LEAVES);
-                        }
-                    }
+                    features.set(px, ly, pz, BlockType::LEAVES, FeatureReplace::AIR_ONLY);
                 }
             }
         }
     }
 
     // Generate an acacia tree (diagonal trunk, flat canopy)
-    void generateAcaciaTree(Chunk& chunk, int x, int baseY, int z, std::mt19937& rng) {
+    void generateAcaciaTree(FeatureWriter& features, int x, int baseY, int z, DecorationRng& rng) {
         std::uniform_int_distribution<int> heightDist(4, 6);
         std::uniform_int_distribution<int> dirDist(0, 3);
         int trunkHeight = heightDist(rng);
@@ -1324,9 +1561,7 @@ private:
         // Trunk with diagonal bend
         int cx = x, cz = z;
         for (int y = 0; y < trunkHeight; y++) {
-            if (cx >= 0 && cx < CHUNK_SIZE_X && cz >= 0 && cz < CHUNK_SIZE_Z) {
-                chunk.setBlock(cx, baseY + y, cz, BlockType::WOOD_LOG);
-            }
+            features.set(cx, baseY + y, cz, BlockType::WOOD_LOG);
             // Bend trunk after halfway
             if (y == trunkHeight / 2) {
                 cx += dx;
@@ -1344,34 +1579,24 @@ private:
                 int px = cx + lx;
                 int pz = cz + lz;
 
-                if (px >= 0 && px < CHUNK_SIZE_X && pz >= 0 && pz < CHUNK_SIZE_Z) {
-                    BlockType current = chunk.getBlock(px, leafY, pz);
-                    if (current == BlockType::AIR) {
-                        chunk.setBlock(px, leafY, pz, BlockType::LEAVES);
-                    }
-                    // Thin second layer
-                    if (lx * lx + lz * lz < 5 && leafY + 1 < CHUNK_SIZE_Y) {
-                        current = chunk.getBlock(px, leafY + 1, pz);
-                        if (current == BlockType::AIR) {
-                            chunk.setBlock(px, leafY + 1, pz, BlockType::LEAVES);
-                        }
-                    }
+                features.set(px, leafY, pz, BlockType::LEAVES, FeatureReplace::AIR_ONLY);
+                // Thin second layer
+                if (lx * lx + lz * lz < 5) {
+                    features.set(px, leafY + 1, pz, BlockType::LEAVES, FeatureReplace::AIR_ONLY);
                 }
             }
         }
     }
 
     // Generate a swamp tree (drooping leaves, exposed roots)
-    void generateSwampTree(Chunk& chunk, int x, int baseY, int z, std::mt19937& rng) {
+    void generateSwampTree(FeatureWriter& features, int x, int baseY, int z, DecorationRng& rng) {
         std::uniform_int_distribution<int> heightDist(4, 7);
         int trunkHeight = heightDist(rng);
 
         if (baseY + trunkHeight + 3 >= CHUNK_SIZE_Y) return;
 
         // Trunk
-        for (int y = 0; y < trunkHeight; y++) {
-            chunk.setBlock(x, baseY + y, z, BlockType::WOOD_LOG);
-        }
+        features.fillColumn(x, z, baseY, baseY + trunkHeight - 1, BlockType::WOOD_LOG);
 
         // Leaves - similar to regular tree but wider
         int leafStart = baseY + trunkHeight - 2;
@@ -1388,24 +1613,19 @@ private:
                     int px = x + lx;
                     int pz = z + lz;
 
-                    if (px >= 0 && px < CHUNK_SIZE_X && pz >= 0 && pz < CHUNK_SIZE_Z) {
-                        BlockType current = chunk.getBlock(px, ly, pz);
-                        if (current == BlockType::AIR) {
-                            chunk.setBlock(px, ly, pz, BlockType::LEAVES);
-                        }
-                    }
+                    features.set(px, ly, pz, BlockType::LEAVES, FeatureReplace::AIR_ONLY);
                 }
             }
         }
 
         // Top leaf
         if (baseY + trunkHeight + 2 < CHUNK_SIZE_Y) {
-            chunk.setBlock(x, baseY + trunkHeight + 2, z, BlockType::LEAVES);
+            features.set(x, baseY + trunkHeight + 2, z, BlockType::LEAVES);
         }
     }
 
     // Generate a cactus
-    void generateCactus(Chunk& chunk, int x, int baseY, int z, std::mt19937& rng) {
+    void generateCactus(FeatureWriter& features, int x, int baseY, int z, DecorationRng& rng) {
         std::uniform_int_distribution<int> heightDist(2, 4);
         int height = heightDist(rng);
 
@@ -1413,12 +1633,10 @@ private:
         if (baseY + height >= CHUNK_SIZE_Y) return;
 
         // Generate cactus column
-        for (int y = 0; y < height; y++) {
-            chunk.setBlock(x, baseY + y, z, BlockType::CACTUS);
-        }
+        features.fillColumn(x, z, baseY, baseY + height - 1, BlockType::CACTUS);
     }
 
-    void generateTree(Chunk& chunk, int x, int baseY, int z, std::mt19937& rng) {
+    void generateTree(FeatureWriter& features, int x, int baseY, int z, DecorationRng& rng) {
         std::uniform_int_distribution<int> heightDist(4, 6);
         int trunkHeight = heightDist(rng);
 
@@ -1426,9 +1644,7 @@ private:
         if (baseY + trunkHeight + 3 >= CHUNK_SIZE_Y) return;
 
         // Trunk
-        for (int y = 0; y < trunkHeight; y++) {
-            chunk.setBlock(x, baseY + y, z, BlockType::WOOD_LOG);
-        }
+        features.fillColumn(x, z, baseY, baseY + trunkHeight - 1, BlockType::WOOD_LOG);
 
         // Leaves (simple sphere-ish shape)
         int leafStart = baseY + trunkHeight - 2;
@@ -1446,19 +1662,14 @@ private:
                     int px = x + lx;
                     int pz = z + lz;
 
-                    if (px >= 0 && px < CHUNK_SIZE_X && pz >= 0 && pz < CHUNK_SIZE_Z) {
-                        BlockType current = chunk.getBlock(px, ly, pz);
-                        if (current == BlockType::AIR) {
-                            chunk.setBlock(px, ly, pz, BlockType::LEAVES);
-                        }
-                    }
+                    features.set(px, ly, pz, BlockType::LEAVES, FeatureReplace::AIR_ONLY);
                 }
             }
         }
 
         // Top leaf
         if (baseY + trunkHeight + 2 < CHUNK_SIZE_Y) {
-            chunk.setBlock(x, baseY + trunkHeight + 2, z, BlockType::LEAVES);
+            features.set(x, baseY + trunkHeight + 2, z, BlockType::LEAVES);
         }
     }
 };
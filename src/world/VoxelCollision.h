@@ -0,0 +1,134 @@
+#pragma once
+
+#include "WorldView.h"
+#include "Block.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+
+// ============================================
+// VOXEL COLLISION
+// ============================================
+// Swept AABB movement against solid blocks, shared by the player and
+// entities. Motion is resolved one axis at a time (Y, then X, then Z, so
+// gravity settles before sliding). Each axis walks the voxel layers the
+// box's leading face crosses, in order (a DDA along that axis), and stops
+// at the first layer with a solid block in the box's cross-section. Nothing
+// is skipped however far the box moves in one step, so fast movement can't
+// tunnel through thin walls and no sub-stepping is needed.
+//
+// OPTIMIZATION: Blocks are read through a WorldView pinned around the start
+// position, so a sweep doesn't hash or lock per voxel. A collider is meant to
+// live for one update; don't keep it across frames (chunks may unload). Worker
+// jobs may each use their own collider (see WorldView for the threading rule).
+// ============================================
+
+struct VoxelAABB {
+    glm::vec3 min;
+    glm::vec3 max;
+
+    VoxelAABB offset(const glm::vec3& delta) const { return {min + delta, max + delta}; }
+};
+
+class VoxelCollider {
+public:
+    // Gap kept between a box and the face it stops against; touching isn't overlapping
+    static constexpr float SKIN = 0.001f;
+
+    struct SweepResult {
+        glm::vec3 moved{0.0f};      // Motion actually applied
+        bool hitX = false;          // Blocked on that axis
+        bool hitY = false;
+        bool hitZ = false;
+    };
+
+    // Pins the chunks around `around` (sweeps may leave them; reads then fall back to World)
+    VoxelCollider(World& world, const glm::vec3& around) : view(WorldView::around(world, around)) {}
+
+    BlockType getBlock(int x, int y, int z) const { return view.getBlock(x, y, z); }
+    bool isSolid(int x, int y, int z) const { return view.isSolid(x, y, z); }
+
+    // True if the box overlaps any solid block (by more than SKIN)
+    bool overlapsSolid(const VoxelAABB& box) const {
+        glm::ivec3 lo = glm::ivec3(glm::floor(box.min + SKIN));
+        glm::ivec3 hi = glm::ivec3(glm::floor(box.max - SKIN));
+        for (int y = lo.y; y <= hi.y; y++) {
+            for (int z = lo.z; z <= hi.z; z++) {
+                for (int x = lo.x; x <= hi.x; x++) {
+                    if (isSolid(x, y, z)) return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Move the box by motion, stopping each axis at the first solid block
+    SweepResult sweep(VoxelAABB box, const glm::vec3& motion) {
+        static constexpr int AXIS_ORDER[3] = {1, 0, 2};
+
+        SweepResult result;
+        bool* hits[3] = {&result.hitX, &result.hitY, &result.hitZ};
+        for (int axis : AXIS_ORDER) {
+            float delta = motion[axis];
+            if (std::abs(delta) < 0.0001f) continue;
+
+            float allowed = sweepAxis(box, axis, delta);
+            if (allowed != delta) *hits[axis] = true;
+
+            box.min[axis] += allowed;
+            box.max[axis] += allowed;
+            result.moved[axis] = allowed;
+        }
+        return result;
+    }
+
+    const WorldView& getView() const { return view; }
+
+private:
+    WorldView view;
+
+    // How far the box can move along one axis (same sign as delta, |result| <= |delta|)
+    float sweepAxis(const VoxelAABB& box, int axis, float delta) const {
+        int u = (axis + 1) % 3;
+        int v = (axis + 2) % 3;
+
+        // Cross-section cells (faces the box only touches don't count)
+        int uMin = static_cast<int>(std::floor(box.min[u] + SKIN));
+        int uMax = static_cast<int>(std::floor(box.max[u] - SKIN));
+        int vMin = static_cast<int>(std::floor(box.min[v] + SKIN));
+        int vMax = static_cast<int>(std::floor(box.max[v] - SKIN));
+
+        auto layerBlocked = [&](int layer) {
+            glm::ivec3 cell;
+            cell[axis] = layer;
+            for (cell[v] = vMin; cell[v] <= vMax; cell[v]++) {
+                for (cell[u] = uMin; cell[u] <= uMax; cell[u]++) {
+                    if (isSolid(cell.x, cell.y, cell.z)) return true;
+                }
+            }
+            return false;
+        };
+
+        if (delta > 0.0f) {
+            // Layers the leading (max) face enters, nearest first
+            float lead = box.max[axis];
+            int first = static_cast<int>(std::floor(lead - SKIN)) + 1;
+            int last = static_cast<int>(std::floor(lead + delta - SKIN));
+            for (int layer = first; layer <= last; layer++) {
+                if (layerBlocked(layer)) {
+                    return std::clamp(static_cast<float>(layer) - SKIN - lead, 0.0f, delta);
+                }
+            }
+        } else {
+            float lead = box.min[axis];
+            int first = static_cast<int>(std::floor(lead + SKIN)) - 1;
+            int last = static_cast<int>(std::floor(lead + delta + SKIN));
+            for (int layer = first; layer >= last; layer--) {
+                if (layerBlocked(layer)) {
+                    return std::clamp(static_cast<float>(layer + 1) + SKIN - lead, delta, 0.0f);
+                }
+            }
+        }
+        return delta;
+    }
+};
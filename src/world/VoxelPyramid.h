@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Chunk.h"
+#include "Block.h"
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+// ============================================================================
+// VOXEL MIP PYRAMID
+// ============================================================================
+// Downsampled copies of a chunk column at 2x, 4x and 8x for LOD meshing.
+// Built once per mesh pass (each level is reduced from the previous one, so the
+// full-resolution chunk is only read once) and then meshed per sub-chunk with the
+// binary greedy mesher, instead of rescanning the chunk for every LOD level.
+//
+// Reduction is 2x2x2 -> 1 cell:
+//   - Occupancy is by majority (4 of 8 cells), ties count as solid so terrain
+//     surfaces don't sink at coarse levels.
+//   - Block type prefers the surface: the most common block in the highest
+//     occupied layer wins, so grass stays grass instead of turning into dirt.
+// Water and lava are treated as empty (they have their own non-LOD geometry).
+// ============================================================================
+
+class VoxelPyramid {
+public:
+    static constexpr int LEVEL_COUNT = 4;  // Level 0 is the chunk itself (not stored)
+
+    struct Level {
+        int scale = 1;     // Blocks per cell edge (2, 4, 8)
+        int sizeXZ = 0;    // Cells per side horizontally
+        int sizeY = 0;     // Cells vertically
+        int minY = 0;      // Lowest occupied cell layer
+        int maxY = -1;     // Highest occupied cell layer (-1 = empty level)
+        std::vector<BlockType> blocks;  // Index: x + z * sizeXZ + y * sizeXZ * sizeXZ
+
+        BlockType get(int x, int y, int z) const {
+            if (x < 0 || x >= sizeXZ || z < 0 || z >= sizeXZ || y < 0 || y >= sizeY) {
+                return BlockType::AIR;
+            }
+            return blocks[x + z * sizeXZ + y * sizeXZ * sizeXZ];
+        }
+    };
+
+    // Rebuild every level from the chunk's current blocks
+    void build(const Chunk& chunk) {
+        // Level 1 reads the chunk directly; only the occupied Y range needs sampling
+        int srcMinY = chunk.chunkMinY;
+        int srcMaxY = chunk.chunkMaxY;
+        reduce([&chunk](int x, int y, int z) { return chunk.getBlock(x, y, z); },
+               CHUNK_SIZE_X, CHUNK_SIZE_Y, srcMinY, srcMaxY, levels[1]);
+        levels[1].scale = 2;
+
+        for (int level = 2; level < LEVEL_COUNT; level++) {
+            const Level& src = levels[level - 1];
+            reduce([&src](int x, int y, int z) { return src.get(x, y, z); },
+                   src.sizeXZ, src.sizeY, src.minY, src.maxY, levels[level]);
+            levels[level].scale = src.scale * 2;
+        }
+    }
+
+    const Level& getLevel(int level) const { return levels[level]; }
+
+private:
+    std::array<Level, LEVEL_COUNT> levels;
+
+    static bool isLODSolid(BlockType block) {
+        return block != BlockType::AIR &&
+               block != BlockType::WATER &&
+               block != BlockType::LAVA;
+    }
+
+    // Most common solid block among up to 4 samples (AIR if none are solid)
+    static BlockType dominantBlock(const BlockType* samples, int count) {
+        BlockType best = BlockType::AIR;
+        int bestCount = 0;
+        for (int i = 0; i < count; i++) {
+            if (!isLODSolid(samples[i])) continue;
+            int n = 0;
+            for (int j = 0; j < count; j++) {
+                if (samples[j] == samples[i]) n++;
+            }
+            if (n > bestCount) {
+                best = samples[i];
+                bestCount = n;
+            }
+        }
+        return best;
+    }
+
+    template <typename Source>
+    static void reduce(Source source, int srcXZ, int srcY, int srcMinY, int srcMaxY, Level& dst) {
+        dst.sizeXZ = srcXZ / 2;
+        dst.sizeY = srcY / 2;
+        dst.blocks.assign(static_cast<size_t>(dst.sizeXZ) * dst.sizeXZ * dst.sizeY, BlockType::AIR);
+        dst.minY = dst.sizeY;
+        dst.maxY = -1;
+        if (srcMaxY < srcMinY) return;
+
+        int yBegin = std::max(0, srcMinY / 2);
+        int yEnd = std::min(dst.sizeY - 1, srcMaxY / 2);
+
+        for (int y = yBegin; y <= yEnd; y++) {
+            for (int z = 0; z < dst.sizeXZ; z++) {
+                for (int x = 0; x < dst.sizeXZ; x++) {
+                    int solid = 0;
+                    BlockType surface = BlockType::AIR;
+
+                    // Top layer first so the surface block decides the type
+                    for (int dy = 1; dy >= 0; dy--) {
+                        BlockType layer[4] = {
+                            source(x * 2,     y * 2 + dy, z * 2),
+                            source(x * 2 + 1, y * 2 + dy, z * 2),
+                            source(x * 2,     y * 2 + dy, z * 2 + 1),
+                            source(x * 2 + 1, y * 2 + dy, z * 2 + 1)
+                        };
+                        for (BlockType b : layer) {
+                            if (isLODSolid(b)) solid++;
+                        }
+                        if (surface == BlockType::AIR) {
+                            surface = dominantBlock(layer, 4);
+                        }
+                    }
+
+                    if (solid >= 4) {
+                        dst.blocks[x + z * dst.sizeXZ + y * dst.sizeXZ * dst.sizeXZ] = surface;
+                        dst.minY = std::min(dst.minY, y);
+                        dst.maxY = std::max(dst.maxY, y);
+                    }
+                }
+            }
+        }
+    }
+};
@@ -0,0 +1,444 @@
+#pragma once
+
+#include "Chunk.h"
+#include "Block.h"
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <glm/glm.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+// ============================================================================
+// WATER SIMULATION (scheduled fluid ticks on worker threads)
+// ============================================================================
+// Only cells whose neighbourhood changed are simulated. A changed cell puts
+// itself and its six neighbours on the schedule for the next water tick;
+// settled water (a calm ocean) has nothing scheduled and costs nothing.
+//
+// A tick runs in three steps and is published before tick() returns:
+//   - the main thread snapshots every scheduled cell together with the cells
+//     its flow rule reads (itself, the cell below and its four horizontal
+//     neighbours) - the front buffer
+//   - worker threads and the main thread run the flow rules in jobs of
+//     CELLS_PER_JOB cells against the snapshots and record the new levels -
+//     the back buffer
+//   - the main thread publishes the jobs in order into the live chunks, marks
+//     them for remeshing and schedules the changed cells for the next tick
+// Every cell reads the state from before the tick (a Jacobi step), so the
+// result doesn't depend on how the jobs were split or which thread ran them.
+//
+// Workers never touch live chunks. The main thread takes jobs itself until
+// none are left, so a tick never waits on threads busy with generation - at
+// most on the jobs they already started - and no tick is skipped or deferred.
+//
+// Flow rules (per water cell):
+//   - falls into the cell below if it is open or not yet a full source
+//   - on solid ground or a source, spreads sideways at level - 1
+//     (a source spreads at WATER_MAX_SPREAD)
+//
+// Arriving chunks only schedule the water that can actually move: their own
+// unsettled cells plus the unsettled cells on the facing edges of loaded
+// neighbours (which couldn't flow into the missing chunk before).
+// ============================================================================
+
+class WaterSimulation {
+public:
+    // Returns the loaded chunk at a chunk position, or nullptr
+    using ChunkLookup = std::function<Chunk*(glm::ivec2)>;
+
+    // Queues a task for a worker thread (empty: the main thread runs every job)
+    using TaskRunner = std::function<void(std::function<void()>)>;
+
+    explicit WaterSimulation(ChunkLookup lookup, TaskRunner runTask = nullptr)
+        : lookup(std::move(lookup)), runTask(std::move(runTask)) {}
+
+    // A block was written at world coordinates: it and its neighbours may flow now
+    void onBlockChanged(int x, int y, int z) {
+        scheduleAround(x, y, z);
+    }
+
+    // Schedule the water of a chunk that just joined the world, and the water
+    // along its loaded neighbours' facing edges
+    void onChunkLoaded(glm::ivec2 pos) {
+        resetCache();
+        Chunk* chunk = lookup(pos);
+        if (!chunk) return;
+
+        if (chunk->hasWater || chunk->hasWaterUpdates) {
+            scheduleUnsettled(*chunk, 0, CHUNK_SIZE_X - 1, 0, CHUNK_SIZE_Z - 1);
+            chunk->hasWaterUpdates = false;
+        }
+
+        const glm::ivec2 offsets[4] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+        for (const glm::ivec2& offset : offsets) {
+            Chunk* neighbor = lookup(pos + offset);
+            if (!neighbor || !neighbor->hasWater) continue;
+            // Edge of the neighbour that faces the new chunk
+            int x0 = 0, x1 = CHUNK_SIZE_X - 1, z0 = 0, z1 = CHUNK_SIZE_Z - 1;
+            if (offset.x == -1) x0 = x1; else if (offset.x == 1) x1 = x0;
+            if (offset.y == -1) z0 = z1; else if (offset.y == 1) z1 = z0;
+            scheduleUnsettled(*neighbor, x0, x1, z0, z1);
+        }
+    }
+
+    // Run one water tick: snapshot, simulate in parallel, publish
+    void tick() {
+        if (due.empty()) return;
+
+        auto batch = std::make_shared<TickBatch>();
+        snapshot(*batch);
+        if (batch->cells.empty()) return;
+
+        batch->jobCount = (batch->cells.size() + CELLS_PER_JOB - 1) / CELLS_PER_JOB;
+        batch->writes.resize(batch->jobCount);
+        batch->remaining.store(batch->jobCount, std::memory_order_relaxed);
+
+        // Helpers claim jobs until none are left; one that starts late finds nothing
+        if (runTask) {
+            for (size_t i = 1; i < batch->jobCount; i++) {
+                runTask([batch]() { runJobs(*batch); });
+            }
+        }
+        runJobs(*batch);
+        while (batch->remaining.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+
+        publish(*batch);
+    }
+
+    // Cells waiting for the next water tick
+    size_t getScheduledCount() const { return due.size(); }
+
+    // Drop all scheduled work (world reset)
+    void clear() {
+        due.clear();
+        dueMasks.clear();
+        resetMaskCache();
+        resetCache();
+    }
+
+private:
+    static constexpr size_t CELLS_PER_JOB = 1024;
+
+    // Cells a flow rule reads: the cell itself, the one below, then HORIZONTAL
+    static constexpr int NEIGHBOURHOOD = 6;
+    static constexpr int SLOT_SELF = 0;
+    static constexpr int SLOT_BELOW = 1;
+
+    struct WaterWrite {
+        int x, y, z;      // World coordinates
+        uint8_t level;
+    };
+
+    // One scheduled cell and its neighbourhood as they were when the tick started
+    struct CellSnapshot {
+        glm::ivec3 position;                          // World coordinates
+        std::array<BlockType, NEIGHBOURHOOD> blocks;
+        std::array<uint8_t, NEIGHBOURHOOD> levels;
+        uint8_t visible = 0;                          // Bit per slot: cell could be read
+
+        // Snapshot read in world coordinates; false outside the neighbourhood,
+        // below the world or in a chunk that isn't loaded
+        bool read(int x, int y, int z, BlockType& block, uint8_t& level) const {
+            int slot = slotOf(x - position.x, y - position.y, z - position.z);
+            if (slot < 0 || !(visible & (1u << slot))) return false;
+            block = blocks[slot];
+            level = levels[slot];
+            return true;
+        }
+    };
+
+    // One bit per block of a chunk
+    using DueMask = std::array<uint64_t, CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z / 64>;
+
+    struct TickBatch {
+        std::vector<CellSnapshot> cells;               // Schedule order
+        std::vector<std::vector<WaterWrite>> writes;   // One list per job
+        size_t jobCount = 0;
+        std::atomic<size_t> nextJob{0};                // Next job to claim
+        std::atomic<size_t> remaining{0};              // Jobs not finished yet
+    };
+
+    struct Cell {
+        Chunk* chunk = nullptr;
+        int index = 0;
+        int localX = 0;
+        int localZ = 0;
+    };
+
+    static constexpr int HORIZONTAL[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+    static int slotOf(int dx, int dy, int dz) {
+        if (dy == -1) return (dx == 0 && dz == 0) ? SLOT_BELOW : -1;
+        if (dy != 0) return -1;
+        if (dx == 0 && dz == 0) return SLOT_SELF;
+        for (int i = 0; i < 4; i++) {
+            if (dx == HORIZONTAL[i][0] && dz == HORIZONTAL[i][1]) return 2 + i;
+        }
+        return -1;
+    }
+
+    static int floorDiv(int a, int b) {
+        return (a >= 0) ? a / b : (a - b + 1) / b;
+    }
+
+    // The flow rules for one water cell
+    // read(x, y, z, block, level) -> false if the cell can't be seen
+    // emit(x, y, z, level) is called for every cell that would rise to level
+    template<typename Read, typename Emit>
+    static void flowCell(Read&& read, int x, int y, int z, Emit&& emit) {
+        BlockType block;
+        uint8_t level;
+        if (!read(x, y, z, block, level) || level == 0) return;
+
+        // Flow down into open cells (air, plants) or water that isn't a full source yet
+        BlockType belowBlock = BlockType::AIR;
+        uint8_t belowLevel = 0;
+        bool hasBelow = y > 0 && read(x, y - 1, z, belowBlock, belowLevel);
+        if (hasBelow && !isBlockSolid(belowBlock) && belowLevel < WATER_SOURCE) {
+            emit(x, y - 1, z, WATER_SOURCE);
+        }
+
+        // Spread horizontally on solid ground or on a source
+        uint8_t spreadLevel = (level == WATER_SOURCE) ? WATER_MAX_SPREAD : level - 1;
+        if (spreadLevel == 0) return;
+        bool canSpread = (y == 0) || (hasBelow && (isBlockSolid(belowBlock) || belowLevel == WATER_SOURCE));
+        if (!canSpread) return;
+
+        for (const auto& dir : HORIZONTAL) {
+            int nx = x + dir[0], nz = z + dir[1];
+            BlockType neighbor;
+            uint8_t neighborLevel;
+            if (!read(nx, y, nz, neighbor, neighborLevel)) continue;  // Flows once that chunk loads
+            if (isBlockSolid(neighbor) || neighborLevel >= spreadLevel) continue;
+            emit(nx, y, nz, spreadLevel);
+        }
+    }
+
+    // Claim and run jobs until none are left (workers and the main thread)
+    static void runJobs(TickBatch& batch) {
+        size_t job;
+        while ((job = batch.nextJob.fetch_add(1, std::memory_order_relaxed)) < batch.jobCount) {
+            simulateJob(batch, job);
+            batch.remaining.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Run one job's cells against their snapshots
+    static void simulateJob(TickBatch& batch, size_t job) {
+        std::vector<WaterWrite>& writes = batch.writes[job];
+        auto emit = [&writes](int x, int y, int z, uint8_t level) {
+            writes.push_back({x, y, z, level});
+        };
+        size_t begin = job * CELLS_PER_JOB;
+        size_t end = std::min(begin + CELLS_PER_JOB, batch.cells.size());
+        for (size_t i = begin; i < end; i++) {
+            const CellSnapshot& cell = batch.cells[i];
+            auto read = [&cell](int x, int y, int z, BlockType& block, uint8_t& level) {
+                return cell.read(x, y, z, block, level);
+            };
+            flowCell(read, cell.position.x, cell.position.y, cell.position.z, emit);
+        }
+    }
+
+    // OPTIMIZATION: Dedup through a per-chunk bit per block instead of a hash set
+    // of cells - a flood schedules several cells for every write it publishes
+    void schedule(int x, int y, int z) {
+        if (y < 0 || y >= CHUNK_SIZE_Y) return;
+        glm::ivec2 chunkPos(floorDiv(x, CHUNK_SIZE_X), floorDiv(z, CHUNK_SIZE_Z));
+        int index = (x - chunkPos.x * CHUNK_SIZE_X) + (z - chunkPos.y * CHUNK_SIZE_Z) * CHUNK_SIZE_X +
+                    y * CHUNK_SIZE_X * CHUNK_SIZE_Z;
+        uint64_t& word = dueMaskFor(chunkPos)[index >> 6];
+        uint64_t bit = uint64_t(1) << (index & 63);
+        if (word & bit) return;  // Already due
+        word |= bit;
+        due.push_back(glm::ivec3(x, y, z));
+    }
+
+    DueMask& dueMaskFor(glm::ivec2 chunkPos) {
+        if (chunkPos != cachedMaskPos || !cachedMask) {
+            std::unique_ptr<DueMask>& mask = dueMasks[chunkPos];
+            if (!mask) mask = std::make_unique<DueMask>(DueMask{});
+            cachedMaskPos = chunkPos;
+            cachedMask = mask.get();
+        }
+        return *cachedMask;
+    }
+
+    void resetMaskCache() {
+        cachedMaskPos = glm::ivec2(std::numeric_limits<int>::min());
+        cachedMask = nullptr;
+    }
+
+    // Everything whose flow rule reads this cell, plus the cell itself
+    void scheduleAround(int x, int y, int z) {
+        schedule(x, y, z);
+        schedule(x, y + 1, z);
+        schedule(x, y - 1, z);
+        for (const auto& dir : HORIZONTAL) {
+            schedule(x + dir[0], y, z + dir[1]);
+        }
+    }
+
+    // Schedule the water cells of a local column range that would change something
+    void scheduleUnsettled(Chunk& chunk, int x0, int x1, int z0, int z1) {
+        auto read = [this](int x, int y, int z, BlockType& block, uint8_t& level) {
+            Cell cell = resolve(x, y, z);
+            if (!cell.chunk) return false;
+            block = cell.chunk->blocks[cell.index];
+            level = cell.chunk->waterLevels[cell.index];
+            return true;
+        };
+
+        int baseX = chunk.position.x * CHUNK_SIZE_X;
+        int baseZ = chunk.position.y * CHUNK_SIZE_Z;
+        for (int s = 0; s < CHUNK_SECTION_COUNT; s++) {
+            if (chunk.sections[s].isAllAir()) continue;  // No water in this section
+            int yEnd = (s + 1) * CHUNK_SECTION_HEIGHT;
+            for (int y = s * CHUNK_SECTION_HEIGHT; y < yEnd; y++) {
+                for (int z = z0; z <= z1; z++) {
+                    for (int x = x0; x <= x1; x++) {
+                        if (chunk.getWaterLevel(x, y, z) == 0) continue;
+                        bool moves = false;
+                        flowCell(read, baseX + x, y, baseZ + z,
+                                 [&moves](int, int, int, uint8_t) { moves = true; });
+                        if (moves) schedule(baseX + x, y, baseZ + z);
+                    }
+                }
+            }
+        }
+    }
+
+    // Main thread: copy the due cells and their neighbourhoods out of the live chunks
+    // OPTIMIZATION: Only the six cells each flow rule reads are copied, so the
+    // main-thread cost scales with the scheduled cells, not with the chunks they touch
+    void snapshot(TickBatch& batch) {
+        resetCache();
+        batch.cells.reserve(due.size());
+        for (const glm::ivec3& pos : due) {
+            glm::ivec2 chunkPos(floorDiv(pos.x, CHUNK_SIZE_X), floorDiv(pos.z, CHUNK_SIZE_Z));
+            int index = (pos.x - chunkPos.x * CHUNK_SIZE_X) + (pos.z - chunkPos.y * CHUNK_SIZE_Z) * CHUNK_SIZE_X +
+                        pos.y * CHUNK_SIZE_X * CHUNK_SIZE_Z;
+            dueMaskFor(chunkPos)[index >> 6] &= ~(uint64_t(1) << (index & 63));
+
+            Cell self = resolve(pos.x, pos.y, pos.z);
+            if (!self.chunk) continue;  // Unloaded since it was scheduled
+            if (self.chunk->waterLevels[self.index] == 0) continue;  // Nothing to flow
+
+            batch.cells.emplace_back();
+            CellSnapshot& cell = batch.cells.back();
+            cell.position = pos;
+            copyCell(cell, SLOT_SELF, self);
+            if (pos.y > 0) copyCell(cell, SLOT_BELOW, offsetCell(self, pos, 0, -1, 0));
+            for (int i = 0; i < 4; i++) {
+                copyCell(cell, 2 + i, offsetCell(self, pos, HORIZONTAL[i][0], 0, HORIZONTAL[i][1]));
+            }
+        }
+        due.clear();
+
+        // Every mask is empty again; keep them only for loaded chunks
+        for (auto it = dueMasks.begin(); it != dueMasks.end();) {
+            if (lookup(it->first)) ++it;
+            else it = dueMasks.erase(it);
+        }
+        resetMaskCache();
+    }
+
+    // Neighbour of a resolved cell; only crossing into another chunk needs a lookup
+    Cell offsetCell(const Cell& from, const glm::ivec3& pos, int dx, int dy, int dz) {
+        int lx = from.localX + dx;
+        int lz = from.localZ + dz;
+        if (lx < 0 || lx >= CHUNK_SIZE_X || lz < 0 || lz >= CHUNK_SIZE_Z) {
+            return resolve(pos.x + dx, pos.y + dy, pos.z + dz);
+        }
+        Cell cell = from;
+        cell.localX = lx;
+        cell.localZ = lz;
+        cell.index = from.index + dx + dz * CHUNK_SIZE_X + dy * CHUNK_SIZE_X * CHUNK_SIZE_Z;
+        return cell;
+    }
+
+    static void copyCell(CellSnapshot& cell, int slot, const Cell& source) {
+        if (!source.chunk) return;
+        cell.blocks[slot] = source.chunk->blocks[source.index];
+        cell.levels[slot] = source.chunk->waterLevels[source.index];
+        cell.visible |= static_cast<uint8_t>(1u << slot);
+    }
+
+    // Main thread: apply a finished tick to the live chunks, job by job
+    // Writes are re-checked against the live state, which may have been edited
+    // while the jobs were on the workers
+    void publish(TickBatch& batch) {
+        resetCache();
+        for (const std::vector<WaterWrite>& writes : batch.writes) {
+            for (const WaterWrite& write : writes) {
+                Cell cell = resolve(write.x, write.y, write.z);
+                if (!cell.chunk) continue;
+                if (isBlockSolid(cell.chunk->blocks[cell.index])) continue;
+                if (cell.chunk->waterLevels[cell.index] >= write.level) continue;
+                setWater(cell, write.x, write.y, write.z, write.level);
+            }
+        }
+    }
+
+    void setWater(const Cell& cell, int x, int y, int z, uint8_t level) {
+        cell.chunk->setWaterLevel(cell.localX, y, cell.localZ, level);
+        cell.chunk->isDirty = true;
+
+        // Water faces are culled against the neighbouring chunk's border blocks
+        glm::ivec2 pos = cell.chunk->position;
+        if (cell.localX == 0) markDirty(pos + glm::ivec2(-1, 0));
+        if (cell.localX == CHUNK_SIZE_X - 1) markDirty(pos + glm::ivec2(1, 0));
+        if (cell.localZ == 0) markDirty(pos + glm::ivec2(0, -1));
+        if (cell.localZ == CHUNK_SIZE_Z - 1) markDirty(pos + glm::ivec2(0, 1));
+
+        scheduleAround(x, y, z);
+    }
+
+    void markDirty(glm::ivec2 pos) {
+        Chunk* chunk = lookup(pos);
+        if (chunk) chunk->isDirty = true;
+    }
+
+    // Chunks can unload between calls, so the lookup cache lives for one call only
+    void resetCache() {
+        cachedPos = glm::ivec2(std::numeric_limits<int>::min());
+        cachedChunk = nullptr;
+    }
+
+    Cell resolve(int x, int y, int z) {
+        Cell cell;
+        glm::ivec2 chunkPos(floorDiv(x, CHUNK_SIZE_X), floorDiv(z, CHUNK_SIZE_Z));
+        if (chunkPos != cachedPos) {
+            cachedPos = chunkPos;
+            cachedChunk = lookup(chunkPos);
+        }
+        if (!cachedChunk) return cell;
+
+        cell.chunk = cachedChunk;
+        cell.localX = x - chunkPos.x * CHUNK_SIZE_X;
+        cell.localZ = z - chunkPos.y * CHUNK_SIZE_Z;
+        cell.index = cell.localX + cell.localZ * CHUNK_SIZE_X + y * CHUNK_SIZE_X * CHUNK_SIZE_Z;
+        return cell;
+    }
+
+    ChunkLookup lookup;
+    TaskRunner runTask;
+    glm::ivec2 cachedPos = glm::ivec2(std::numeric_limits<int>::min());
+    Chunk* cachedChunk = nullptr;
+
+    // Cells due on the next tick, in schedule order
+    std::vector<glm::ivec3> due;
+    std::unordered_map<glm::ivec2, std::unique_ptr<DueMask>> dueMasks;  // Dedup: bit set while in due
+    glm::ivec2 cachedMaskPos = glm::ivec2(std::numeric_limits<int>::min());
+    DueMask* cachedMask = nullptr;
+};
@@ -3,11 +3,15 @@
 #include "Chunk.h"
 #include "TerrainGenerator.h"
 #include "ChunkThreadPool.h"
+#include "LightEngine.h"
+#include "WaterSimulation.h"
+#include "WorldEdit.h"
 #include "../render/ChunkMesh.h"
 #include "../render/GPUCulling.h"
 #include "../render/VertexPool.h"
 #include "../render/RayBoxSprites.h"
 #include "../core/CrashHandler.h"
+#include "../core/FrameBudget.h"
 #include "WorldSaveLoad.h"
 #include <unordered_map>
 #include <memory>
@@ -283,16 +287,34 @@ public:
     // Thread pool for async chunk generation
     std::unique_ptr<ChunkThreadPool> chunkThreadPool;
 
+    // Incremental block light; edits and chunk arrivals queue work, the main thread drains it
+    LightEngine lightEngine{[this](glm::ivec2 pos) { return getChunk(pos); }};
+
+    // Scheduled water ticks; only cells next to a change are simulated, in jobs
+    // on the chunk threads (inline when multithreading is off)
+    WaterSimulation waterSimulation{
+        [this](glm::ivec2 pos) { return getChunk(pos); },
+        [this](std::function<void()> task) { runJob(std::move(task)); }};
+
+    // Run a job on the chunk threads (inline when multithreading is off)
+    // Jobs are served before queued chunk generation.
+    void runJob(std::function<void()> job) {
+        if (useMultithreading && chunkThreadPool) chunkThreadPool->queueTask(std::move(job));
+        else job();
+    }
+
     // Render distance in chunks
     int renderDistance = 8;
 
     // Unload distance (chunks beyond this are removed)
     int unloadDistance = 12;
 
-    // Max chunks to generate per frame (reasonable default)
+    // Chunk generation requests handed to the workers per frame
+    // (main-thread integration of the results is paced by frameBudget)
     int maxChunksPerFrame = 8;
 
-    // Max meshes to build per frame (strictly limited to prevent lag spikes)
+    // Mesh build requests handed to the workers per frame
+    // (GPU uploads of the results are paced by frameBudget)
     int maxMeshesPerFrame = 2;  // Increased from 1 for better responsiveness
 
     // Priority chunks - chunks modified by player get immediate mesh updates
@@ -300,11 +322,10 @@ public:
     std::mutex priorityMutex;
 
     // OPTIMIZATION: Frame time budget system
-    // Limits chunk/mesh processing based on available frame time
-    float frameTimeBudgetMs = 3.0f;  // Max ms to spend on mesh uploads per frame
-    float lastChunkProcessTimeMs = 0.0f;  // Track actual time spent
-    float lastMeshProcessTimeMs = 0.0f;
-    bool useFrameTimeBudget = true;  // Enable adaptive throttling
+    // All incremental main-thread work (chunk integration, mesh uploads, unloads,
+    // GPU cleanup, pre-generation) shares one budget that adapts to the frame time.
+    // Set the target from the display refresh rate. Tasks are registered in the constructor.
+    FrameBudgetScheduler frameBudget;
 
     // World seed
     int seed = 12345;
@@ -332,8 +353,6 @@ public:
     // Auto burst mode during initial load
     bool initialLoadComplete = false;
     int targetChunkCount = 0;  // Expected chunks based on render distance
-    bool meshletRegenerationNeeded = false;  // Flag to regenerate meshlets after burst mode
-    int meshletRegenIndex = 0;  // Current mesh index for lazy regeneration
 
     // ================================================================
     // CHUNK CACHING (Bobby-style)
@@ -357,6 +376,13 @@ public:
 
     World(int worldSeed = 12345) : terrainGenerator(worldSeed), seed(worldSeed) {
         // Thread pool will be initialized later via initThreadPool()
+
+        // Main-thread work, most urgent first (initial costs are only a starting guess)
+        frameBudget.addTask("chunks", 0, [this]() { return integrateCompletedChunk(); }, 0.3);
+        frameBudget.addTask("meshUploads", 10, [this]() { return uploadCompletedMesh(); }, 0.5);
+        frameBudget.addTask("unloads", 20, [this]() { return unloadNextChunk(); }, 0.1);
+        frameBudget.addTask("meshDeletions", 30, [this]() { return deleteDeferredMesh(); }, 0.1);
+        frameBudget.addTask("pregeneration", 40, [this]() { return pregenerateNextChunk(); }, 0.2);
     }
 
     // Initialize thread pool with specific thread counts (call after config is loaded)
@@ -370,6 +396,8 @@ public:
         chunkThreadPool = std::make_unique<ChunkThreadPool>(totalThreads, seed);
         std::cout << "Thread pool started with " << totalThreads << " total worker threads" << std::endl;
         std::cout << "  Chunk threads: " << chunkThreads << ", Mesh threads: " << meshThreads << std::endl;
+        std::cout << "  Terrain noise backend: "
+                  << NoiseBatch::backendName(terrainGenerator.continentNoise.getBackend()) << std::endl;
     }
 
     // Initialize indirect rendering buffers
@@ -433,6 +461,18 @@ public:
         return nullptr;
     }
 
+    // Look up a width x width block of chunk columns starting at origin under one
+    // read lock (row-major by z, null where unloaded). Used by WorldView.
+    void pinChunks(glm::ivec2 origin, int width, Chunk** out) {
+        std::shared_lock<std::shared_mutex> lock(chunksMutex);
+        for (int dz = 0; dz < width; dz++) {
+            for (int dx = 0; dx < width; dx++) {
+                auto it = chunks.find(glm::ivec2(origin.x + dx, origin.y + dz));
+                out[dz * width + dx] = (it != chunks.end()) ? it->second.get() : nullptr;
+            }
+        }
+    }
+
     // Get chunk at position (const)
     const Chunk* getChunk(glm::ivec2 pos) const {
         std::shared_lock<std::shared_mutex> lock(chunksMutex);  // Read lock - multiple threads can read
@@ -452,6 +492,17 @@ public:
         return ptr;
     }
 
+    // Generate a chunk on this thread and add it to the world, lit and with its
+    // seams and water scheduled like a chunk from the workers
+    Chunk* generateChunkNow(glm::ivec2 pos) {
+        Chunk* chunk = createChunk(pos);
+        terrainGenerator.generateChunk(*chunk);
+        LightEngine::lightChunk(*chunk);
+        lightEngine.seedChunkSeams(pos);
+        waterSimulation.onChunkLoaded(pos);
+        return chunk;
+    }
+
     // ================================================================
     // CHUNK CACHING & PRE-GENERATION METHODS
     // ================================================================
@@ -500,52 +551,40 @@ public:
                   << pregenerationTotal << " total chunks)" << std::endl;
     }
 
-    // Process pre-generation queue with lower priority than player chunks
-    void updatePregeneration() {
-        if (!pregenerationActive || pregenerationQueueIndex >= pregenerationQueue.size()) {
-            if (pregenerationActive) {
-                pregenerationActive = false;
-                std::cout << "[World] Pre-generation complete: " << pregenerationProgress
-                          << " chunks generated" << std::endl;
-            }
-            return;
+    // Pre-generate the next queued chunk (frame budget task, lowest priority)
+    // Disk-cached chunks load here; the rest go to the workers, but only while their
+    // queue is short so chunks around the player never wait behind pre-generation.
+    bool pregenerateNextChunk() {
+        if (!pregenerationActive) return false;
+        if (pregenerationQueueIndex >= pregenerationQueue.size()) {
+            pregenerationActive = false;
+            std::cout << "[World] Pre-generation complete: " << pregenerationProgress
+                      << " chunks generated" << std::endl;
+            return false;
+        }
+        if (chunkThreadPool && chunkThreadPool->getPendingCount() >= static_cast<size_t>(maxChunksPerFrame)) {
+            return false;  // Workers are busy; try again next frame
         }
 
-        // Lower priority than player chunks: 1-2 chunks per frame
-        int maxToQueue = burstMode ? 2 : 1;
-        int queued = 0;
-
-        while (pregenerationQueueIndex < pregenerationQueue.size() && queued < maxToQueue) {
-            glm::ivec2 chunkPos = pregenerationQueue[pregenerationQueueIndex++];
+        glm::ivec2 chunkPos = pregenerationQueue[pregenerationQueueIndex++];
 
-            // Skip if already exists in memory
-            if (getChunk(chunkPos) != nullptr) {
-                pregenerationProgress++;
-                continue;
-            }
+        // Skip if already exists in memory
+        if (getChunk(chunkPos) != nullptr) {
+            pregenerationProgress++;
+            return true;
+        }
 
-            // Check disk cache first
-            if (useChunkCaching && !worldSavePath.empty() &&
-                WorldSaveLoad::chunkExists(worldSavePath, chunkPos)) {
-                auto chunk = std::make_unique<Chunk>(chunkPos);
-                if (WorldSaveLoad::loadChunk(worldSavePath, *chunk, chunkPos)) {
-                    chunk->isDirty = true;
-                    chunk->recalculateHeightmaps();
-                    {
-                        std::unique_lock<std::shared_mutex> lock(chunksMutex);  // Write lock
-                        chunks[chunkPos] = std::move(chunk);
-                    }
-                    pregenerationProgress++;
-                    continue;
-                }
-            }
+        // Check disk cache first (the shared load path relights the chunk; light isn't saved)
+        if (tryLoadChunkFromCache(chunkPos)) {
+            pregenerationProgress++;
+            return true;
+        }
 
-            // Queue for generation via thread pool
-            if (chunkThreadPool && !chunkThreadPool->isGenerating(chunkPos)) {
-                chunkThreadPool->queueChunk(chunkPos);
-                queued++;
-            }
+        // Queue for generation via thread pool
+        if (chunkThreadPool && !chunkThreadPool->isGenerating(chunkPos)) {
+            chunkThreadPool->queueChunk(chunkPos);
         }
+        return true;
     }
 
     // Try to load chunk from disk cache, returns true if loaded
@@ -559,10 +598,13 @@ public:
             if (WorldSaveLoad::loadChunk(worldSavePath, *chunk, chunkPos)) {
                 chunk->isDirty = true;
                 chunk->recalculateHeightmaps();
+                LightEngine::lightChunk(*chunk);  // Light isn't saved
                 {
                     std::unique_lock<std::shared_mutex> lock(chunksMutex);  // Write lock
                     chunks[chunkPos] = std::move(chunk);
                 }
+                lightEngine.seedChunkSeams(chunkPos);
+                waterSimulation.onChunkLoaded(chunkPos);
                 return true;
             }
         }
@@ -692,30 +734,34 @@ public:
         Chunk* chunk = getChunk(chunkPos);
         if (!chunk) {
             // Generate new chunk if it doesn't exist
-            chunk = createChunk(chunkPos);
-            terrainGenerator.generateChunk(*chunk);
+            chunk = generateChunkNow(chunkPos);
         }
 
         // Convert to local coordinates
         int localX = x - chunkPos.x * CHUNK_SIZE_X;
         int localZ = z - chunkPos.y * CHUNK_SIZE_Z;
 
+        bool wasDirty = chunk->isDirty;
         chunk->setBlock(localX, y, localZ, type);
+        waterSimulation.onBlockChanged(x, y, z);
 
         // Mark this chunk modified (needs saving)
         chunk->isModified = true;
 
-        // For player interactions, rebuild mesh immediately for instant feedback
+        // For player interactions, relight and rebuild meshes immediately for instant feedback
         if (priority) {
-            rebuildMeshImmediate(chunkPos);
-
-            // Also rebuild neighboring chunks immediately if block is on edge
-            if (localX == 0) rebuildMeshImmediate(glm::ivec2(chunkPos.x - 1, chunkPos.y));
-            if (localX == CHUNK_SIZE_X - 1) rebuildMeshImmediate(glm::ivec2(chunkPos.x + 1, chunkPos.y));
-            if (localZ == 0) rebuildMeshImmediate(glm::ivec2(chunkPos.x, chunkPos.y - 1));
-            if (localZ == CHUNK_SIZE_Z - 1) rebuildMeshImmediate(glm::ivec2(chunkPos.x, chunkPos.y + 1));
+            // OPTIMIZATION: Only this edit's light BFS runs here (queued seam/edit work
+            // stays for updateLighting), and only the edited sections and the sections
+            // whose light changed are remeshed; the rest of each column keeps its upload
+            LightEngine::SectionMap sections = lightEngine.propagateEdit(x, y, z);
+            LightEngine::markSections(sections, chunkPos, localX, y, localZ);
+            if (!wasDirty) chunk->isDirty = false;  // This edit is covered by the section rebuild
+            for (const auto& [pos, mask] : sections) {
+                if (!rebuildMeshImmediate(pos, mask)) markChunkDirty(pos);
+            }
         } else {
-            // Non-priority: use async path
+            // Non-priority: use async path (light is drained by updateLighting)
+            lightEngine.onBlockChanged(x, y, z);
             chunk->isDirty = true;
             if (localX == 0) markChunkDirty(glm::ivec2(chunkPos.x - 1, chunkPos.y));
             if (localX == CHUNK_SIZE_X - 1) markChunkDirty(glm::ivec2(chunkPos.x + 1, chunkPos.y));
@@ -724,6 +770,72 @@ public:
         }
     }
 
+    // Apply a batch of block edits as one operation. Each chunk's writes land in
+    // one pass (Chunk::applyEdits), the affected sections are merged across the
+    // whole batch, and light and meshes are updated once for that union:
+    // one propagate() and at most one remesh per chunk, covering just its
+    // affected sections. priority works like setBlock: the batch is relit on
+    // its own (LightEngine::propagateEdits) and remeshed now; otherwise light
+    // and meshes follow asynchronously. Returns the number of blocks changed.
+    int applyEdits(WorldEditBatch& batch, bool priority = true) {
+        LightEngine::SectionMap sections;
+        std::vector<glm::ivec3> relight;
+        int changed = 0;
+
+        for (auto& [pos, edits] : batch.take()) {
+            Chunk* chunk = getChunk(pos);
+            if (!chunk) chunk = generateChunkNow(pos);
+
+            bool wasDirty = chunk->isDirty;
+            chunk->applyEdits(edits);
+            if (edits.empty()) continue;
+            chunk->isModified = true;
+            if (priority && !wasDirty) chunk->isDirty = false;  // Covered by the section rebuild below
+
+            // Sections touched in this chunk, and along each border in the neighbour
+            uint16_t own = 0, negX = 0, posX = 0, negZ = 0, posZ = 0;
+            int baseX = pos.x * CHUNK_SIZE_X;
+            int baseZ = pos.y * CHUNK_SIZE_Z;
+            for (const Chunk::BlockEdit& edit : edits) {
+                int x = edit.index % CHUNK_SIZE_X;
+                int z = (edit.index / CHUNK_SIZE_X) % CHUNK_SIZE_Z;
+                int y = edit.index / (CHUNK_SIZE_X * CHUNK_SIZE_Z);
+                if (priority) relight.emplace_back(baseX + x, y, baseZ + z);
+                else lightEngine.onBlockChanged(baseX + x, y, baseZ + z);
+                waterSimulation.onBlockChanged(baseX + x, y, baseZ + z);
+
+                uint16_t mask = LightEngine::sectionMaskForY(y);
+                own |= mask;
+                if (x == 0) negX |= mask;
+                if (x == CHUNK_SIZE_X - 1) posX |= mask;
+                if (z == 0) negZ |= mask;
+                if (z == CHUNK_SIZE_Z - 1) posZ |= mask;
+            }
+            sections[pos] |= own;
+            if (negX) sections[glm::ivec2(pos.x - 1, pos.y)] |= negX;
+            if (posX) sections[glm::ivec2(pos.x + 1, pos.y)] |= posX;
+            if (negZ) sections[glm::ivec2(pos.x, pos.y - 1)] |= negZ;
+            if (posZ) sections[glm::ivec2(pos.x, pos.y + 1)] |= posZ;
+            changed += static_cast<int>(edits.size());
+        }
+        if (changed == 0) return 0;
+
+        if (priority) {
+            for (const auto& [pos, mask] : lightEngine.propagateEdits(relight)) {
+                sections[pos] |= mask;
+            }
+            for (const auto& [pos, mask] : sections) {
+                if (!rebuildMeshImmediate(pos, mask)) markChunkDirty(pos);
+            }
+        } else {
+            // Light drains in updateLighting(), which marks what it changes
+            for (const auto& [pos, mask] : sections) {
+                markChunkDirty(pos);
+            }
+        }
+        return changed;
+    }
+
     // Mark chunk as needing mesh rebuild
     void markChunkDirty(glm::ivec2 pos, bool priority = false) {
         Chunk* chunk = getChunk(pos);
@@ -737,11 +849,13 @@ public:
     }
 
     // Immediately rebuild mesh for a chunk (synchronous, for instant block feedback)
-    void rebuildMeshImmediate(glm::ivec2 pos) {
-        if (!chunkThreadPool || !useOpenGLMeshes) return;
+    // Only the sub-chunks in sectionMask are regenerated and re-uploaded (all of them
+    // if the chunk has other pending changes). Returns false if it couldn't mesh.
+    bool rebuildMeshImmediate(glm::ivec2 pos, uint16_t sectionMask = 0xFFFF) {
+        if (!chunkThreadPool || !useOpenGLMeshes) return false;
 
         Chunk* chunk = getChunk(pos);
-        if (!chunk) return;
+        if (!chunk) return false;
 
         // Get neighbor chunks
         Chunk* chunkNegX = getChunk(glm::ivec2(pos.x - 1, pos.y));
@@ -750,7 +864,8 @@ public:
         Chunk* chunkPosZ = getChunk(glm::ivec2(pos.x, pos.y + 1));
 
         // Need all neighbors for proper meshing
-        if (!chunkNegX || !chunkPosX || !chunkNegZ || !chunkPosZ) return;
+        if (!chunkNegX || !chunkPosX || !chunkNegZ || !chunkPosZ) return false;
+        if (chunk->isDirty) sectionMask = 0xFFFF;
 
         // Create block getter lambdas
         const bool renderBorders = this->renderChunkBorderFaces;
@@ -771,7 +886,7 @@ public:
         };
 
         auto getLightLevel = [chunk, chunkNegX, chunkPosX, chunkNegZ, chunkPosZ, pos](int x, int y, int z) -> uint8_t {
-            if (y < 0 || y >= CHUNK_SIZE_Y) return 15;
+            if (y < 0 || y >= CHUNK_SIZE_Y) return y < 0 ? 0 : FULL_SKY_LIGHT;  // Open sky above the world
             int cx = static_cast<int>(floor(static_cast<float>(x) / CHUNK_SIZE_X));
             int cz = static_cast<int>(floor(static_cast<float>(z) / CHUNK_SIZE_Z));
             const Chunk* c = nullptr;
@@ -780,10 +895,10 @@ public:
             else if (cx == pos.x + 1 && cz == pos.y) c = chunkPosX;
             else if (cx == pos.x && cz == pos.y - 1) c = chunkNegZ;
             else if (cx == pos.x && cz == pos.y + 1) c = chunkPosZ;
-            if (!c) return 15;
+            if (!c) return FULL_SKY_LIGHT;  // Unloaded neighbour: open sky, like getSkyLight
             int lx = x - cx * CHUNK_SIZE_X;
             int lz = z - cz * CHUNK_SIZE_Z;
-            return c->getLightLevel(lx, y, lz);
+            return c->getPackedLight(lx, y, lz);  // Block + sky light
         };
 
         // Generate mesh data synchronously
@@ -794,7 +909,9 @@ public:
         // Dummy functions for unused parameters
         auto dummyBlock = [](int, int, int) -> BlockType { return BlockType::AIR; };
 
-        chunkThreadPool->generateMeshData(result, *chunk, dummyBlock, dummyBlock, getSafeBlock, getLightLevel);
+        chunkThreadPool->generateMeshData(result, *chunk, dummyBlock, dummyBlock, getSafeBlock, getLightLevel,
+                                          chunk->getBuriedSectionMask(chunkNegX, chunkPosX, chunkNegZ, chunkPosZ),
+                                          sectionMask);
 
         // Upload to GPU immediately
         auto it = meshes.find(pos);
@@ -805,8 +922,9 @@ public:
         ChunkMesh* mesh = meshes[pos].get();
         mesh->worldOffset = result.worldOffset;
 
-        // Upload each sub-chunk
+        // Upload each regenerated sub-chunk
         for (int subY = 0; subY < SUB_CHUNKS_PER_COLUMN; subY++) {
+            if (!(result.sectionMask & (1u << subY))) continue;
             auto& subData = result.subChunks[subY];
             auto& subChunk = mesh->subChunks[subY];
 
@@ -819,14 +937,18 @@ public:
                 mesh->uploadFaceBucketsToSubChunk(subY, subData.faceBucketVertices);
             }
 
+            // Upload meshlets built on the worker (mesh shader path)
+            if (!subData.meshlets.empty()) {
+                mesh->uploadMeshletsToSubChunk(subY, subData.faceBucketVertices.data(), FACE_BUCKET_COUNT,
+                                               subData.meshlets);
+            }
+
             // Upload water geometry
             if (!subData.waterVertices.empty()) {
                 mesh->uploadWaterToSubChunk(subY, subData.waterVertices);
             }
         }
 
-        // Update lightmap
-        mesh->updateLightmap(*chunk);
 
         // Mark chunk as no longer dirty since we just rebuilt it
         chunk->isDirty = false;
@@ -836,17 +958,17 @@ public:
             std::lock_guard<std::mutex> lock(priorityMutex);
             priorityChunks.erase(pos);
         }
+        return true;
     }
 
     // Generate initial world around spawn
     void generateWorld(int radiusChunks = 4) {
         for (int cx = -radiusChunks; cx <= radiusChunks; cx++) {
             for (int cz = -radiusChunks; cz <= radiusChunks; cz++) {
-                glm::ivec2 chunkPos(cx, cz);
-                Chunk* chunk = createChunk(chunkPos);
-                terrainGenerator.generateChunk(*chunk);
+                generateChunkNow(glm::ivec2(cx, cz));
             }
         }
+        lightEngine.propagate();
     }
 
     // Set world seed
@@ -855,6 +977,14 @@ public:
         terrainGenerator.setSeed(newSeed);
     }
 
+    // Select how caves are sampled (per world, stored in world.meta)
+    void setCaveSampling(CaveSampling mode) {
+        terrainGenerator.caveSampling = mode;
+        if (chunkThreadPool) {
+            chunkThreadPool->setCaveSampling(mode);
+        }
+    }
+
     // Reset world for new generation (clears all chunks and meshes)
     void reset() {
         // Stop any pending chunk generation
@@ -864,6 +994,7 @@ public:
 
         // Clear deferred mesh deletions queue first
         deferredMeshDeletions.clear();
+        unloadCandidates.clear();
 
         // Clear all meshes (they reference chunks)
         for (auto& [pos, mesh] : meshes) {
@@ -875,6 +1006,8 @@ public:
 
         // Clear all chunks
         chunks.clear();
+        lightEngine.clear();
+        waterSimulation.clear();
 
         // Reset stats
         lastRenderedChunks = 0;
@@ -889,9 +1022,8 @@ public:
         warmupFrames = 10;
     }
 
-    // Water simulation timer
-    float waterUpdateTimer = 0.0f;
-    float waterUpdateInterval = 0.1f;  // Update water every 100ms
+    // Seconds between water ticks (driven by the game's TickScheduler)
+    static constexpr float WATER_TICK_INTERVAL = 0.1f;
 
     // Get water level at world position
     uint8_t getWaterLevel(int x, int y, int z) const {
@@ -923,9 +1055,10 @@ public:
         int localZ = z - chunkPos.y * CHUNK_SIZE_Z;
 
         chunk->setWaterLevel(localX, y, localZ, level);
+        waterSimulation.onBlockChanged(x, y, z);
     }
 
-    // Get light level at world position
+    // Get block light level at world position
     uint8_t getLightLevel(int x, int y, int z) const {
         glm::ivec2 chunkPos(
             static_cast<int>(floor(static_cast<float>(x) / CHUNK_SIZE_X)),
@@ -941,94 +1074,45 @@ public:
         return chunk->getLightLevel(localX, y, localZ);
     }
 
-    // Set light level at world position
-    void setLightLevel(int x, int y, int z, uint8_t level) {
+    // Get sky light level at world position (full sky in unloaded chunks)
+    uint8_t getSkyLight(int x, int y, int z) const {
         glm::ivec2 chunkPos(
             static_cast<int>(floor(static_cast<float>(x) / CHUNK_SIZE_X)),
             static_cast<int>(floor(static_cast<float>(z) / CHUNK_SIZE_Z))
         );
 
-        Chunk* chunk = getChunk(chunkPos);
-        if (!chunk) return;
+        const Chunk* chunk = getChunk(chunkPos);
+        if (!chunk) return MAX_LIGHT_LEVEL;
 
         int localX = x - chunkPos.x * CHUNK_SIZE_X;
         int localZ = z - chunkPos.y * CHUNK_SIZE_Z;
 
-        chunk->setLightLevel(localX, y, localZ, level);
+        return chunk->getSkyLight(localX, y, localZ);
     }
 
-    // Propagate light within a single chunk only (no cross-chunk propagation)
-    // This is much faster than cross-chunk BFS
-    void propagateLightInChunk(Chunk& chunk, int startX, int startY, int startZ, uint8_t lightLevel) {
-        if (lightLevel == 0) return;
-
-        // Use a simple queue for BFS light propagation
-        struct LightNode {
-            int x, y, z;
-            uint8_t level;
-        };
-
-        std::vector<LightNode> queue;
-        queue.reserve(256);  // Pre-allocate for performance
-        queue.push_back({startX, startY, startZ, lightLevel});
-
-        // Set initial light
-        chunk.setLightLevel(startX, startY, startZ, lightLevel);
-
-        size_t head = 0;
-        while (head < queue.size()) {
-            LightNode node = queue[head++];
-
-            if (node.level <= 1) continue;
-
-            uint8_t newLevel = node.level - 1;
-
-            // Check all 6 directions
-            const int dirs[6][3] = {
-                {1, 0, 0}, {-1, 0, 0},
-                {0, 1, 0}, {0, -1, 0},
-                {0, 0, 1}, {0, 0, -1}
-            };
-
-            for (const auto& dir : dirs) {
-                int nx = node.x + dir[0];
-                int ny = node.y + dir[1];
-                int nz = node.z + dir[2];
+    // Set block light level at world position
+    void setLightLevel(int x, int y, int z, uint8_t level) {
+        glm::ivec2 chunkPos(
+            static_cast<int>(floor(static_cast<float>(x) / CHUNK_SIZE_X)),
+            static_cast<int>(floor(static_cast<float>(z) / CHUNK_SIZE_Z))
+        );
 
-                // Stay within chunk bounds
-                if (nx < 0 || nx >= CHUNK_SIZE_X) continue;
-                if (ny < 0 || ny >= CHUNK_SIZE_Y) continue;
-                if (nz < 0 || nz >= CHUNK_SIZE_Z) continue;
+        Chunk* chunk = getChunk(chunkPos);
+        if (!chunk) return;
 
-                BlockType neighbor = chunk.getBlock(nx, ny, nz);
+        int localX = x - chunkPos.x * CHUNK_SIZE_X;
+        int localZ = z - chunkPos.y * CHUNK_SIZE_Z;
 
-                // Light passes through air and transparent blocks
-                if (!isBlockSolid(neighbor) || isBlockTransparent(neighbor)) {
-                    uint8_t currentLight = chunk.getLightLevel(nx, ny, nz);
-                    if (newLevel > currentLight) {
-                        chunk.setLightLevel(nx, ny, nz, newLevel);
-                        queue.push_back({nx, ny, nz, newLevel});
-                    }
-                }
-            }
-        }
+        chunk->setLightLevel(localX, y, localZ, level);
     }
 
-    // Calculate lighting for a chunk (called after terrain generation)
-    void calculateChunkLighting(Chunk& chunk) {
-        // Find all emissive blocks and propagate their light within the chunk
-        for (int y = 0; y < CHUNK_SIZE_Y; y++) {
-            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    BlockType block = chunk.getBlock(x, y, z);
-
-                    if (isBlockEmissive(block)) {
-                        // Get emission level (15 for glowstone, 14 for lava)
-                        uint8_t emission = static_cast<uint8_t>(getBlockEmission(block) * 15.0f);
-                        propagateLightInChunk(chunk, x, y, z, emission);
-                    }
-                }
-            }
+    // Drain queued light updates (non-priority edits, chunk seams) and mark
+    // the chunks whose light changed for an async remesh
+    void updateLighting() {
+        if (!lightEngine.hasPendingWork()) return;
+        LightEngine::SectionMap sections = lightEngine.propagate();
+        for (const auto& [pos, mask] : sections) {
+            markChunkDirty(pos);
         }
     }
 
@@ -1063,11 +1147,6 @@ public:
             if (loadedChunks >= targetChunkCount && loadedMeshes >= targetChunkCount * 0.8f) {
                 initialLoadComplete = true;
                 burstMode = false;
-                if (chunkThreadPool) {
-                    chunkThreadPool->setFastLoadMode(false);  // Enable full LOD generation
-                }
-                meshletRegenerationNeeded = g_generateMeshlets;  // Queue meshlet regeneration
-                meshletRegenIndex = 0;
                 std::cout << "Initial load complete! " << loadedChunks << " chunks, "
                           << loadedMeshes << " meshes" << std::endl;
             } else {
@@ -1079,307 +1158,89 @@ public:
         static int updateTimingCounter = 0;
         auto t0 = std::chrono::high_resolution_clock::now();
 
-        // Process chunks completed by worker threads
-        processCompletedChunks();
+        // Integrate finished chunks/meshes, unload and clean up within the frame budget
+        collectUnloadCandidates(playerChunk);
+        runFrameBudget(deltaTime);
+        updateLighting();
         auto t1 = std::chrono::high_resolution_clock::now();
 
         // Queue new chunks for generation around player
         loadChunksAroundPlayer(playerChunk);
         auto t2 = std::chrono::high_resolution_clock::now();
 
-        // Unload distant chunks
-        unloadDistantChunks(playerChunk);
-        auto t3 = std::chrono::high_resolution_clock::now();
-
-        // Update water simulation (skip during burst mode for faster loading)
-        if (!burstMode) {
-            waterUpdateTimer += deltaTime;
-            if (waterUpdateTimer >= waterUpdateInterval) {
-                updateWater(playerChunk);
-                waterUpdateTimer = 0.0f;
-            }
-        }
-        auto t4 = std::chrono::high_resolution_clock::now();
-
-        // Update meshes
+        // Queue dirty meshes for rebuilding (water ticks run and publish in tickWater())
         updateMeshes(playerChunk);
-        auto t5 = std::chrono::high_resolution_clock::now();
+        auto t3 = std::chrono::high_resolution_clock::now();
 
         // Print timing every 30 frames or if any step takes >100ms
         auto ms = [](auto start, auto end) { return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count(); };
-        if (updateTimingCounter++ % 30 == 0 || ms(t0, t5) > 100) {
-            std::cout << "[World.update] processCompletedChunks=" << ms(t0,t1) << "ms, loadChunks=" << ms(t1,t2)
-                      << "ms, unload=" << ms(t2,t3) << "ms, water=" << ms(t3,t4) << "ms, updateMeshes=" << ms(t4,t5) << "ms" << std::endl;
-        }
-
-        // Lazy meshlet regeneration after burst mode (a few per frame)
-        if (meshletRegenerationNeeded && g_generateMeshlets) {
-            regenerateMeshletsLazy(8);  // Regenerate 8 sub-chunks per frame
-        }
-
-        // Process pre-generation queue (lower priority than player chunks)
-        if (pregenerationActive) {
-            updatePregeneration();
+        if (updateTimingCounter++ % 30 == 0 || ms(t0, t3) > 100) {
+            std::cout << "[World.update] budgeted=" << ms(t0,t1) << "ms (budget " << frameBudget.getBudgetMs()
+                      << "ms), loadChunks=" << ms(t1,t2) << "ms, updateMeshes=" << ms(t2,t3) << "ms" << std::endl;
         }
 
         // Process pending chunk saves (batched to avoid I/O stalls)
         processPendingSaves();
 
-        // Process deferred mesh deletions (spread GPU cleanup across frames)
-        processDeferredMeshDeletions();
-
         // Decrement warmup counter (skip frustum culling for first few frames)
         if (warmupFrames > 0) warmupFrames--;
 
         lastPlayerChunk = playerChunk;
     }
 
-    // Lazily regenerate meshlets for meshes that were created during burst mode
-    void regenerateMeshletsLazy(int maxPerFrame) {
-        if (!meshletRegenerationNeeded) return;
-
-        int processed = 0;
-        auto it = meshes.begin();
-
-        // Skip to current index
-        for (int i = 0; i < meshletRegenIndex && it != meshes.end(); ++i, ++it);
-
-        // Process a few meshes per frame
-        while (it != meshes.end() && processed < maxPerFrame) {
-            ChunkMesh* mesh = it->second.get();
-
-            // Find sub-chunks that need meshlet generation from cached data
-            for (int subY = 0; subY < SUB_CHUNKS_PER_COLUMN && processed < maxPerFrame; ++subY) {
-                auto& subChunk = mesh->subChunks[subY];
-
-                // Check if this sub-chunk needs deferred meshlet generation
-                if (subChunk.needsMeshletGeneration && !subChunk.cachedVerticesForMeshlets.empty()) {
-                    // Generate meshlets from cached vertex data
-                    mesh->generateMeshlets(subY, subChunk.cachedVerticesForMeshlets);
-
-                    // Clear cached data to free memory
-                    subChunk.cachedVerticesForMeshlets.clear();
-                    subChunk.cachedVerticesForMeshlets.shrink_to_fit();
-                    subChunk.needsMeshletGeneration = false;
-                    processed++;
-                }
-            }
-
-            ++it;
-            ++meshletRegenIndex;
-        }
-
-        // Check if done
-        if (it == meshes.end()) {
-            meshletRegenerationNeeded = false;
-            std::cout << "Meshlet regeneration complete!" << std::endl;
-        }
+    // Run the frame-budgeted main-thread tasks (also called by the loading screen)
+    // deltaTime is the previous frame's duration; 0 keeps the current budget.
+    void runFrameBudget(float deltaTime) {
+        frameBudget.setLoading(burstMode);
+        frameBudget.beginFrame(deltaTime * 1000.0);
+        frameBudget.run();
     }
 
-    // Simulate water flow
-    void updateWater(const glm::ivec2& playerChunk) {
-        auto startTime = std::chrono::high_resolution_clock::now();
-        constexpr float WATER_TIME_BUDGET_MS = 2.0f;  // Max 2ms for water updates per frame
-        int chunksProcessed = 0;
-
-        // Process chunks near the player
-        for (auto& [pos, chunk] : chunks) {
-            // Skip chunks without water (uses cached flag for fast culling)
-            if (!chunk->hasWater && !chunk->hasWaterUpdates) continue;
-
-            int dx = abs(pos.x - playerChunk.x);
-            int dz = abs(pos.y - playerChunk.y);
-
-            // Only simulate water in nearby chunks AND visible chunks
-            if (dx <= 4 && dz <= 4 && frustum.isChunkVisible(pos)) {
-                updateChunkWater(*chunk);
-                chunksProcessed++;
-
-                // Time budget check - limit water processing per frame
-                if (chunksProcessed >= 2) {  // At least process 2 chunks
-                    auto now = std::chrono::high_resolution_clock::now();
-                    float elapsedMs = std::chrono::duration<float, std::milli>(now - startTime).count();
-                    if (elapsedMs > WATER_TIME_BUDGET_MS) {
-                        break;  // Continue next frame
-                    }
-                }
-            }
-        }
+    // Run one water tick (fixed-rate tick handler, every WATER_TICK_INTERVAL)
+    // OPTIMIZATION: The tick's jobs run on the chunk threads with the main thread
+    // taking jobs too; it is published before returning, so every scheduled tick
+    // takes effect in that tick instead of being skipped while one is in flight
+    void tickWater() {
+        if (burstMode) return;  // Faster loading
+        waterSimulation.tick();
     }
 
-    // Update water in a single chunk
-    // OPTIMIZED: Cache chunk pointers to avoid millions of mutex locks
-    void updateChunkWater(Chunk& chunk) {
-        bool anyUpdates = false;
-
-        // Cache chunk pointers upfront (5 mutex locks instead of millions)
-        // This is the key optimization - we only lock once per neighbor chunk
-        const glm::ivec2 pos = chunk.position;
-        Chunk* chunkCenter = &chunk;
-        Chunk* chunkPosX = getChunk(glm::ivec2(pos.x + 1, pos.y));  // East
-        Chunk* chunkNegX = getChunk(glm::ivec2(pos.x - 1, pos.y));  // West
-        Chunk* chunkPosZ = getChunk(glm::ivec2(pos.x, pos.y + 1));  // South
-        Chunk* chunkNegZ = getChunk(glm::ivec2(pos.x, pos.y - 1));  // North
-
-        // Helper to get chunk for world coordinates (no mutex - uses cached pointers)
-        auto getChunkForWorld = [&](int wx, int wz) -> Chunk* {
-            int cx = static_cast<int>(floor(static_cast<float>(wx) / CHUNK_SIZE_X));
-            int cz = static_cast<int>(floor(static_cast<float>(wz) / CHUNK_SIZE_Z));
-            if (cx == pos.x && cz == pos.y) return chunkCenter;
-            if (cx == pos.x + 1 && cz == pos.y) return chunkPosX;
-            if (cx == pos.x - 1 && cz == pos.y) return chunkNegX;
-            if (cx == pos.x && cz == pos.y + 1) return chunkPosZ;
-            if (cx == pos.x && cz == pos.y - 1) return chunkNegZ;
-            return nullptr;  // Outside cached area
-        };
-
-        // Helper to get block without mutex (uses cached chunks)
-        auto getBlockCached = [&](int wx, int y, int wz) -> BlockType {
-            if (y < 0 || y >= CHUNK_SIZE_Y) return BlockType::AIR;
-            Chunk* c = getChunkForWorld(wx, wz);
-            if (!c) return BlockType::AIR;
-            int lx = wx - c->position.x * CHUNK_SIZE_X;
-            int lz = wz - c->position.y * CHUNK_SIZE_Z;
-            return c->getBlock(lx, y, lz);
-        };
-
-        // Helper to get water level without mutex
-        auto getWaterCached = [&](int wx, int y, int wz) -> uint8_t {
-            if (y < 0 || y >= CHUNK_SIZE_Y) return 0;
-            Chunk* c = getChunkForWorld(wx, wz);
-            if (!c) return 0;
-            int lx = wx - c->position.x * CHUNK_SIZE_X;
-            int lz = wz - c->position.y * CHUNK_SIZE_Z;
-            return c->getWaterLevel(lx, y, lz);
-        };
-
-        // Helper to set water level without mutex
-        auto setWaterCached = [&](int wx, int y, int wz, uint8_t level) -> bool {
-            if (y < 0 || y >= CHUNK_SIZE_Y) return false;
-            Chunk* c = getChunkForWorld(wx, wz);
-            if (!c) return false;
-            int lx = wx - c->position.x * CHUNK_SIZE_X;
-            int lz = wz - c->position.y * CHUNK_SIZE_Z;
-            c->setWaterLevel(lx, y, lz, level);
-            if (c != chunkCenter) c->isDirty = true;  // Mark neighbor as dirty too
-            return true;
-        };
+    // Integrate one chunk finished by the worker threads (frame budget task)
+    bool integrateCompletedChunk() {
+        if (!chunkThreadPool) return false;
 
-        // Process from top to bottom so water flows down first
-        for (int y = CHUNK_SIZE_Y - 1; y >= 0; y--) {
-            for (int z = 0; z < CHUNK_SIZE_Z; z++) {
-                for (int x = 0; x < CHUNK_SIZE_X; x++) {
-                    uint8_t level = chunk.getWaterLevel(x, y, z);
-                    if (level == 0) continue;
-
-                    // Get world coordinates
-                    int wx = pos.x * CHUNK_SIZE_X + x;
-                    int wz = pos.y * CHUNK_SIZE_Z + z;
-
-                    // Try to flow down first
-                    BlockType below = getBlockCached(wx, y - 1, wz);
-                    uint8_t belowLevel = getWaterCached(wx, y - 1, wz);
-
-                    if (y > 0 && !isBlockSolid(below) && below != BlockType::WATER) {
-                        // Flow down - water below becomes source-like
-                        setWaterCached(wx, y - 1, wz, WATER_SOURCE);
-                        anyUpdates = true;
-                    } else if (y > 0 && below == BlockType::WATER && belowLevel < WATER_SOURCE) {
-                        // Fill up water below
-                        setWaterCached(wx, y - 1, wz, WATER_SOURCE);
-                        anyUpdates = true;
-                    }
+        auto completed = chunkThreadPool->getCompletedChunks(1);
+        if (completed.empty()) return false;
+        ChunkThreadPool::ChunkResult& result = completed.front();
 
-                    // Spread horizontally if we're a source or have enough level
-                    if (level >= 1) {
-                        uint8_t spreadLevel = (level == WATER_SOURCE) ? WATER_MAX_SPREAD : level - 1;
-
-                        if (spreadLevel > 0) {
-                            // Check if we can spread (not blocked below or on solid ground)
-                            bool canSpread = (y == 0) || isBlockSolid(getBlockCached(wx, y - 1, wz)) ||
-                                           getWaterCached(wx, y - 1, wz) == WATER_SOURCE;
-
-                            if (canSpread) {
-                                // Try spreading in each horizontal direction
-                                const int dirs[4][2] = {{1,0}, {-1,0}, {0,1}, {0,-1}};
-                                for (auto& dir : dirs) {
-                                    int nx = wx + dir[0];
-                                    int nz = wz + dir[1];
-
-                                    BlockType neighbor = getBlockCached(nx, y, nz);
-                                    uint8_t neighborLevel = getWaterCached(nx, y, nz);
-
-                                    if (!isBlockSolid(neighbor) && neighborLevel < spreadLevel) {
-                                        setWaterCached(nx, y, nz, spreadLevel);
-                                        anyUpdates = true;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+        // Only add if not already present (could have been unloaded while generating)
+        {
+            std::unique_lock<std::shared_mutex> lock(chunksMutex);  // Write lock
+            auto it = chunks.find(result.position);
+            if (it == chunks.end()) {
+                chunks[result.position] = std::move(result.chunk);
+                chunks[result.position]->isDirty = true;
             }
         }
+        lightEngine.seedChunkSeams(result.position);
+        waterSimulation.onChunkLoaded(result.position);
 
-        if (anyUpdates) {
-            chunk.isDirty = true;
-        }
-    }
-
-    // Process completed chunks from thread pool (call from main thread)
-    void processCompletedChunks() {
-        if (!chunkThreadPool) return;
-
-        auto startTime = std::chrono::high_resolution_clock::now();
-
-        // OPTIMIZATION: Dynamic throttling based on frame time budget
-        // During burst mode, limit to prevent frame spikes
-        // Otherwise, process up to maxChunksPerFrame or until budget exhausted
-        int maxToProcess = burstMode ? 32 : maxChunksPerFrame;  // Reduced burst from 10000 to 32
-        int processed = 0;
+        // Mark neighboring chunks as dirty (uses getChunk which handles locking)
+        markChunkDirty(glm::ivec2(result.position.x - 1, result.position.y));
+        markChunkDirty(glm::ivec2(result.position.x + 1, result.position.y));
+        markChunkDirty(glm::ivec2(result.position.x, result.position.y - 1));
+        markChunkDirty(glm::ivec2(result.position.x, result.position.y + 1));
 
-        auto completed = chunkThreadPool->getCompletedChunks(maxToProcess);
-
-        for (auto& result : completed) {
-            // Check frame time budget (skip in burst mode for faster initial load)
-            if (!burstMode && useFrameTimeBudget && processed > 0) {
-                auto now = std::chrono::high_resolution_clock::now();
-                float elapsedMs = std::chrono::duration<float, std::milli>(now - startTime).count();
-                if (elapsedMs > frameTimeBudgetMs * 0.5f) {
-                    break;  // Leave remaining chunks for next frame
-                }
-            }
-
-            // Only add if not already present (could have been unloaded while generating)
-            {
-                std::unique_lock<std::shared_mutex> lock(chunksMutex);  // Write lock
-                auto it = chunks.find(result.position);
-                if (it == chunks.end()) {
-                    chunks[result.position] = std::move(result.chunk);
-                    chunks[result.position]->isDirty = true;
-                }
-            }
-
-            // Mark neighboring chunks as dirty (uses getChunk which handles locking)
-            markChunkDirty(glm::ivec2(result.position.x - 1, result.position.y));
-            markChunkDirty(glm::ivec2(result.position.x + 1, result.position.y));
-            markChunkDirty(glm::ivec2(result.position.x, result.position.y - 1));
-            markChunkDirty(glm::ivec2(result.position.x, result.position.y + 1));
-
-            // Queue chunk for async save (don't save immediately - causes 40ms+ stalls)
-            if (useChunkCaching && !worldSavePath.empty()) {
-                pendingSaveQueue.push(result.position);
-            }
-
-            // Update pregeneration progress
-            if (pregenerationActive) {
-                pregenerationProgress++;
-            }
-            processed++;
+        // Queue chunk for async save (don't save immediately - causes 40ms+ stalls)
+        if (useChunkCaching && !worldSavePath.empty()) {
+            pendingSaveQueue.push(result.position);
         }
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-        lastChunkProcessTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+        // Update pregeneration progress
+        if (pregenerationActive) {
+            pregenerationProgress++;
+        }
+        return true;
     }
 
     // Load chunks around player position
@@ -1450,9 +1311,7 @@ public:
                 if (useMultithreading && chunkThreadPool) {
                     chunkThreadPool->queueChunk(c.pos);
                 } else {
-                    Chunk* chunk = createChunk(c.pos);
-                    terrainGenerator.generateChunk(*chunk);
-                    calculateChunkLighting(*chunk);
+                    generateChunkNow(c.pos);
                     markChunkDirty(glm::ivec2(c.pos.x - 1, c.pos.y));
                     markChunkDirty(glm::ivec2(c.pos.x + 1, c.pos.y));
                     markChunkDirty(glm::ivec2(c.pos.x, c.pos.y - 1));
@@ -1482,9 +1341,7 @@ public:
                                     chunksQueued++;
                                 }
                             } else {
-                                Chunk* chunk = createChunk(chunkPos);
-                                terrainGenerator.generateChunk(*chunk);
-                                calculateChunkLighting(*chunk);
+                                generateChunkNow(chunkPos);
                                 chunksQueued++;
                                 markChunkDirty(glm::ivec2(chunkPos.x - 1, chunkPos.y));
                                 markChunkDirty(glm::ivec2(chunkPos.x + 1, chunkPos.y));
@@ -1499,15 +1356,15 @@ public:
     }
 
     // Unload chunks that are too far from the player
-    // Limit unloads per frame to prevent lag spikes from mesh destruction
-    static constexpr int MAX_UNLOADS_PER_FRAME = 8;
+    // Candidates are collected once per frame; unloadNextChunk() removes them
+    // farthest first while the frame budget allows, so mesh destruction never spikes.
+    std::vector<std::pair<int, glm::ivec2>> unloadCandidates;  // (distSq, pos), nearest first
 
     // Deferred mesh destruction queue - meshes are queued here and destroyed gradually
     std::vector<std::unique_ptr<ChunkMesh>> deferredMeshDeletions;
-    static constexpr int MAX_MESH_DELETIONS_PER_FRAME = 4;
 
-    void unloadDistantChunks(const glm::ivec2& playerChunk) {
-        std::vector<std::pair<int, glm::ivec2>> toRemove;  // (distance, pos) for sorting
+    void collectUnloadCandidates(const glm::ivec2& playerChunk) {
+        unloadCandidates.clear();
 
         // Find chunks to unload (with read lock first)
         {
@@ -1518,61 +1375,48 @@ public:
 
                 if (dx > unloadDistance || dz > unloadDistance) {
                     int distSq = dx * dx + dz * dz;
-                    toRemove.push_back({distSq, pos});
+                    unloadCandidates.push_back({distSq, pos});
                 }
             }
         }
 
-        // If nothing to unload, return early
-        if (toRemove.empty()) return;
-
-        // Sort by distance (farthest first) so we prioritize unloading the most distant chunks
-        std::sort(toRemove.begin(), toRemove.end(),
-            [](const auto& a, const auto& b) { return a.first > b.first; });
+        // Nearest first, so the most distant chunks come off the back first
+        std::sort(unloadCandidates.begin(), unloadCandidates.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+    }
 
-        // Limit how many we unload this frame to prevent lag spikes
-        int unloadCount = std::min(static_cast<int>(toRemove.size()), MAX_UNLOADS_PER_FRAME);
+    // Unload the most distant candidate (frame budget task)
+    bool unloadNextChunk() {
+        if (unloadCandidates.empty()) return false;
+        glm::ivec2 pos = unloadCandidates.back().second;
+        unloadCandidates.pop_back();
 
-        // Remove chunks (with write lock)
         {
             std::unique_lock<std::shared_mutex> lock(chunksMutex);  // Write lock for erase
-            for (int i = 0; i < unloadCount; i++) {
-                chunks.erase(toRemove[i].second);
-            }
+            chunks.erase(pos);
         }
 
-        // Queue meshes for deferred destruction (no lock needed - meshes accessed only from main thread)
+        // Queue mesh for deferred destruction (no lock needed - meshes accessed only from main thread)
         // This spreads GPU resource cleanup across multiple frames
-        for (int i = 0; i < unloadCount; i++) {
-            auto it = meshes.find(toRemove[i].second);
-            if (it != meshes.end()) {
-                // Move mesh to deferred deletion queue
-                deferredMeshDeletions.push_back(std::move(it->second));
-                meshes.erase(it);
-            }
+        auto it = meshes.find(pos);
+        if (it != meshes.end()) {
+            deferredMeshDeletions.push_back(std::move(it->second));
+            meshes.erase(it);
         }
+        return true;
     }
 
-    // Process deferred mesh deletions (call once per frame)
-    void processDeferredMeshDeletions() {
-        if (deferredMeshDeletions.empty()) return;
-
-        // Delete a limited number of meshes per frame to avoid spikes
-        int deleteCount = std::min(static_cast<int>(deferredMeshDeletions.size()), MAX_MESH_DELETIONS_PER_FRAME);
-
-        // Remove from back (faster for vector)
-        for (int i = 0; i < deleteCount; i++) {
-            deferredMeshDeletions.pop_back();  // unique_ptr destructor calls mesh->destroy()
-        }
+    // Destroy one deferred mesh (frame budget task)
+    bool deleteDeferredMesh() {
+        if (deferredMeshDeletions.empty()) return false;
+        deferredMeshDeletions.pop_back();  // unique_ptr destructor calls mesh->destroy()
+        return true;
     }
 
     // Update chunk meshes around player - queues async mesh generation
     void updateMeshes(const glm::ivec2& playerChunk) {
         int meshesQueued = 0;
 
-        // First, process any completed meshes from worker threads
-        processCompletedMeshes();
-
         // Get priority chunks (player-modified) - these bypass normal limits
         std::unordered_set<glm::ivec2> currentPriority;
         {
@@ -1617,7 +1461,6 @@ public:
             if (!chunk) continue;
 
             // OPTIMIZATION: Cache all 5 chunk pointers upfront (1 lock instead of thousands)
-            // This is the same pattern used in updateChunkWater()
             Chunk* chunkNegX = getChunk(glm::ivec2(pos.x - 1, pos.y));  // West
             Chunk* chunkPosX = getChunk(glm::ivec2(pos.x + 1, pos.y));  // East
             Chunk* chunkNegZ = getChunk(glm::ivec2(pos.x, pos.y - 1));  // North
@@ -1635,6 +1478,7 @@ public:
             request.chunk = chunk;
             request.isPriority = isPriority;  // Player-modified chunks get priority processing
             request.distanceSquared = isPriority ? 0 : distSq;  // Priority: closer chunks processed first
+            request.buriedSections = chunk->getBuriedSectionMask(chunkNegX, chunkPosX, chunkNegZ, chunkPosZ);
 
             // Capture cached chunk pointers by value for thread safety
             const bool renderBorders = this->renderChunkBorderFaces;
@@ -1688,7 +1532,7 @@ public:
             };
 
             request.getLightLevel = [chunk, chunkNegX, chunkPosX, chunkNegZ, chunkPosZ, pos](int x, int y, int z) -> uint8_t {
-                if (y < 0 || y >= CHUNK_SIZE_Y) return 15;
+                if (y < 0 || y >= CHUNK_SIZE_Y) return y < 0 ? 0 : FULL_SKY_LIGHT;  // Open sky above the world
                 int cx = static_cast<int>(floor(static_cast<float>(x) / CHUNK_SIZE_X));
                 int cz = static_cast<int>(floor(static_cast<float>(z) / CHUNK_SIZE_Z));
                 const Chunk* c = nullptr;
@@ -1697,10 +1541,10 @@ public:
                 else if (cx == pos.x + 1 && cz == pos.y) c = chunkPosX;
                 else if (cx == pos.x && cz == pos.y - 1) c = chunkNegZ;
                 else if (cx == pos.x && cz == pos.y + 1) c = chunkPosZ;
-                if (!c) return 15;
+                if (!c) return FULL_SKY_LIGHT;  // Unloaded neighbour: open sky, like getSkyLight
                 int lx = x - cx * CHUNK_SIZE_X;
                 int lz = z - cz * CHUNK_SIZE_Z;
-                return c->getLightLevel(lx, y, lz);
+                return c->getPackedLight(lx, y, lz);  // Block + sky light
             };
 
             chunkThreadPool->queueMesh(std::move(request));
@@ -1710,182 +1554,105 @@ public:
         }
     }
 
-    // Process completed meshes from worker threads (upload to GPU)
-    void processCompletedMeshes() {
-        if (!chunkThreadPool) return;
-
-        // Skip OpenGL mesh uploads when using Vulkan backend
-        // The renderer will handle mesh data through its own vertex pool
-        if (!useOpenGLMeshes) {
-            // Just consume completed meshes without uploading to OpenGL
-            auto completedMeshes = chunkThreadPool->getCompletedMeshes(burstMode ? 64 : maxMeshesPerFrame);
-            for (auto& meshResult : completedMeshes) {
-                glm::ivec2 pos = meshResult.position;
-                Chunk* chunk = getChunk(pos);
-                if (chunk == nullptr) continue;
-
-                // Create or get mesh (store mesh data without OpenGL upload)
-                auto it = meshes.find(pos);
-                if (it == meshes.end()) {
-                    meshes[pos] = std::make_unique<ChunkMesh>();
-                }
-                ChunkMesh* mesh = meshes[pos].get();
-                mesh->worldOffset = meshResult.worldOffset;
-
-                // Store sub-chunk vertex data for renderer to use
-                for (int subY = 0; subY < SUB_CHUNKS_PER_COLUMN; subY++) {
-                    auto& subData = meshResult.subChunks[subY];
-                    auto& subChunk = mesh->subChunks[subY];
-                    subChunk.subChunkY = subData.subChunkY;
-                    subChunk.isEmpty = subData.isEmpty;
-                    subChunk.hasWater = subData.hasWater;
-                    // Combine face bucket vertices into single cached array for RHI renderer
-                    subChunk.cachedVertices.clear();
-                    for (const auto& bucket : subData.faceBucketVertices) {
-                        subChunk.cachedVertices.insert(subChunk.cachedVertices.end(),
-                            bucket.begin(), bucket.end());
-                    }
-                    subChunk.cachedWaterVertices = std::move(subData.waterVertices);
-                }
-            }
-            return;
-        }
-
-        auto startTime = std::chrono::high_resolution_clock::now();
-
-        // OPTIMIZATION: Strict limits to prevent GPU stalls and lag spikes
-        // During burst mode (initial load), process more but still limit
-        // During normal gameplay, process very few to maintain smooth framerate
-        // Priority meshes (player-modified) always get processed immediately
-        int maxToProcess = burstMode ? 8 : maxMeshesPerFrame + 4;  // +4 for potential priority meshes
-        auto completedMeshes = chunkThreadPool->getCompletedMeshes(maxToProcess);
-        int processed = 0;
-        int normalProcessed = 0;  // Track non-priority meshes separately
-        int subChunksUploaded = 0;
-        bool timeExceeded = false;
-
-        // Helper to check time budget - called frequently during upload
-        auto checkTimeBudget = [&]() -> bool {
-            if (burstMode) return false;  // No limit during burst mode
-            if (!useFrameTimeBudget) return false;
-            auto now = std::chrono::high_resolution_clock::now();
-            float elapsedMs = std::chrono::duration<float, std::milli>(now - startTime).count();
-            return elapsedMs > frameTimeBudgetMs;
-        };
+    // Meshes integrated so far (paces glFlush and crash-report updates)
+    uint64_t meshesIntegrated = 0;
 
-        for (auto& meshResult : completedMeshes) {
-            if (timeExceeded) break;
-
-            // Priority meshes always get processed; normal meshes respect limits
-            bool isPriority = meshResult.isPriority;
-            if (!isPriority) {
-                // Check time budget BEFORE processing each non-priority mesh
-                if (!burstMode && useFrameTimeBudget && normalProcessed > 0 && checkTimeBudget()) {
-                    break;  // Leave remaining meshes for next frame
-                }
-                if (!burstMode && normalProcessed >= maxMeshesPerFrame) {
-                    break;  // Hit normal mesh limit
-                }
-            }
+    // Upload one mesh finished by the worker threads (frame budget task)
+    // Every sub-chunk of a mesh goes up together, so a chunk never shows half-updated.
+    bool uploadCompletedMesh() {
+        if (!chunkThreadPool) return false;
 
-            glm::ivec2 pos = meshResult.position;
+        auto completedMeshes = chunkThreadPool->getCompletedMeshes(1);
+        if (completedMeshes.empty()) return false;
+        ChunkThreadPool::MeshResult& meshResult = completedMeshes.front();
 
-            // Skip if chunk was unloaded while mesh was generating
-            Chunk* chunk = getChunk(pos);
-            if (chunk == nullptr) continue;
+        glm::ivec2 pos = meshResult.position;
 
-            // Create or get mesh
-            auto it = meshes.find(pos);
-            if (it == meshes.end()) {
-                meshes[pos] = std::make_unique<ChunkMesh>();
-            }
+        // Skip if chunk was unloaded while mesh was generating
+        Chunk* chunk = getChunk(pos);
+        if (chunk == nullptr) return true;
 
-            ChunkMesh* mesh = meshes[pos].get();
-            mesh->worldOffset = meshResult.worldOffset;
+        // Create or get mesh
+        auto it = meshes.find(pos);
+        if (it == meshes.end()) {
+            meshes[pos] = std::make_unique<ChunkMesh>();
+        }
 
-            // Update world info for crash reports (only during burst mode to reduce overhead)
-            if (burstMode && (processed % 10 == 0)) {
-                std::stringstream worldInfo;
-                worldInfo << "Meshes processed: " << processed << "\n";
-                worldInfo << "Current chunk: (" << pos.x << ", " << pos.y << ")\n";
-                worldInfo << "Total meshes: " << meshes.size();
-                Core::CrashHandler::instance().setWorldInfo(worldInfo.str());
-            }
+        ChunkMesh* mesh = meshes[pos].get();
+        mesh->worldOffset = meshResult.worldOffset;
+        meshesIntegrated++;
 
-            // Upload each sub-chunk's data to GPU
-            // Check time budget BEFORE each sub-chunk to prevent long stalls
+        // Skip OpenGL mesh uploads when using Vulkan backend
+        // The renderer will handle mesh data through its own vertex pool
+        if (!useOpenGLMeshes) {
+            // Store sub-chunk vertex data for renderer to use
             for (int subY = 0; subY < SUB_CHUNKS_PER_COLUMN; subY++) {
-                // Strict time check before EACH sub-chunk during normal gameplay
-                if (!burstMode && subChunksUploaded > 0) {
-                    if (checkTimeBudget()) {
-                        timeExceeded = true;
-                        break;
-                    }
-                }
-
                 auto& subData = meshResult.subChunks[subY];
                 auto& subChunk = mesh->subChunks[subY];
-
                 subChunk.subChunkY = subData.subChunkY;
                 subChunk.isEmpty = subData.isEmpty;
-
-                // Upload LOD 0 using face buckets for 35% better backface culling
-                bool hasLOD0Data = subData.getLOD0VertexCount() > 0;
-                if (hasLOD0Data) {
-                    mesh->uploadFaceBucketsToSubChunk(subY, subData.faceBucketVertices);
-                    subChunksUploaded++;
+                subChunk.hasWater = subData.hasWater;
+                // Combine face bucket vertices into single cached array for RHI renderer
+                subChunk.cachedVertices.clear();
+                for (const auto& bucket : subData.faceBucketVertices) {
+                    subChunk.cachedVertices.insert(subChunk.cachedVertices.end(),
+                        bucket.begin(), bucket.end());
                 }
+                subChunk.cachedWaterVertices = std::move(subData.waterVertices);
+            }
+            return true;
+        }
 
-                // Upload solid geometry for LOD 1+ (no face buckets for distant geometry)
-                for (int lod = 1; lod < LOD_LEVELS; lod++) {
-                    if (!subData.lodVertices[lod].empty()) {
-                        mesh->uploadToSubChunk(subY, subData.lodVertices[lod], lod);
-                    }
-                }
+        // Update world info for crash reports (only during burst mode to reduce overhead)
+        if (burstMode && (meshesIntegrated % 10 == 0)) {
+            std::stringstream worldInfo;
+            worldInfo << "Meshes processed: " << meshesIntegrated << "\n";
+            worldInfo << "Current chunk: (" << pos.x << ", " << pos.y << ")\n";
+            worldInfo << "Total meshes: " << meshes.size();
+            Core::CrashHandler::instance().setWorldInfo(worldInfo.str());
+        }
 
-                // OPTIMIZATION: Always defer meshlet generation to avoid lag spikes
-                // Meshlets are optional and can be generated lazily later
-                if (g_generateMeshlets && hasLOD0Data) {
-                    // Combine face buckets into a single vertex array for meshlet generation
-                    std::vector<PackedChunkVertex> combinedVertices;
-                    combinedVertices.reserve(subData.getLOD0VertexCount());
-                    for (const auto& bucket : subData.faceBucketVertices) {
-                        combinedVertices.insert(combinedVertices.end(), bucket.begin(), bucket.end());
-                    }
-                    // Always cache for deferred generation - never block main thread
-                    subChunk.cachedVerticesForMeshlets = std::move(combinedVertices);
-                    subChunk.needsMeshletGeneration = true;
-                }
+        // Upload each sub-chunk's data to GPU
+        for (int subY = 0; subY < SUB_CHUNKS_PER_COLUMN; subY++) {
+            auto& subData = meshResult.subChunks[subY];
+            auto& subChunk = mesh->subChunks[subY];
 
-                // Upload pre-generated water vertices (generated on worker thread)
-                subChunk.hasWater = subData.hasWater;
-                if (!subData.waterVertices.empty()) {
-                    mesh->uploadWaterToSubChunk(subY, subData.waterVertices);
-                }
-            }
+            subChunk.subChunkY = subData.subChunkY;
+            subChunk.isEmpty = subData.isEmpty;
 
-            // Only update lightmap if we finished the entire mesh
-            if (!timeExceeded) {
-                // Update 3D lightmap texture for smooth lighting across greedy-meshed quads
-                mesh->updateLightmap(*chunk);
+            // Upload LOD 0 using face buckets for 35% better backface culling
+            bool hasLOD0Data = subData.getLOD0VertexCount() > 0;
+            if (hasLOD0Data) {
+                mesh->uploadFaceBucketsToSubChunk(subY, subData.faceBucketVertices);
             }
 
-            // Flush GPU commands after each mesh to prevent command buffer buildup
-            if (!burstMode && processed > 0) {
-                glFlush();
+            // Upload solid geometry for LOD 1+ (no face buckets for distant geometry)
+            for (int lod = 1; lod < LOD_LEVELS; lod++) {
+                if (!subData.lodVertices[lod].empty()) {
+                    mesh->uploadToSubChunk(subY, subData.lodVertices[lod], lod);
+                }
             }
 
-            processed++;
-            if (!isPriority) normalProcessed++;
+            // OPTIMIZATION: Meshlets are clustered on the mesh worker, so the main
+            // thread only streams the buckets and descriptors into SSBOs
+            if (g_generateMeshlets && hasLOD0Data && !subData.meshlets.empty()) {
+                mesh->uploadMeshletsToSubChunk(subY, subData.faceBucketVertices.data(), FACE_BUCKET_COUNT,
+                                               subData.meshlets);
+            }
 
-            // During burst mode, flush every 4 meshes
-            if (burstMode && (processed % 4) == 0) {
-                glFlush();
+            // Upload pre-generated water vertices (generated on worker thread)
+            subChunk.hasWater = subData.hasWater;
+            if (!subData.waterVertices.empty()) {
+                mesh->uploadWaterToSubChunk(subY, subData.waterVertices);
             }
         }
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-        lastMeshProcessTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
+        // Flush GPU commands to prevent command buffer buildup
+        // (every mesh during gameplay, every 4 meshes during burst mode)
+        if (!burstMode || (meshesIntegrated % 4) == 0) {
+            glFlush();
+        }
+        return true;
     }
 
     // Legacy function for compatibility
@@ -2021,8 +1788,6 @@ public:
             if (chunkOffsetLoc >= 0) {
                 glUniform3fv(chunkOffsetLoc, 1, glm::value_ptr(chunk.mesh->worldOffset));
             }
-            // Bind 3D lightmap texture for smooth lighting
-            chunk.mesh->bindLightmap(2);
             // Calculate LOD level based on distance (or use forced LOD for shadow pass)
             int lodLevel = (forcedLOD >= 0) ? forcedLOD : calculateLOD(chunk.distSq);
             chunk.mesh->render(lodLevel);
@@ -2096,13 +1861,11 @@ public:
         // Render sorted sub-chunks with LOD based on distance
         ChunkMesh* lastMesh = nullptr;
         for (const auto& sub : visibleSubChunks) {
-            // Only update uniform and bind lightmap if mesh changed (batching optimization)
+            // Only update uniform if mesh changed (batching optimization)
             if (sub.mesh != lastMesh) {
                 if (chunkOffsetLoc >= 0) {
                     glUniform3fv(chunkOffsetLoc, 1, glm::value_ptr(sub.mesh->worldOffset));
                 }
-                // Bind 3D lightmap texture for smooth lighting
-                sub.mesh->bindLightmap(2);
                 lastMesh = sub.mesh;
             }
 
@@ -2190,11 +1953,15 @@ public:
                 glm::mat4 viewProj;
                 glm::vec3 chunkOffset;
                 uint32_t meshletCount;
+                glm::vec3 cameraPos;   // Normal cone culling in the task shader
+                float padding;
             } uboData;
 
             uboData.viewProj = viewProj;
             uboData.chunkOffset = sub.mesh->worldOffset;
             uboData.meshletCount = static_cast<uint32_t>(meshletData.meshlets.size());
+            uboData.cameraPos = playerPos;
+            uboData.padding = 0.0f;
 
             glBindBuffer(GL_UNIFORM_BUFFER, meshShaderDataUBO);
             glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(MeshShaderData), &uboData);
@@ -2287,8 +2054,6 @@ public:
             if (chunkOffsetLoc >= 0) {
                 glUniform3fv(chunkOffsetLoc, 1, glm::value_ptr(col.mesh->worldOffset));
             }
-            // Bind 3D lightmap texture for smooth lighting
-            col.mesh->bindLightmap(2);
 
             // Render all sub-chunks in this column
             for (const auto& [subY, lodLevel] : col.subChunks) {
@@ -2427,13 +2192,11 @@ public:
                     continue;
                 }
 
-                // Update chunk offset and lightmap if mesh changed
+                // Update chunk offset if mesh changed
                 if (ref.mesh != lastMesh) {
                     if (chunkOffsetLoc >= 0) {
                         glUniform3fv(chunkOffsetLoc, 1, glm::value_ptr(ref.mesh->worldOffset));
                     }
-                    // Bind 3D lightmap texture for smooth lighting
-                    ref.mesh->bindLightmap(2);
                     lastMesh = ref.mesh;
                 }
 
@@ -2449,8 +2212,6 @@ public:
                     if (chunkOffsetLoc >= 0) {
                         glUniform3fv(chunkOffsetLoc, 1, glm::value_ptr(ref.mesh->worldOffset));
                     }
-                    // Bind 3D lightmap texture for smooth lighting
-                    ref.mesh->bindLightmap(2);
                     lastMesh = ref.mesh;
                 }
                 ref.mesh->renderSubChunk(ref.subChunkY, ref.lodLevel);
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Chunk.h"
+#include "Block.h"
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cmath>
+#include <glm/glm.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/hash.hpp>
+
+// ============================================================================
+// WORLD EDIT BATCH
+// ============================================================================
+// Collects the block writes of a multi-block operation (tree felling,
+// explosions, /fill) so World::applyEdits() can apply them as one edit:
+// writes are grouped per chunk and sorted by block index, each chunk is
+// written in one pass, and light and meshes are updated once for the union
+// of the sections the batch touched - not once per block.
+//
+// Nothing reaches the world until applyEdits(); a batch that is never
+// applied is simply discarded. Later writes to the same block win.
+// ============================================================================
+
+class WorldEditBatch {
+public:
+    using ChunkEdits = std::pair<glm::ivec2, std::vector<Chunk::BlockEdit>>;
+
+    // Queue a write at world position (ignored outside the world's height)
+    void setBlock(int x, int y, int z, BlockType type) {
+        if (y < 0 || y >= CHUNK_SIZE_Y) return;
+        glm::ivec2 chunkPos(
+            static_cast<int>(floor(static_cast<float>(x) / CHUNK_SIZE_X)),
+            static_cast<int>(floor(static_cast<float>(z) / CHUNK_SIZE_Z))
+        );
+        int localX = x - chunkPos.x * CHUNK_SIZE_X;
+        int localZ = z - chunkPos.y * CHUNK_SIZE_Z;
+        pending[chunkPos].push_back({static_cast<uint16_t>(Chunk::toIndex(localX, y, localZ)), type});
+        writeCount++;
+    }
+
+    // Queue writes for every block in the inclusive box [from, to]
+    void fill(const glm::ivec3& from, const glm::ivec3& to, BlockType type) {
+        glm::ivec3 lo = glm::min(from, to);
+        glm::ivec3 hi = glm::max(from, to);
+        lo.y = std::max(lo.y, 0);
+        hi.y = std::min(hi.y, CHUNK_SIZE_Y - 1);
+        // y, z, x order matches the block layout, so each chunk's list is already sorted
+        for (int y = lo.y; y <= hi.y; y++) {
+            for (int z = lo.z; z <= hi.z; z++) {
+                for (int x = lo.x; x <= hi.x; x++) {
+                    setBlock(x, y, z, type);
+                }
+            }
+        }
+    }
+
+    // Writes queued so far (before duplicates are merged)
+    size_t size() const { return writeCount; }
+    bool empty() const { return writeCount == 0; }
+
+    void clear() {
+        pending.clear();
+        writeCount = 0;
+    }
+
+    // Hand the writes over per chunk, each list sorted by block index with one
+    // write per block (the last one queued). Leaves the batch empty.
+    std::vector<ChunkEdits> take() {
+        std::vector<ChunkEdits> result;
+        result.reserve(pending.size());
+        for (auto& [pos, edits] : pending) {
+            std::stable_sort(edits.begin(), edits.end(),
+                [](const Chunk::BlockEdit& a, const Chunk::BlockEdit& b) { return a.index < b.index; });
+
+            size_t unique = 0;
+            for (const Chunk::BlockEdit& edit : edits) {
+                if (unique > 0 && edits[unique - 1].index == edit.index) {
+                    edits[unique - 1] = edit;
+                } else {
+                    edits[unique++] = edit;
+                }
+            }
+            edits.resize(unique);
+            result.emplace_back(pos, std::move(edits));
+        }
+        clear();
+        return result;
+    }
+
+private:
+    std::unordered_map<glm::ivec2, std::vector<Chunk::BlockEdit>> pending;
+    size_t writeCount = 0;
+};
@@ -52,6 +52,24 @@ inline std::vector<std::string> getGenerationTypeNames() {
     };
 }
 
+// ============================================
+// CAVE SAMPLING
+// How carveCaves evaluates its 3D cave noise
+// ============================================
+enum class CaveSampling {
+    PER_VOXEL = 0,      // Exact noise at every block (worlds created before the lattice mode)
+    COARSE_LATTICE,     // Noise on a 4x8x4 lattice, trilinearly interpolated (much faster)
+    COUNT
+};
+
+inline const char* getCaveSamplingName(CaveSampling mode) {
+    switch (mode) {
+        case CaveSampling::PER_VOXEL:      return "PerVoxel";
+        case CaveSampling::COARSE_LATTICE: return "CoarseLattice";
+        default:                           return "Unknown";
+    }
+}
+
 // ============================================
 // WORLD SETTINGS
 // ============================================
@@ -61,6 +79,7 @@ struct WorldSettings {
     int64_t seedValue = 0;  // Computed from seed string
 
     GenerationType generationType = GenerationType::DEFAULT;
+    CaveSampling caveSampling = CaveSampling::COARSE_LATTICE;
 
     // Height parameters
     int maxYHeight = 256;       // 64-512
@@ -106,6 +125,7 @@ struct GenerationPreset {
     std::string name;
     std::string description;
     GenerationType type = GenerationType::DEFAULT;
+    CaveSampling caveSampling = CaveSampling::COARSE_LATTICE;
 
     // Height parameters
     int baseHeight = 64;
@@ -130,6 +150,7 @@ struct GenerationPreset {
     // Apply this preset to world settings
     void applyToSettings(WorldSettings& settings) const {
         settings.generationType = type;
+        settings.caveSampling = caveSampling;
         settings.baseHeight = baseHeight;
         settings.seaLevel = seaLevel;
         settings.maxYHeight = maxHeight;
@@ -203,6 +224,7 @@ public:
 
         std::string typeStr = extractString(content, "type");
         preset.type = parseGenerationType(typeStr);
+        preset.caveSampling = parseCaveSampling(extractString(content, "caveSampling"));
 
         return preset;
     }
@@ -218,6 +240,7 @@ public:
         file << "    \"name\": \"" << escapeJson(preset.name) << "\",\n";
         file << "    \"description\": \"" << escapeJson(preset.description) << "\",\n";
         file << "    \"type\": \"" << getGenerationTypeName(preset.type) << "\",\n";
+        file << "    \"caveSampling\": \"" << getCaveSamplingName(preset.caveSampling) << "\",\n";
         file << "    \"baseHeight\": " << preset.baseHeight << ",\n";
         file << "    \"seaLevel\": " << preset.seaLevel << ",\n";
         file << "    \"maxHeight\": " << preset.maxHeight << ",\n";
@@ -397,6 +420,11 @@ private:
         return GenerationType::DEFAULT;
     }
 
+    static CaveSampling parseCaveSampling(const std::string& str) {
+        if (str == "PerVoxel" || str == "PER_VOXEL") return CaveSampling::PER_VOXEL;
+        return CaveSampling::COARSE_LATTICE;
+    }
+
     static std::string escapeJson(const std::string& str) {
         std::string result;
         for (char c : str) {
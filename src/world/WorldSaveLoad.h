@@ -4,7 +4,6 @@
 // Handles saving and loading world data including chunks, player position, etc.
 
 #include "Chunk.h"
-#include "../ui/WorldSelectScreen.h"
 #include "../core/Inventory.h"
 #include <string>
 #include <fstream>
@@ -24,7 +23,8 @@ public:
 
     // Save world metadata
     static bool saveWorldMeta(const std::string& worldPath, const std::string& worldName,
-                              int seed, int generationType, int maxHeight) {
+                              int seed, int generationType, int maxHeight,
+                              int caveSampling = 0) {
         std::string metaPath = worldPath + "/world.meta";
 
         std::ofstream metaFile(metaPath);
@@ -37,6 +37,7 @@ public:
         metaFile << "seed=" << seed << "\n";
         metaFile << "generationType=" << generationType << "\n";
         metaFile << "maxHeight=" << maxHeight << "\n";
+        metaFile << "caveSampling=" << caveSampling << "\n";
         metaFile << "lastPlayed=" << std::time(nullptr) << "\n";
 
         metaFile.close();
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "World.h"
+#include "Chunk.h"
+#include "Block.h"
+#include <glm/glm.hpp>
+#include <vector>
+#include <cmath>
+
+// ============================================
+// WORLD VIEW
+// ============================================
+// Pins a square of chunk columns around a point (3x3 by default) with one
+// lookup under the chunk map lock, then serves block reads and writes in
+// that area without locking or hashing: chunk = coordinate >> 4, local =
+// coordinate & 15. Reads outside the pinned area still work; they go
+// through World (locked), remembering the last chunk they hit.
+//
+// A view is short-lived (one query, one update); don't keep one across
+// frames. Chunks only unload on the main thread, so the pinned pointers stay
+// valid for as long as the main thread keeps the view alive - including
+// while worker jobs read through it and the main thread waits for them (as
+// in parallelEach). Pinned reads are plain loads, so jobs may share a view;
+// reads outside the pinned area update the view's last-chunk cache, so a job
+// that may leave the area uses its own view. setBlock is main-thread only.
+// ============================================
+
+class WorldView {
+public:
+    static constexpr int CHUNK_SHIFT = 4;
+    static constexpr int CHUNK_MASK = (1 << CHUNK_SHIFT) - 1;
+    static_assert(CHUNK_SIZE_X == (1 << CHUNK_SHIFT) && CHUNK_SIZE_Z == (1 << CHUNK_SHIFT),
+                  "WorldView addressing assumes 16x16 chunk columns");
+
+    // Pin the (2 * radius + 1)^2 chunks around centerChunk
+    WorldView(World& world, glm::ivec2 centerChunk, int radius = 1)
+        : world(world),
+          origin(centerChunk - glm::ivec2(radius)),
+          width(2 * radius + 1),
+          pinned(static_cast<size_t>(width * width)) {
+        world.pinChunks(origin, width, pinned.data());
+    }
+
+    // Pin the chunks around a world position
+    static WorldView around(World& world, const glm::vec3& position, int radius = 1) {
+        glm::ivec2 chunk(static_cast<int>(std::floor(position.x)) >> CHUNK_SHIFT,
+                         static_cast<int>(std::floor(position.z)) >> CHUNK_SHIFT);
+        return WorldView(world, chunk, radius);
+    }
+
+    // Chunk column holding world block column (x, z); null when unloaded
+    Chunk* chunkAt(int x, int z) const {
+        int cx = (x >> CHUNK_SHIFT) - origin.x;
+        int cz = (z >> CHUNK_SHIFT) - origin.y;
+        if (static_cast<unsigned>(cx) < static_cast<unsigned>(width) &&
+            static_cast<unsigned>(cz) < static_cast<unsigned>(width)) {
+            return pinned[cz * width + cx];
+        }
+        return chunkOutside(glm::ivec2(x >> CHUNK_SHIFT, z >> CHUNK_SHIFT));
+    }
+
+    // True if (x, z) is served without touching the chunk map
+    bool isPinned(int x, int z) const {
+        int cx = (x >> CHUNK_SHIFT) - origin.x;
+        int cz = (z >> CHUNK_SHIFT) - origin.y;
+        return static_cast<unsigned>(cx) < static_cast<unsigned>(width) &&
+               static_cast<unsigned>(cz) < static_cast<unsigned>(width);
+    }
+
+    // Block at world position; `missing` for unloaded chunks (AIR like World::getBlock,
+    // WATER like getBlockForWater, STONE like getBlockSafe)
+    BlockType getBlock(int x, int y, int z, BlockType missing = BlockType::AIR) const {
+        if (static_cast<unsigned>(y) >= static_cast<unsigned>(CHUNK_SIZE_Y)) return BlockType::AIR;
+        const Chunk* chunk = chunkAt(x, z);
+        if (!chunk) return missing;
+        return chunk->blocks[Chunk::toIndex(x & CHUNK_MASK, y, z & CHUNK_MASK)];
+    }
+
+    bool isSolid(int x, int y, int z) const { return isBlockSolid(getBlock(x, y, z)); }
+
+    uint8_t getWaterLevel(int x, int y, int z) const {
+        if (static_cast<unsigned>(y) >= static_cast<unsigned>(CHUNK_SIZE_Y)) return 0;
+        const Chunk* chunk = chunkAt(x, z);
+        if (!chunk) return 0;
+        return chunk->waterLevels[Chunk::toIndex(x & CHUNK_MASK, y, z & CHUNK_MASK)];
+    }
+
+    // Raw block write: updates the chunk's heightmap and section summary and
+    // marks it dirty, nothing else. Lighting, water, neighbour remeshing and
+    // saving are the caller's job - gameplay edits go through World::setBlock.
+    bool setBlock(int x, int y, int z, BlockType type) {
+        if (static_cast<unsigned>(y) >= static_cast<unsigned>(CHUNK_SIZE_Y)) return false;
+        Chunk* chunk = chunkAt(x, z);
+        if (!chunk) return false;
+        chunk->setBlock(x & CHUNK_MASK, y, z & CHUNK_MASK, type);
+        return true;
+    }
+
+    World& getWorld() const { return world; }
+
+private:
+    Chunk* chunkOutside(glm::ivec2 chunkPos) const {
+        if (!hasLastOutside || lastOutsidePos != chunkPos) {
+            lastOutside = world.getChunk(chunkPos);
+            lastOutsidePos = chunkPos;
+            hasLastOutside = true;
+        }
+        return lastOutside;
+    }
+
+    World& world;
+    glm::ivec2 origin;               // Chunk position of pinned[0]
+    int width;
+    std::vector<Chunk*> pinned;      // width x width, row-major by z
+
+    mutable glm::ivec2 lastOutsidePos{0};
+    mutable Chunk* lastOutside = nullptr;
+    mutable bool hasLastOutside = false;
+};